@@ -34,6 +34,7 @@ public:
 	virtual void IsPlayingLoadingScreen(bool& bIsPlaying, bool& bIsStartup) override { bIsPlaying = bIsPlayingLoadingScreen; bIsStartup = bIsInStartupScreen; }
 	virtual void StartupScreen_ShowLoadingComplete(FText LoadCompletePrompt) override;
 	virtual void DefaultScreen_UpdateLoadingText(FText NewLoadingText) override;
+	virtual void DefaultScreen_UpdateLoadingProgress(float NewProgress) override;
 	virtual void StopLoadingScreen() override;
 	virtual void ShowDefaultLoadingScreen(bool bShow = false) override;
 
@@ -54,6 +55,9 @@ private:
 
 	bool bShowDefaultLoadingCreen;
 
+	/** Last progress reported, handed over to default loading screens created afterwards */
+	float LoadingProgress;
+
 	TSharedPtr<SStartupLoadingScreen> StartupLoadingScreenWidget;
 	TSharedPtr<SDefaultLoadingScreen> DefaultLoadingScreenWidget;
 
@@ -63,6 +67,7 @@ private:
 IMPLEMENT_MODULE(FLoadingScreenModule, LoadingScreen)
 
 FLoadingScreenModule::FLoadingScreenModule()
+	: LoadingProgress(1.0f)
 {
 
 }
@@ -162,6 +167,8 @@ void FLoadingScreenModule::HandleLoadingScreenFinished()
 
 	bShowDefaultLoadingCreen = false;
 
+	LoadingProgress = 1.0f;
+
 	if (StartupLoadingScreenWidget.IsValid())
 		StartupLoadingScreenWidget.Reset();
 
@@ -207,6 +214,7 @@ void FLoadingScreenModule::BeginLoadingScreen(const FLoadingScreenDescription& S
 			if (ScreenDescription.bShowUIOverlay)
 			{
 				LoadingScreen.WidgetLoadingScreen = SAssignNew(DefaultLoadingScreenWidget, SDefaultLoadingScreen, ScreenDescription);
+				DefaultLoadingScreenWidget->UpdateLoadingProgress(LoadingProgress);
 			}
 			GetMoviePlayer()->SetupLoadingScreen(LoadingScreen);
 		}
@@ -256,6 +264,16 @@ void FLoadingScreenModule::DefaultScreen_UpdateLoadingText(FText NewLoadingText)
 	}
 }
 
+void FLoadingScreenModule::DefaultScreen_UpdateLoadingProgress(float NewProgress)
+{
+	LoadingProgress = FMath::Clamp(NewProgress, 0.0f, 1.0f);
+
+	if (DefaultLoadingScreenWidget.IsValid())
+	{
+		DefaultLoadingScreenWidget->UpdateLoadingProgress(LoadingProgress);
+	}
+}
+
 void FLoadingScreenModule::ShowDefaultLoadingScreen(bool bShow)
 {
 	bShowDefaultLoadingCreen = bShow;
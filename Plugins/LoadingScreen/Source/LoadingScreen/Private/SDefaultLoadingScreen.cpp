@@ -267,9 +267,14 @@ float SDefaultLoadingScreen::GetDPIScale() const
 	return GetDefault<UUserInterfaceSettings>()->GetDPIScaleBasedOnSize(Size);
 }
 
+void SDefaultLoadingScreen::UpdateLoadingProgress(float NewProgress)
+{
+	LoadingProgress = NewProgress;
+}
+
 TOptional<float> SDefaultLoadingScreen::GetProgressBarValue() const
 {
-	return TOptional<float>(1.0f);
+	return TOptional<float>(LoadingProgress);
 }
 
 #undef LOCTEXT_NAMESPACE
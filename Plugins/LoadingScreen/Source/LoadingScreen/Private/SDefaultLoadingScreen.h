@@ -20,9 +20,14 @@ public:
 
 	void UpdateLoadingText(FText NewLoadingText);
 
+	void UpdateLoadingProgress(float NewProgress);
+
 private:
 	TSharedPtr<STextBlock> LoadingText;
 
+	/** Read by the progress bar from the loading thread; only ever written whole from the game thread */
+	float LoadingProgress = 1.0f;
+
 	float GetDPIScale() const;
 	TOptional<float> GetProgressBarValue() const;
 	
@@ -52,6 +52,12 @@ public:
 	*/
 	virtual void DefaultScreen_UpdateLoadingText(FText NewLoadingText) {}
 
+	/*
+		Update loading progress bar (0..1) during default loading screen.
+		The bar stays full until some progress is reported.
+	*/
+	virtual void DefaultScreen_UpdateLoadingProgress(float NewProgress) {}
+
 	/*
 		Stop a loading screen manually.
 		Only in case FLoadingScreenSettings::bWaitForManualStop=true.
@@ -15,6 +15,12 @@ public class OBJPool : ModuleRules {
 			}
 		);
 		//
+		PrivateDependencyModuleNames.AddRange(
+			new string[] {
+				"MoviePlayer"
+			}
+		);
+		//
 		PublicIncludePaths.Add(Path.Combine(ModuleDirectory,"Public"));
 		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory,"Private"));
 	}///
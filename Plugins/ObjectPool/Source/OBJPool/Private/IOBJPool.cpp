@@ -8,8 +8,11 @@
 #include "IOBJPool.h"
 
 #include "OBJPool.h"
+#include "OBJPoolStats.h"
 #include "OBJPool_Shared.h"
 
+#include "Containers/Ticker.h"
+
 #if WITH_EDITORONLY_DATA
  #include "ISettingsModule.h"
  #include "ISettingsSection.h"
@@ -24,6 +27,8 @@
 
 class FOBJPool : public IOBJPool {
 private:
+	FDelegateHandle TelemetryTicker;
+	//
 	bool HandleSettingsSaved() {
 	  #if WITH_EDITORONLY_DATA
 		const auto &Settings = GetMutableDefault<UPoolSettings>();
@@ -57,8 +62,15 @@ private:
 	}///
 	//
 public:
-	virtual void StartupModule() override {RegisterSettings(); UE_LOG(LogTemp,Warning,TEXT(":: Initializing Object-Pool Plugin."));}
-	virtual void ShutdownModule() override {if (UObjectInitialized()) {UnregisterSettings();}}
+	virtual void StartupModule() override {
+		RegisterSettings(); UE_LOG(LogTemp,Warning,TEXT(":: Initializing Object-Pool Plugin."));
+		TelemetryTicker = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickPoolTelemetry));
+	}
+	//
+	virtual void ShutdownModule() override {
+		FTicker::GetCoreTicker().RemoveTicker(TelemetryTicker);
+		if (UObjectInitialized()) {UnregisterSettings();}
+	}
 	virtual bool SupportsDynamicReloading() override {return true;}
 };
 
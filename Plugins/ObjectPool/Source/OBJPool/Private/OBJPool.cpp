@@ -6,6 +6,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "OBJPool.h"
+#include "PoolPrewarm.h"
 #include "OBJPool_Shared.h"
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +18,17 @@ UPoolSettings::UPoolSettings(const FObjectInitializer &OBJ) : Super(OBJ) {
 	ReinitializeInstances = true;
 	InstantiateOnDemand = false;
 	//
+	TimeSlicedPrewarm = false;
+	PrewarmActorsPerFrame = 8;
+	PrewarmBudgetMs = 2.f;
+	PrewarmDuringLoadingScreen = true;
+	PrewarmLoadingScreenBudgetMs = 30.f;
+	//
+	AdaptiveSizing = false;
+	GrowthChunk = 4;
+	MaxPoolSize = 0;
+	TrimCooldown = 30.f;
+	//
 	LoadConfig();
 }
 
@@ -36,21 +48,28 @@ void UObjectPool::BeginPlay() {
 	Super::BeginPlay();
 	//
 	if (AutoInitialize) {InitializeObjectPool();}
+	//
+	const FPoolGrowthPolicy Policy = GetPoolGrowthPolicy();
+	if (Policy.TrimCooldown>0.f) {GetWorld()->GetTimerManager().SetTimer(TrimTimer,this,&UObjectPool::TrimObjectPool,Policy.TrimCooldown,true);}
 }
 
 void UObjectPool::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	if (UWorld* World = GetWorld()) {World->GetTimerManager().ClearTimer(TrimTimer);}
+	//
 	const auto &Settings = GetMutableDefault<UPoolSettings>();
 	if (!Settings->KeepOrphanActorsAlive) {EmptyObjectPool();}
-	else {
-		for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-			if (Pool[ID]->Spawned) {continue;}
-			Pool[ID]->Destroy(true,true);
-		}///
-	}///
+	else {Pool.EmptyInactive();}
 	//
 	Super::EndPlay(EndPlayReason);
 }
 
+void UObjectPool::AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector) {
+	UObjectPool* This = CastChecked<UObjectPool>(InThis);
+	This->Pool.AddReferencedObjects(Collector,This);
+	//
+	Super::AddReferencedObjects(InThis,Collector);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void UObjectPool::InitializeObjectPool() {
@@ -58,14 +77,15 @@ void UObjectPool::InitializeObjectPool() {
 		LOG_OBJ(true,5.f,FColor::Red,GetNameSafe(this)+FString(" : ")+FString("Invalid Template Class!"));
 	return;} EmptyObjectPool();
 	//
-	FTransform SpawnTransform(FRotator::ZeroRotator,FVector::ZeroVector,FVector(1.f,1.f,1.f));
-	for (int32 I=0; I<PoolSize; I++) {
-		const auto &ACT = GetWorld()->SpawnActorDeferred<APooledActor>(TemplateClass,SpawnTransform,this->GetOwner(),GetOwner()->GetInstigator(),ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
-		if (ACT) {
-			ACT->SharedPool = nullptr;
-			ACT->OwningPool = const_cast<UObjectPool*>(this);
-			ACT->FinishSpawning(SpawnTransform);
-	ACT->Initialize();}}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {
+		UClass* Class = TemplateClass.Get();
+		Prewarm->Enqueue(this,Class,PoolSize,
+			[this,Class](const int32 Count, const double Deadline){return Pool.Populate(GetWorld(),Class,Count,GetOwner(),[this](APooledActor* ACT){ACT->SharedPool=nullptr; ACT->OwningPool=this;},Deadline);},
+			[this](){FlushObjectPool();}
+		);
+	return;}
+	//
+	Pool.Populate(GetWorld(),TemplateClass,PoolSize,GetOwner(),[this](APooledActor* ACT){ACT->SharedPool=nullptr; ACT->OwningPool=this;});
 	//
 	FlushObjectPool();
 }
@@ -78,19 +98,17 @@ void UObjectPool::InitializeObjectPoolWithNewTemplateClass(const TSubclassOf<APo
 }
 
 void UObjectPool::FlushObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
-	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {Pool.RemoveAt(ID,1,false);}
-	}///
+	Pool.Compact();
+}
+
+void UObjectPool::TrimObjectPool() {
+	Pool.Trim(PoolSize,GetPoolGrowthPolicy());
 }
 
 void UObjectPool::EmptyObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {Prewarm->Cancel(this);}
 	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (Pool[ID]->IsValidLowLevelFast()) {Pool[ID]->Destroy(true,true);}
-	} Pool.Empty();
+	Pool.Empty();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -102,42 +120,29 @@ APooledActor* UObjectPool::BeginDeferredSpawnFromPool(const UObject* WorldContex
 		LOG_OBJ(true,5.f,FColor::Red,ObjectPool->GetName()+FString(" : ")+FString::Printf(TEXT("Requested Class(%s) not implemented by this Pool. Check the value of 'Template Class' on the Pool Component."),*PooledClass->GetName()));
 	return nullptr;}
 	//
-	if (ObjectPool->Pool.Num()==0) {ObjectPool->InitializeObjectPool();}
-	APooledActor* DeferredSpawn = ObjectPool->GetInactiveObject();
-	const auto &Settings = GetMutableDefault<UPoolSettings>();
+	if ((ObjectPool->Pool.Num()==0)&&(!UPoolPrewarmSubsystem::IsPrewarming(ObjectPool))) {ObjectPool->InitializeObjectPool();}
+	if (ObjectPool->Pool.NumFree()==0) {UPoolPrewarmSubsystem::PrewarmOnDemand(ObjectPool,ObjectPool->TemplateClass);}
 	//
-	if ((DeferredSpawn==nullptr) && Settings->InstantiateOnDemand) {
-		DeferredSpawn = ObjectPool->GetWorld()->SpawnActorDeferred<APooledActor>(ObjectPool->TemplateClass,SpawnTransform,Owner,ObjectPool->GetOwner()->GetInstigator(),CollisionHandlingOverride);
-		if (DeferredSpawn) {DeferredSpawn->SharedPool = nullptr; DeferredSpawn->OwningPool = ObjectPool; DeferredSpawn->FinishSpawning(SpawnTransform);}
-	} else if (DeferredSpawn==nullptr && Settings->NeverFailDeferredSpawn) {
-		DeferredSpawn = ObjectPool->GetSpawnedObject();
-		if (DeferredSpawn!=nullptr) {DeferredSpawn->ReturnToPool();}
-	} ObjectPool->FlushObjectPool();
-	//
-	if (DeferredSpawn!=nullptr) {
-		const APawn* Instigator = Cast<APawn>(WorldContextObject);
-		if (Instigator==nullptr) { if (const AActor* ContextActor = Cast<AActor>(WorldContextObject)) {Instigator = ContextActor->GetInstigator();} }
-		if (Instigator!=nullptr) {DeferredSpawn->SetInstigator(const_cast<APawn*>(Instigator));}
-		if (Owner==nullptr) {DeferredSpawn->SetOwner(ObjectPool->GetOwner());}
-		//
-		DeferredSpawn->OwningPool = ObjectPool;
-		DeferredSpawn->SharedPool = nullptr;
-		DeferredSpawn->Initialize();
-		//
-		DeferredSpawn->SpawnFromPool(Reconstruct,SpawnOptions,SpawnTransform);
-		SpawnSuccessful = DeferredSpawn->Spawned;
-	} else {
-		SpawnSuccessful = false;
-		DeferredSpawn = ObjectPool->GetSpawnedObject();
-	} return DeferredSpawn;
+	return ObjectPool->Pool.BeginDeferredSpawn(
+		WorldContextObject,ObjectPool->GetWorld(),ObjectPool->TemplateClass,nullptr,GetPoolGrowthPolicy(),ObjectPool->GetOwner(),Owner,
+		SpawnOptions,SpawnTransform,CollisionHandlingOverride,Reconstruct,[ObjectPool](APooledActor* ACT){ACT->SharedPool=nullptr; ACT->OwningPool=ObjectPool;},SpawnSuccessful
+	);
 }
 
 APooledActor* UObjectPool::FinishDeferredSpawnFromPool(APooledActor* Actor, const bool Reconstruct, const FTransform &SpawnTransform) {
-	if (Actor->IsValidLowLevelFast()&&(!Actor->IsPendingKill())&&(!Actor->IsActorInitialized())) {
-		Actor->FinishSpawning(SpawnTransform);
-	} if (Actor->IsValidLowLevelFast()&&(!Actor->IsPendingKill())) {
-		Actor->FinishSpawnFromPool(Reconstruct,SpawnTransform);
-	} return Actor;
+	return TPoolCore<APooledActor>::FinishDeferredSpawn(Actor,Reconstruct,SpawnTransform);
+}
+
+int32 UObjectPool::SpawnManyFromPool(const UObject* WorldContextObject, UObjectPool* ObjectPool, const FPoolSpawnOptions &SpawnOptions, const TArray<FTransform> &SpawnTransforms, const int32 Count, AActor* Owner, const bool Reconstruct, TArray<APooledActor*> &Spawned) {
+	if (!ObjectPool->IsValidLowLevelFast()||ObjectPool->IsPendingKill()||ObjectPool->GetOwner()==nullptr||ObjectPool->TemplateClass.Get()==nullptr) {return 0;}
+	//
+	if ((ObjectPool->Pool.Num()==0)&&(!UPoolPrewarmSubsystem::IsPrewarming(ObjectPool))) {ObjectPool->InitializeObjectPool();}
+	if (ObjectPool->Pool.NumFree()<Count) {UPoolPrewarmSubsystem::PrewarmOnDemand(ObjectPool,ObjectPool->TemplateClass);}
+	//
+	return ObjectPool->Pool.SpawnMany(
+		WorldContextObject,ObjectPool->GetWorld(),ObjectPool->TemplateClass,nullptr,GetPoolGrowthPolicy(),ObjectPool->GetOwner(),Owner,SpawnOptions,SpawnTransforms,Count,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn,Reconstruct,[ObjectPool](APooledActor* ACT){ACT->SharedPool=nullptr; ACT->OwningPool=ObjectPool;},Spawned
+	);
 }
 
 void UObjectPool::ReturnActor(APooledActor* PooledActor) {
@@ -146,47 +151,33 @@ void UObjectPool::ReturnActor(APooledActor* PooledActor) {
 	//
 	if (TemplateClass.Get()==nullptr) {return;}
 	if (PooledActor->GetClass()->IsChildOf(TemplateClass->GetDefaultObject()->GetClass())) {
-		if (!Pool.Contains(PooledActor)) {
-			PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
-			Pool.Add(PooledActor);
-		}///
+		if (Pool.Release(PooledActor)) {return;}
+		//
+		PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
+		Pool.Add(PooledActor);
 	}///
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void UObjectPool::GetObjectsFromPool(TArray<APooledActor*> &Spawned, TArray<APooledActor*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (OBJ->Spawned) {Spawned.Add(OBJ);} else {Inactive.Add(OBJ);}}
+	Pool.Gather<APooledActor>(&Spawned,&Inactive);
 }
 
 void UObjectPool::GetSpawnedObjects(TArray<APooledActor*> &Spawned) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (OBJ->Spawned) {Spawned.Add(OBJ);}}
+	Pool.Gather<APooledActor>(&Spawned,nullptr);
 }
 
 void UObjectPool::GetInactiveObjects(TArray<APooledActor*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (!OBJ->Spawned) {Inactive.Add(OBJ);}}
+	Pool.Gather<APooledActor>(nullptr,&Inactive);
 }
 
 APooledActor* UObjectPool::GetSpawnedObject() const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-	if (Pool[ID]->Spawned) {return Pool[ID];}}
-	//
-	return nullptr;
+	return Pool.GetSpawned();
 }
 
 APooledActor* UObjectPool::GetInactiveObject() const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-	if (!Pool[ID]->Spawned) {return Pool[ID];}}
-	//
-	return nullptr;
+	return Pool.GetInactive();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,21 +196,28 @@ void UPawnPool::BeginPlay() {
 	Super::BeginPlay();
 	//
 	if (AutoInitialize) {InitializeObjectPool();}
+	//
+	const FPoolGrowthPolicy Policy = GetPoolGrowthPolicy();
+	if (Policy.TrimCooldown>0.f) {GetWorld()->GetTimerManager().SetTimer(TrimTimer,this,&UPawnPool::TrimObjectPool,Policy.TrimCooldown,true);}
 }
 
 void UPawnPool::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	if (UWorld* World = GetWorld()) {World->GetTimerManager().ClearTimer(TrimTimer);}
+	//
 	const auto &Settings = GetMutableDefault<UPoolSettings>();
 	if (!Settings->KeepOrphanActorsAlive) {EmptyObjectPool();}
-	else {
-		for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-			if (Pool[ID]->Spawned) {continue;}
-			Pool[ID]->Destroy(true,true);
-		}///
-	}///
+	else {Pool.EmptyInactive();}
 	//
 	Super::EndPlay(EndPlayReason);
 }
 
+void UPawnPool::AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector) {
+	UPawnPool* This = CastChecked<UPawnPool>(InThis);
+	This->Pool.AddReferencedObjects(Collector,This);
+	//
+	Super::AddReferencedObjects(InThis,Collector);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void UPawnPool::InitializeObjectPool() {
@@ -227,13 +225,17 @@ void UPawnPool::InitializeObjectPool() {
 		LOG_OBJ(true,5.f,FColor::Red,GetNameSafe(this)+FString(" : ")+FString("Invalid Template Class!"));
 	return;} EmptyObjectPool();
 	//
-	FTransform SpawnTransform(FRotator::ZeroRotator,FVector::ZeroVector,FVector(1.f,1.f,1.f));
-	for (int32 I=0; I<PoolSize; I++) {
-		const auto &ACT = GetWorld()->SpawnActorDeferred<APooledPawn>(TemplateClass,SpawnTransform,this->GetOwner(),GetOwner()->GetInstigator(),ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
-		if (ACT) {
-			ACT->OwningPool = const_cast<UPawnPool*>(this);
-			ACT->FinishSpawning(SpawnTransform);
-	ACT->Initialize();}}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {
+		UClass* Class = TemplateClass.Get();
+		Prewarm->Enqueue(this,Class,PoolSize,
+			[this,Class](const int32 Count, const double Deadline){return Pool.Populate(GetWorld(),Class,Count,GetOwner(),[this](APooledPawn* ACT){ACT->OwningPool=this;},Deadline);},
+			[this](){FlushObjectPool();}
+		);
+	return;}
+	//
+	Pool.Populate(GetWorld(),TemplateClass,PoolSize,GetOwner(),[this](APooledPawn* ACT){ACT->OwningPool=this;});
+	//
+	FlushObjectPool();
 }
 
 void UPawnPool::InitializeObjectPoolWithNewTemplateClass(const TSubclassOf<APooledPawn> Template, const int32 SizeOfPool) {
@@ -244,19 +246,17 @@ void UPawnPool::InitializeObjectPoolWithNewTemplateClass(const TSubclassOf<APool
 }
 
 void UPawnPool::FlushObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
-	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {Pool.RemoveAt(ID,1,false);}
-	}///
+	Pool.Compact();
+}
+
+void UPawnPool::TrimObjectPool() {
+	Pool.Trim(PoolSize,GetPoolGrowthPolicy());
 }
 
 void UPawnPool::EmptyObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {Prewarm->Cancel(this);}
 	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (Pool[ID]->IsValidLowLevelFast()) {Pool[ID]->Destroy(true,true);}
-	} Pool.Empty();
+	Pool.Empty();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,41 +268,17 @@ APooledPawn* UPawnPool::BeginDeferredSpawnFromPool(const UObject* WorldContextOb
 		LOG_OBJ(true,5.f,FColor::Red,ObjectPool->GetName()+FString(" : ")+FString::Printf(TEXT("Requested Class(%s) not implemented by this Pool. Check the value of 'Template Class' on the Pool Component."),*PooledClass->GetName()));
 	return nullptr;}
 	//
-	if (ObjectPool->Pool.Num()==0) {ObjectPool->InitializeObjectPool();}
-	APooledPawn* DeferredSpawn = ObjectPool->GetInactiveObject();
-	const auto &Settings = GetMutableDefault<UPoolSettings>();
+	if ((ObjectPool->Pool.Num()==0)&&(!UPoolPrewarmSubsystem::IsPrewarming(ObjectPool))) {ObjectPool->InitializeObjectPool();}
+	if (ObjectPool->Pool.NumFree()==0) {UPoolPrewarmSubsystem::PrewarmOnDemand(ObjectPool,ObjectPool->TemplateClass);}
 	//
-	if ((DeferredSpawn==nullptr) && Settings->InstantiateOnDemand) {
-		DeferredSpawn = ObjectPool->GetWorld()->SpawnActorDeferred<APooledPawn>(ObjectPool->TemplateClass,SpawnTransform,Owner,ObjectPool->GetOwner()->GetInstigator(),CollisionHandlingOverride);
-		if (DeferredSpawn) {DeferredSpawn->OwningPool = ObjectPool; DeferredSpawn->FinishSpawning(SpawnTransform);}
-	} else if (DeferredSpawn==nullptr && Settings->NeverFailDeferredSpawn) {
-		DeferredSpawn = ObjectPool->GetSpawnedObject();
-		if (DeferredSpawn!=nullptr) {DeferredSpawn->ReturnToPool();}
-	} ObjectPool->FlushObjectPool();
-	//
-	if (DeferredSpawn!=nullptr) {
-		const APawn* Instigator = Cast<APawn>(WorldContextObject);
-		if (Instigator==nullptr) { if (const AActor* ContextActor = Cast<AActor>(WorldContextObject)) {Instigator = ContextActor->GetInstigator();} }
-		if (Instigator!=nullptr) {DeferredSpawn->SetInstigator(const_cast<APawn*>(Instigator));}
-		if (Owner==nullptr) {DeferredSpawn->SetOwner(ObjectPool->GetOwner());}
-		//
-		DeferredSpawn->OwningPool = ObjectPool;
-		DeferredSpawn->Initialize();
-		//
-		DeferredSpawn->SpawnFromPool(Reconstruct,SpawnOptions,SpawnTransform);
-		SpawnSuccessful = DeferredSpawn->Spawned;
-	} else {
-		SpawnSuccessful = false;
-		DeferredSpawn = ObjectPool->GetSpawnedObject();
-	} return DeferredSpawn;
+	return ObjectPool->Pool.BeginDeferredSpawn(
+		WorldContextObject,ObjectPool->GetWorld(),ObjectPool->TemplateClass,nullptr,GetPoolGrowthPolicy(),ObjectPool->GetOwner(),Owner,
+		SpawnOptions,SpawnTransform,CollisionHandlingOverride,Reconstruct,[ObjectPool](APooledPawn* ACT){ACT->OwningPool=ObjectPool;},SpawnSuccessful
+	);
 }
 
 APooledPawn* UPawnPool::FinishDeferredSpawnFromPool(APooledPawn* Pawn, const bool Reconstruct, const FTransform &SpawnTransform) {
-	if (Pawn->IsValidLowLevelFast()&&(!Pawn->IsPendingKill())&&(!Pawn->IsActorInitialized())) {
-		Pawn->FinishSpawning(SpawnTransform);
-	} if (Pawn->IsValidLowLevelFast()&&(!Pawn->IsPendingKill())) {
-		Pawn->FinishSpawnFromPool(Reconstruct,SpawnTransform);
-	} return Pawn;
+	return TPoolCore<APooledPawn>::FinishDeferredSpawn(Pawn,Reconstruct,SpawnTransform);
 }
 
 void UPawnPool::ReturnActor(APooledPawn* PooledActor) {
@@ -311,47 +287,33 @@ void UPawnPool::ReturnActor(APooledPawn* PooledActor) {
 	//
 	if (TemplateClass.Get()==nullptr) {return;}
 	if (PooledActor->GetClass()->IsChildOf(TemplateClass->GetDefaultObject()->GetClass())) {
-		if (!Pool.Contains(PooledActor)) {
-			PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
-			Pool.Add(PooledActor);
-		}///
+		if (Pool.Release(PooledActor)) {return;}
+		//
+		PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
+		Pool.Add(PooledActor);
 	}///
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void UPawnPool::GetObjectsFromPool(TArray<APooledPawn*> &Spawned, TArray<APooledPawn*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (OBJ->Spawned) {Spawned.Add(OBJ);} else {Inactive.Add(OBJ);}}
+	Pool.Gather<APooledPawn>(&Spawned,&Inactive);
 }
 
 void UPawnPool::GetSpawnedObjects(TArray<APooledPawn*> &Spawned) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (OBJ->Spawned) {Spawned.Add(OBJ);}}
+	Pool.Gather<APooledPawn>(&Spawned,nullptr);
 }
 
 void UPawnPool::GetInactiveObjects(TArray<APooledPawn*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (!OBJ->Spawned) {Inactive.Add(OBJ);}}
+	Pool.Gather<APooledPawn>(nullptr,&Inactive);
 }
 
 APooledPawn* UPawnPool::GetSpawnedObject() const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-	if (Pool[ID]->Spawned) {return Pool[ID];}}
-	//
-	return nullptr;
+	return Pool.GetSpawned();
 }
 
 APooledPawn* UPawnPool::GetInactiveObject() const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-	if (!Pool[ID]->Spawned) {return Pool[ID];}}
-	//
-	return nullptr;
+	return Pool.GetInactive();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -370,21 +332,28 @@ void UCharacterPool::BeginPlay() {
 	Super::BeginPlay();
 	//
 	if (AutoInitialize) {InitializeObjectPool();}
+	//
+	const FPoolGrowthPolicy Policy = GetPoolGrowthPolicy();
+	if (Policy.TrimCooldown>0.f) {GetWorld()->GetTimerManager().SetTimer(TrimTimer,this,&UCharacterPool::TrimObjectPool,Policy.TrimCooldown,true);}
 }
 
 void UCharacterPool::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	if (UWorld* World = GetWorld()) {World->GetTimerManager().ClearTimer(TrimTimer);}
+	//
 	const auto &Settings = GetMutableDefault<UPoolSettings>();
 	if (!Settings->KeepOrphanActorsAlive) {EmptyObjectPool();}
-	else {
-		for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-			if (Pool[ID]->Spawned) {continue;}
-			Pool[ID]->Destroy(true,true);
-		}///
-	}///
+	else {Pool.EmptyInactive();}
 	//
 	Super::EndPlay(EndPlayReason);
 }
 
+void UCharacterPool::AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector) {
+	UCharacterPool* This = CastChecked<UCharacterPool>(InThis);
+	This->Pool.AddReferencedObjects(Collector,This);
+	//
+	Super::AddReferencedObjects(InThis,Collector);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void UCharacterPool::InitializeObjectPool() {
@@ -392,13 +361,17 @@ void UCharacterPool::InitializeObjectPool() {
 		LOG_OBJ(true,5.f,FColor::Red,GetNameSafe(this)+FString(" : ")+FString("Invalid Template Class!"));
 	return;} EmptyObjectPool();
 	//
-	FTransform SpawnTransform(FRotator::ZeroRotator,FVector::ZeroVector,FVector(1.f,1.f,1.f));
-	for (int32 I=0; I<PoolSize; I++) {
-		const auto &ACT = GetWorld()->SpawnActorDeferred<APooledCharacter>(TemplateClass,SpawnTransform,this->GetOwner(),GetOwner()->GetInstigator(),ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
-		if (ACT) {
-			ACT->OwningPool = const_cast<UCharacterPool*>(this);
-			ACT->FinishSpawning(SpawnTransform);
-	ACT->Initialize();}}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {
+		UClass* Class = TemplateClass.Get();
+		Prewarm->Enqueue(this,Class,PoolSize,
+			[this,Class](const int32 Count, const double Deadline){return Pool.Populate(GetWorld(),Class,Count,GetOwner(),[this](APooledCharacter* ACT){ACT->OwningPool=this;},Deadline);},
+			[this](){FlushObjectPool();}
+		);
+	return;}
+	//
+	Pool.Populate(GetWorld(),TemplateClass,PoolSize,GetOwner(),[this](APooledCharacter* ACT){ACT->OwningPool=this;});
+	//
+	FlushObjectPool();
 }
 
 void UCharacterPool::InitializeObjectPoolWithNewTemplateClass(const TSubclassOf<APooledCharacter> Template, const int32 SizeOfPool) {
@@ -409,19 +382,17 @@ void UCharacterPool::InitializeObjectPoolWithNewTemplateClass(const TSubclassOf<
 }
 
 void UCharacterPool::FlushObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
-	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {Pool.RemoveAt(ID,1,false);}
-	}///
+	Pool.Compact();
+}
+
+void UCharacterPool::TrimObjectPool() {
+	Pool.Trim(PoolSize,GetPoolGrowthPolicy());
 }
 
 void UCharacterPool::EmptyObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {Prewarm->Cancel(this);}
 	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (Pool[ID]->IsValidLowLevelFast()) {Pool[ID]->Destroy(true,true);}
-	} Pool.Empty();
+	Pool.Empty();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -433,41 +404,17 @@ APooledCharacter* UCharacterPool::BeginDeferredSpawnFromPool(const UObject* Worl
 		LOG_OBJ(true,5.f,FColor::Red,ObjectPool->GetName()+FString(" : ")+FString::Printf(TEXT("Requested Class(%s) not implemented by this Pool. Check the value of 'Template Class' on the Pool Component."),*PooledClass->GetName()));
 	return nullptr;}
 	//
-	if (ObjectPool->Pool.Num()==0) {ObjectPool->InitializeObjectPool();}
-	APooledCharacter* DeferredSpawn = ObjectPool->GetInactiveObject();
-	const auto &Settings = GetMutableDefault<UPoolSettings>();
+	if ((ObjectPool->Pool.Num()==0)&&(!UPoolPrewarmSubsystem::IsPrewarming(ObjectPool))) {ObjectPool->InitializeObjectPool();}
+	if (ObjectPool->Pool.NumFree()==0) {UPoolPrewarmSubsystem::PrewarmOnDemand(ObjectPool,ObjectPool->TemplateClass);}
 	//
-	if ((DeferredSpawn==nullptr) && Settings->InstantiateOnDemand) {
-		DeferredSpawn = ObjectPool->GetWorld()->SpawnActorDeferred<APooledCharacter>(ObjectPool->TemplateClass,SpawnTransform,Owner,ObjectPool->GetOwner()->GetInstigator(),CollisionHandlingOverride);
-		if (DeferredSpawn) {DeferredSpawn->OwningPool = ObjectPool; DeferredSpawn->FinishSpawning(SpawnTransform);}
-	} else if (DeferredSpawn==nullptr && Settings->NeverFailDeferredSpawn) {
-		DeferredSpawn = ObjectPool->GetSpawnedObject();
-		if (DeferredSpawn!=nullptr) {DeferredSpawn->ReturnToPool();}
-	} ObjectPool->FlushObjectPool();
-	//
-	if (DeferredSpawn!=nullptr) {
-		const APawn* Instigator = Cast<APawn>(WorldContextObject);
-		if (Instigator==nullptr) { if (const AActor* ContextActor = Cast<AActor>(WorldContextObject)) {Instigator = ContextActor->GetInstigator();} }
-		if (Instigator!=nullptr) {DeferredSpawn->SetInstigator(const_cast<APawn*>(Instigator));}
-		if (Owner==nullptr) {DeferredSpawn->SetOwner(ObjectPool->GetOwner());}
-		//
-		DeferredSpawn->OwningPool = ObjectPool;
-		DeferredSpawn->Initialize();
-		//
-		DeferredSpawn->SpawnFromPool(Reconstruct,SpawnOptions,SpawnTransform);
-		SpawnSuccessful = DeferredSpawn->Spawned;
-	} else {
-		SpawnSuccessful = false;
-		DeferredSpawn = ObjectPool->GetSpawnedObject();
-	} return DeferredSpawn;
+	return ObjectPool->Pool.BeginDeferredSpawn(
+		WorldContextObject,ObjectPool->GetWorld(),ObjectPool->TemplateClass,nullptr,GetPoolGrowthPolicy(),ObjectPool->GetOwner(),Owner,
+		SpawnOptions,SpawnTransform,CollisionHandlingOverride,Reconstruct,[ObjectPool](APooledCharacter* ACT){ACT->OwningPool=ObjectPool;},SpawnSuccessful
+	);
 }
 
 APooledCharacter* UCharacterPool::FinishDeferredSpawnFromPool(APooledCharacter* Character, const bool Reconstruct, const FTransform &SpawnTransform) {
-	if (Character->IsValidLowLevelFast()&&(!Character->IsPendingKill())&&(!Character->IsActorInitialized())) {
-		Character->FinishSpawning(SpawnTransform);
-	} if (Character->IsValidLowLevelFast()&&(!Character->IsPendingKill())) {
-		Character->FinishSpawnFromPool(Reconstruct,SpawnTransform);
-	} return Character;
+	return TPoolCore<APooledCharacter>::FinishDeferredSpawn(Character,Reconstruct,SpawnTransform);
 }
 
 void UCharacterPool::ReturnActor(APooledCharacter* PooledActor) {
@@ -476,47 +423,33 @@ void UCharacterPool::ReturnActor(APooledCharacter* PooledActor) {
 	//
 	if (TemplateClass.Get()==nullptr) {return;}
 	if (PooledActor->GetClass()->IsChildOf(TemplateClass->GetDefaultObject()->GetClass())) {
-		if (!Pool.Contains(PooledActor)) {
-			PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
-			Pool.Add(PooledActor);
-		}///
+		if (Pool.Release(PooledActor)) {return;}
+		//
+		PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
+		Pool.Add(PooledActor);
 	}///
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void UCharacterPool::GetObjectsFromPool(TArray<APooledCharacter*> &Spawned, TArray<APooledCharacter*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (OBJ->Spawned) {Spawned.Add(OBJ);} else {Inactive.Add(OBJ);}}
+	Pool.Gather<APooledCharacter>(&Spawned,&Inactive);
 }
 
 void UCharacterPool::GetSpawnedObjects(TArray<APooledCharacter*> &Spawned) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (OBJ->Spawned) {Spawned.Add(OBJ);}}
+	Pool.Gather<APooledCharacter>(&Spawned,nullptr);
 }
 
 void UCharacterPool::GetInactiveObjects(TArray<APooledCharacter*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-	if (!OBJ->Spawned) {Inactive.Add(OBJ);}}
+	Pool.Gather<APooledCharacter>(nullptr,&Inactive);
 }
 
 APooledCharacter* UCharacterPool::GetSpawnedObject() const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-	if (Pool[ID]->Spawned) {return Pool[ID];}}
-	//
-	return nullptr;
+	return Pool.GetSpawned();
 }
 
 APooledCharacter* UCharacterPool::GetInactiveObject() const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-	if (!Pool[ID]->Spawned) {return Pool[ID];}}
-	//
-	return nullptr;
+	return Pool.GetInactive();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,22 +475,50 @@ void USharedObjectPool::BeginPlay() {
 	Super::BeginPlay();
 	//
 	if (AutoInitialize) {InitializeObjectPool();}
+	//
+	const FPoolGrowthPolicy Policy = GetPoolGrowthPolicy();
+	if (Policy.TrimCooldown>0.f) {GetWorld()->GetTimerManager().SetTimer(TrimTimer,this,&USharedObjectPool::TrimObjectPool,Policy.TrimCooldown,true);}
 }
 
 void USharedObjectPool::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	if (UWorld* World = GetWorld()) {World->GetTimerManager().ClearTimer(TrimTimer);}
+	//
 	const auto &Settings = GetMutableDefault<UPoolSettings>();
 	if (!Settings->KeepOrphanActorsAlive) {
 		EmptyObjectPool(APooledActor::StaticClass());
 	} else {
-		for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-			if (Pool[ID]->Spawned) {continue;}
-			Pool[ID]->Destroy(true,true);
-		}///
+		for (auto &Bucket : Buckets) {Bucket.Value->EmptyInactive();}
 	}///
 	//
 	Super::EndPlay(EndPlayReason);
 }
 
+void USharedObjectPool::AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector) {
+	USharedObjectPool* This = CastChecked<USharedObjectPool>(InThis);
+	for (auto &Bucket : This->Buckets) {Bucket.Value->AddReferencedObjects(Collector,This);}
+	//
+	Super::AddReferencedObjects(InThis,Collector);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TPoolCore<APooledActor>* USharedObjectPool::FindBucket(const UClass* Class) {
+	for (const UClass* Key = Class; Key!=nullptr; Key = Key->GetSuperClass()) {
+		if (TUniquePtr<TPoolCore<APooledActor>>* Bucket = Buckets.Find(Key)) {return Bucket->Get();}
+	} return nullptr;
+}
+
+const TPoolCore<APooledActor>* USharedObjectPool::FindBucket(const UClass* Class) const {
+	return const_cast<USharedObjectPool*>(this)->FindBucket(Class);
+}
+
+TPoolCore<APooledActor> &USharedObjectPool::FindOrAddBucket(const UClass* Class) {
+	TUniquePtr<TPoolCore<APooledActor>> &Bucket = Buckets.FindOrAdd(Class);
+	if (!Bucket.IsValid()) {Bucket = MakeUnique<TPoolCore<APooledActor>>();}
+	//
+	return *Bucket;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void USharedObjectPool::InitializeObjectPool() {
@@ -565,99 +526,148 @@ void USharedObjectPool::InitializeObjectPool() {
 		LOG_OBJ(true,5.f,FColor::Red,GetNameSafe(this)+FString(" : ")+FString("Invalid Template Classes!"));
 	return;} EmptyObjectPool(APooledActor::StaticClass());
 	//
-	FTransform SpawnTransform(FRotator::ZeroRotator,FVector::ZeroVector,FVector(1.f,1.f,1.f));
-	TArray<TSubclassOf<APooledActor>>Classes;
-	TemplateClasses.GenerateKeyArray(Classes);
+	// Buckets are made up front: members find theirs when they first return to the Pool.
+	Buckets.Empty(TemplateClasses.Num()); PeakActive = 0;
+	for (const auto &Template : TemplateClasses) {
+		if (Template.Key.Get()!=nullptr) {FindOrAddBucket(Template.Key.Get());}
+	}///
 	//
-	for (const TSubclassOf<APooledActor>Class : Classes) {
-		if (Class.Get()==nullptr) {continue;}
-		int32 PoolSize = TemplateClasses.FindRef(Class);
-		//
-		for (int32 I=0; I<PoolSize; I++) {
-			const auto &ACT = GetWorld()->SpawnActorDeferred<APooledActor>(Class,SpawnTransform,this->GetOwner(),GetOwner()->GetInstigator(),ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
-			if (ACT) {
-				ACT->OwningPool = nullptr;
-				ACT->SharedPool = const_cast<USharedObjectPool*>(this);
-				ACT->FinishSpawning(SpawnTransform);
-		ACT->Initialize();}}
+	for (const auto &Template : TemplateClasses) {
+		if (Template.Key.Get()!=nullptr) {PopulateTemplateClass(Template.Key.Get(),Template.Value);}
 	}///
 	//
-	FlushObjectPool();
+	if (UPoolPrewarmSubsystem::Find(this)==nullptr) {FlushObjectPool();}
+}
+
+void USharedObjectPool::PopulateTemplateClass(UClass* Class, const int32 Size) {
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {
+		Prewarm->Enqueue(this,Class,Size,
+			[this,Class](const int32 Count, const double Deadline){return FindOrAddBucket(Class).Populate(GetWorld(),Class,Count,GetOwner(),[this](APooledActor* ACT){ACT->OwningPool=nullptr; ACT->SharedPool=this;},Deadline);},
+			[this](){FlushObjectPool();}
+		);
+	return;}
+	//
+	FindOrAddBucket(Class).Populate(GetWorld(),Class,Size,GetOwner(),[this](APooledActor* ACT){ACT->OwningPool=nullptr; ACT->SharedPool=this;});
+}
+
+void USharedObjectPool::AddTemplateClass(TSubclassOf<APooledActor> Class, const int32 Size) {
+	if ((Class.Get()==nullptr)||TemplateClasses.Contains(Class)) {return;}
+	TemplateClasses.Add(Class,Size);
+	//
+	// Before Begin Play, Auto Initialize or the first Spawn request populates every Template Class at once.
+	if (!HasBegunPlay()) {return;}
+	if (Buckets.Num()==0) {InitializeObjectPool(); return;}
+	//
+	FindOrAddBucket(Class.Get());
+	PopulateTemplateClass(Class.Get(),Size);
+	//
+	if (UPoolPrewarmSubsystem::Find(this)==nullptr) {FlushObjectPool();}
 }
 
 void USharedObjectPool::FlushObjectPool() {
-	if (!Pool.IsValidIndex(0)) {return;}
+	for (auto &Bucket : Buckets) {Bucket.Value->Compact();}
+}
+
+void USharedObjectPool::TrimObjectPool() {
+	const FPoolGrowthPolicy Policy = GetPoolGrowthPolicy();
 	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {Pool.RemoveAt(ID,1,false);}
+	for (auto &Bucket : Buckets) {
+		const int32* Size = TemplateClasses.Find(const_cast<UClass*>(Bucket.Key));
+		Bucket.Value->Trim(Size ? FMath::Max(0,*Size) : 0,Policy);
 	}///
 }
 
 void USharedObjectPool::EmptyObjectPool(const UClass* Class) {
-	if (!Pool.IsValidIndex(0)) {return;}
+	if (UPoolPrewarmSubsystem* Prewarm = UPoolPrewarmSubsystem::Find(this)) {Prewarm->Cancel(this,Class);}
 	//
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsA(Class)) {continue;}
-		if (Pool[ID]->IsValidLowLevelFast()) {Pool[ID]->Destroy(true,true);}
-	}///
+	VisitBuckets(Buckets,Class,[Class](TPoolCore<APooledActor> &Bucket, const UClass*){Bucket.EmptyClass(Class);});
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const TArray<APooledActor*> &USharedObjectPool::GetObjectArray() const {
+	Members.Reset(GetNumMembers());
+	for (const auto &Bucket : Buckets) {Members.Append(Bucket.Value->GetMembers());}
+	//
+	return Members;
+}
+
+FPoolStats USharedObjectPool::GetPoolStats() const {
+	FPoolStats Total;
+	for (const auto &Bucket : Buckets) {
+		const FPoolStats &Stats = Bucket.Value->GetStats();
+		Total.Spawns += Stats.Spawns;
+		Total.Returns += Stats.Returns;
+		Total.Instantiated += Stats.Instantiated;
+		Total.Recycled += Stats.Recycled;
+		Total.Failures += Stats.Failures;
+		Total.Grown += Stats.Grown;
+		Total.Trimmed += Stats.Trimmed;
+	} Total.PeakActive = PeakActive;
+	//
+	return Total;
+}
+
+int32 USharedObjectPool::GetNumMembers() const {
+	int32 Count = 0;
+	for (const auto &Bucket : Buckets) {Count += Bucket.Value->NumAlive();}
+	//
+	return Count;
+}
+
+int32 USharedObjectPool::GetNumSpawned() const {
+	int32 Count = 0;
+	for (const auto &Bucket : Buckets) {Count += Bucket.Value->NumActive();}
+	//
+	return Count;
+}
+
+int32 USharedObjectPool::GetNumInactive() const {
+	int32 Count = 0;
+	for (const auto &Bucket : Buckets) {Count += Bucket.Value->NumFree();}
+	//
+	return Count;
+}
+
+void USharedObjectPool::FillSpawnedObjects(const UClass* Class, TArray<APooledActor*> &Spawned) const {
+	Spawned.Reset();
+	VisitBuckets(Buckets,Class,[&Spawned](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.Gather<APooledActor>(&Spawned,nullptr,Filter);});
+}
+
+void USharedObjectPool::FillInactiveObjects(const UClass* Class, TArray<APooledActor*> &Inactive) const {
+	Inactive.Reset();
+	VisitBuckets(Buckets,Class,[&Inactive](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.Gather<APooledActor>(nullptr,&Inactive,Filter);});
+}
+
 void USharedObjectPool::GetObjectsFromPool(const UClass* Class, TArray<APooledActor*> &Spawned, TArray<APooledActor*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-		if (!OBJ->IsA(Class)) {continue;}
-		//
-		if (OBJ->Spawned) {Spawned.Add(OBJ);} else {Inactive.Add(OBJ);}
-	}///
+	VisitBuckets(Buckets,Class,[&Spawned,&Inactive](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.Gather<APooledActor>(&Spawned,&Inactive,Filter);});
 }
 
 void USharedObjectPool::GetSpawnedObjects(const UClass* Class, TArray<APooledActor*> &Spawned) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-		if (!OBJ->IsA(Class)) {continue;}
-		//
-		if (OBJ->Spawned) {Spawned.Add(OBJ);}
-	}///
+	VisitBuckets(Buckets,Class,[&Spawned](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.Gather<APooledActor>(&Spawned,nullptr,Filter);});
 }
 
 void USharedObjectPool::GetInactiveObjects(const UClass* Class, TArray<APooledActor*> &Inactive) {
-	for (const auto &OBJ : Pool) {
-		if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-		if (!OBJ->IsA(Class)) {continue;}
-		//
-		if (!OBJ->Spawned) {Inactive.Add(OBJ);}
-	}///
+	VisitBuckets(Buckets,Class,[&Inactive](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.Gather<APooledActor>(nullptr,&Inactive,Filter);});
 }
 
 APooledActor* USharedObjectPool::GetSpawnedObject(const UClass* Class) const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-		if (!Pool[ID]->IsA(Class)) {continue;}
-		//
-		if (Pool[ID]->Spawned) {return Pool[ID];}
-	}///
+	APooledActor* Found = nullptr;
+	VisitBuckets(Buckets,Class,[&Found](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){if (Found==nullptr) {Found=Bucket.GetSpawned(Filter);}});
 	//
-	return nullptr;
+	return Found;
 }
 
 APooledActor* USharedObjectPool::GetInactiveObject(const UClass* Class) const {
-	for (int32 ID = Pool.Num()-1; ID>=0; --ID) {
-		if (!Pool[ID]->IsValidLowLevelFast()||Pool[ID]->IsPendingKill()) {continue;}
-		if (!Pool[ID]->IsA(Class)) {continue;}
-		//
-		if (!Pool[ID]->Spawned) {return Pool[ID];}
-	}///
+	APooledActor* Found = nullptr;
+	VisitBuckets(Buckets,Class,[&Found](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){if (Found==nullptr) {Found=Bucket.GetInactive(Filter);}});
 	//
-	return nullptr;
+	return Found;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 APooledActor* USharedObjectPool::BeginDeferredSpawnFromPool(const UObject* WorldContextObject, USharedObjectPool* SharedPool, UClass* Class, const FPoolSpawnOptions &SpawnOptions, const FTransform &SpawnTransform, ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, AActor* Owner, const bool Reconstruct, bool &SpawnSuccessful) {
-	const auto &Settings = GetMutableDefault<UPoolSettings>();
-	//
 	if (!SharedPool->IsValidLowLevelFast()||SharedPool->IsPendingKill()||SharedPool->GetOwner()==nullptr) {
 		UE_LOG(LogTemp,Warning,TEXT("{Pool}:: %s"),TEXT("Target Shared-Pool is about to be destroyed. Spawn aborted!"));	
 	return nullptr;}
@@ -667,85 +677,85 @@ APooledActor* USharedObjectPool::BeginDeferredSpawnFromPool(const UObject* World
 		UE_LOG(LogTemp,Warning,TEXT("{Begin Deferred Spawn from Pool}: Invalid Class."));
 	return nullptr;}
 	//
-	bool IsTemplate = false;
-	TArray<TSubclassOf<APooledActor>>Classes;
-	SharedPool->TemplateClasses.GenerateKeyArray(Classes);
-	//
-	for (const TSubclassOf<APooledActor>TemplateClass : Classes) {
-		if (Class==nullptr) {break;}
-		if (TemplateClass.Get()==nullptr) {continue;}
-		if (!Class->GetName().Equals(TemplateClass.Get()->GetName())) {continue;}
-		//
-		IsTemplate = true;
-		if (SharedPool->TemplateClasses.FindChecked(TemplateClass)<=0) {
-			UE_LOG(LogTemp,Warning,TEXT("{%s}:: %s (%s)"),*SharedPool->GetName(),TEXT("Target Class is zero-sized in Target Shared-Pool!"),*Class->GetName());
-		break;}
-	} if (!IsTemplate) {
+	const int32* Size = SharedPool->TemplateClasses.Find(Class);
+	if (Size==nullptr) {
 		UE_LOG(LogTemp,Warning,TEXT("{%s}:: %s (%s)"),*SharedPool->GetName(),TEXT("This Shared-Pool does NOT implement Target Template Class. Spawn Aborted:"),*Class->GetName());
-	return nullptr;}
+	return nullptr;} if (*Size<=0) {
+		UE_LOG(LogTemp,Warning,TEXT("{%s}:: %s (%s)"),*SharedPool->GetName(),TEXT("Target Class is zero-sized in Target Shared-Pool!"),*Class->GetName());
+	}///
 	//
 	//
-	if (SharedPool->Pool.Num()==0) {SharedPool->InitializeObjectPool();}
-	APooledActor* DeferredSpawn = SharedPool->GetInactiveObject(Class);
+	if ((SharedPool->Buckets.Num()==0)&&(!UPoolPrewarmSubsystem::IsPrewarming(SharedPool))) {SharedPool->InitializeObjectPool();}
+	TPoolCore<APooledActor>* Bucket = &SharedPool->FindOrAddBucket(Class);
 	//
-	if ((DeferredSpawn==nullptr) && Settings->InstantiateOnDemand) {
-		DeferredSpawn = SharedPool->GetWorld()->SpawnActorDeferred<APooledActor>(Class,SpawnTransform,Owner,SharedPool->GetOwner()->GetInstigator(),CollisionHandlingOverride);
-		if (DeferredSpawn) {DeferredSpawn->SharedPool = SharedPool; DeferredSpawn->OwningPool = nullptr; DeferredSpawn->FinishSpawning(SpawnTransform);}
-	} else if (DeferredSpawn==nullptr && Settings->NeverFailDeferredSpawn) {
-		DeferredSpawn = SharedPool->GetSpawnedObject(Class);
-		if (DeferredSpawn!=nullptr) {DeferredSpawn->ReturnToPool();}
-	} SharedPool->FlushObjectPool();
+	if (Bucket->NumFree()==0) {UPoolPrewarmSubsystem::PrewarmOnDemand(SharedPool,Class);}
 	//
-	if (DeferredSpawn!=nullptr) {
-		const APawn* Instigator = Cast<APawn>(WorldContextObject);
-		if (Instigator==nullptr) { if (const AActor* ContextActor = Cast<AActor>(WorldContextObject)) {Instigator = ContextActor->GetInstigator();} }
-		if (Instigator!=nullptr) {DeferredSpawn->SetInstigator(const_cast<APawn*>(Instigator));}
-		if (Owner==nullptr) {DeferredSpawn->SetOwner(SharedPool->GetOwner());}
-		//
-		DeferredSpawn->SharedPool = SharedPool;
-		DeferredSpawn->OwningPool = nullptr;
-		DeferredSpawn->Initialize();
-		//
-		DeferredSpawn->SpawnFromPool(Reconstruct,SpawnOptions,SpawnTransform);
-		SpawnSuccessful = DeferredSpawn->Spawned;
-	} else {
-		SpawnSuccessful = false;
-		DeferredSpawn = SharedPool->GetSpawnedObject(Class);
-	}///
+	APooledActor* DeferredSpawn = Bucket->BeginDeferredSpawn(
+		WorldContextObject,SharedPool->GetWorld(),Class,nullptr,GetPoolGrowthPolicy(),SharedPool->GetOwner(),Owner,
+		SpawnOptions,SpawnTransform,CollisionHandlingOverride,Reconstruct,[SharedPool](APooledActor* ACT){ACT->SharedPool=SharedPool; ACT->OwningPool=nullptr;},SpawnSuccessful
+	);
 	//
+	SharedPool->TrackPeakActive();
 	return DeferredSpawn;
 }
 
 APooledActor* USharedObjectPool::FinishDeferredSpawnFromPool(APooledActor* Actor, const bool Reconstruct, const FTransform &SpawnTransform) {
-	if (Actor->IsValidLowLevelFast()&&(!Actor->IsPendingKill())&&(!Actor->IsActorInitialized())) {
-		Actor->FinishSpawning(SpawnTransform);
-	} if (Actor->IsValidLowLevelFast()&&(!Actor->IsPendingKill())) {
-		Actor->FinishSpawnFromPool(Reconstruct,SpawnTransform);
-	} return Actor;
+	return TPoolCore<APooledActor>::FinishDeferredSpawn(Actor,Reconstruct,SpawnTransform);
+}
+
+int32 USharedObjectPool::SpawnManyFromPool(const UObject* WorldContextObject, USharedObjectPool* SharedPool, UClass* Class, const FPoolSpawnOptions &SpawnOptions, const TArray<FTransform> &SpawnTransforms, const int32 Count, AActor* Owner, const bool Reconstruct, TArray<APooledActor*> &Spawned) {
+	if (!SharedPool->IsValidLowLevelFast()||SharedPool->IsPendingKill()||SharedPool->GetOwner()==nullptr||Class==nullptr) {return 0;}
+	//
+	const int32* Size = SharedPool->TemplateClasses.Find(Class);
+	if ((Size==nullptr)||(*Size<=0)) {
+		UE_LOG(LogTemp,Warning,TEXT("{%s}:: %s (%s)"),*SharedPool->GetName(),TEXT("This Shared-Pool does NOT implement Target Template Class. Spawn Aborted:"),*Class->GetName());
+	return 0;}
+	//
+	if ((SharedPool->Buckets.Num()==0)&&(!UPoolPrewarmSubsystem::IsPrewarming(SharedPool))) {SharedPool->InitializeObjectPool();}
+	TPoolCore<APooledActor>* Bucket = &SharedPool->FindOrAddBucket(Class);
+	//
+	if (Bucket->NumFree()<Count) {UPoolPrewarmSubsystem::PrewarmOnDemand(SharedPool,Class);}
+	//
+	const int32 Done = Bucket->SpawnMany(
+		WorldContextObject,SharedPool->GetWorld(),Class,nullptr,GetPoolGrowthPolicy(),SharedPool->GetOwner(),Owner,SpawnOptions,SpawnTransforms,Count,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn,Reconstruct,[SharedPool](APooledActor* ACT){ACT->SharedPool=SharedPool; ACT->OwningPool=nullptr;},Spawned
+	);
+	//
+	SharedPool->TrackPeakActive();
+	return Done;
 }
 
 void USharedObjectPool::ReturnActor(APooledActor* PooledActor) {
 	if (!GetOwner()->IsValidLowLevelFast()||this->IsPendingKill()) {PooledActor->Destroy(true,true); return;}
 	if (!PooledActor->IsValidLowLevelFast()||PooledActor->IsPendingKill()) {PooledActor->Destroy(true,true); return;}
 	//
-	TArray<TSubclassOf<APooledActor>>Classes;
-	TemplateClasses.GenerateKeyArray(Classes);
+	TPoolCore<APooledActor>* Bucket = FindBucket(PooledActor->GetClass());
+	if (Bucket==nullptr) {return;}
 	//
-	for (const TSubclassOf<APooledActor>Class : Classes) {
-		if (Class.Get()==nullptr) {continue;}
-		//
-		if (PooledActor->GetClass()->IsChildOf(Class->GetDefaultObject()->GetClass())) {
-			if (!Pool.Contains(PooledActor)) {
-				PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
-				Pool.Add(PooledActor);
-			}///
-		}///
-	}///
+	if (Bucket->Release(PooledActor)) {return;}
+	//
+	PooledActor->SetActorLocation(GetOwner()->GetActorLocation());
+	Bucket->Add(PooledActor);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+FPoolGrowthPolicy GetPoolGrowthPolicy() {
+	const auto &Settings = GetDefault<UPoolSettings>();
+	//
+	FPoolGrowthPolicy Policy;
+	Policy.InstantiateOnDemand = Settings->InstantiateOnDemand;
+	Policy.NeverFailDeferredSpawn = Settings->NeverFailDeferredSpawn;
+	//
+	Policy.AdaptiveSizing = Settings->AdaptiveSizing;
+	Policy.GrowthChunk = FMath::Max(1,Settings->GrowthChunk);
+	Policy.MaxPoolSize = FMath::Max(0,Settings->MaxPoolSize);
+	Policy.TrimCooldown = Settings->AdaptiveSizing ? FMath::Max(0.f,Settings->TrimCooldown) : 0.f;
+	//
+	return Policy;
+}
+
 void LOG_OBJ(const bool Debug,const float Duration, const FColor Color, const FString Message) {
 	if (!Debug) return; UE_LOG(LogTemp,Warning,TEXT("{Pool}:: %s"),*Message); if (!GEngine) {return;}
 	GEngine->AddOnScreenDebugMessage(-1,Duration,Color,FString::Printf(TEXT("{Pool}:: %s"),*Message));
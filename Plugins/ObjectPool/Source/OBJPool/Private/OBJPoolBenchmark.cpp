@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OBJPool.h"
+#include "OBJPool_Shared.h"
+#include "PoolPrewarm.h"
+
+#include "HAL/IConsoleManager.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Object-Pool Microbenchmark:: 'OBJPool.Benchmark [Count]'
+
+/// Fills a transient Object-Pool with 'Count' instances, then spawns every member and returns every member,
+/// logging the average cost per call for each tenth of the run; a flat curve means O(1) Spawn and Return.
+/// The whole population is instantiated before the timed runs, even if the project prewarms Pools over time.
+
+static void OBJPool_Benchmark(const TArray<FString> &Args, UWorld* World) {
+	if (World==nullptr) {return;}
+	//
+	const int32 Count = Args.IsValidIndex(0) ? FMath::Max(1,FCString::Atoi(*Args[0])) : 10000;
+	const int32 Step = FMath::Max(1,Count/10);
+	//
+	FActorSpawnParameters Params; Params.ObjectFlags |= RF_Transient;
+	AActor* Host = World->SpawnActor<AActor>(AActor::StaticClass(),FTransform::Identity,Params);
+	if (Host==nullptr) {return;}
+	//
+	UObjectPool* ObjectPool = NewObject<UObjectPool>(Host);
+	ObjectPool->AutoInitialize = false;
+	ObjectPool->RegisterComponent();
+	//
+	double Time = FPlatformTime::Seconds();
+	ObjectPool->InitializeObjectPoolWithNewTemplateClass(APooledActor::StaticClass(),Count);
+	//
+	// With Time-Sliced Prewarm, the population is still queued: timed Spawns would instantiate it on demand instead of measuring the Free-List.
+	UPoolPrewarmSubsystem::CompletePrewarm(ObjectPool);
+	UE_LOG(LogTemp,Display,TEXT("{Pool}:: Benchmark: initialized %i instances in %.2f ms."),Count,(FPlatformTime::Seconds()-Time)*1000.0);
+	//
+	TArray<APooledActor*> Spawned; Spawned.Reserve(Count);
+	const FTransform Transform = FTransform::Identity;
+	const FPoolSpawnOptions Options = FPoolSpawnOptions();
+	//
+	Time = FPlatformTime::Seconds();
+	for (int32 I=0; I<Count; ++I) {
+		bool SpawnSuccessful = false;
+		APooledActor* Actor = UObjectPool::BeginDeferredSpawnFromPool(Host,ObjectPool,APooledActor::StaticClass(),Options,Transform,ESpawnActorCollisionHandlingMethod::AlwaysSpawn,Host,false,SpawnSuccessful);
+		if (SpawnSuccessful) {Spawned.Add(UObjectPool::FinishDeferredSpawnFromPool(Actor,false,Transform));}
+		//
+		if (((I+1)%Step)==0) {
+			const double Now = FPlatformTime::Seconds();
+			UE_LOG(LogTemp,Display,TEXT("{Pool}:: Benchmark: spawn  %6i / %i :: %.3f us per call."),I+1,Count,((Now-Time)*1000000.0)/Step);
+		Time = Now;}
+	}///
+	//
+	Time = FPlatformTime::Seconds();
+	for (int32 I=0; I<Spawned.Num(); ++I) {
+		Spawned[I]->ReturnToPool();
+		//
+		if (((I+1)%Step)==0) {
+			const double Now = FPlatformTime::Seconds();
+			UE_LOG(LogTemp,Display,TEXT("{Pool}:: Benchmark: return %6i / %i :: %.3f us per call."),I+1,Spawned.Num(),((Now-Time)*1000000.0)/Step);
+		Time = Now;}
+	}///
+	//
+	Host->Destroy();
+}
+
+static FAutoConsoleCommandWithWorldAndArgs OBJPoolBenchmarkCommand(
+	TEXT("OBJPool.Benchmark"),
+	TEXT("Spawns and returns [Count] (default 10000) actors through a transient Object-Pool, logging the cost curve."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&OBJPool_Benchmark)
+);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
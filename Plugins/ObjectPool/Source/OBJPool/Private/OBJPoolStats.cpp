@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OBJPoolStats.h"
+
+#include "OBJPool.h"
+#include "OBJPool_Shared.h"
+
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectHash.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DEFINE_STAT(STAT_OBJPool_Spawn);
+DEFINE_STAT(STAT_OBJPool_Grow);
+DEFINE_STAT(STAT_OBJPool_Trim);
+DEFINE_STAT(STAT_OBJPool_LifeSpan);
+
+DEFINE_STAT(STAT_OBJPool_Spawns);
+DEFINE_STAT(STAT_OBJPool_Returns);
+DEFINE_STAT(STAT_OBJPool_Instantiated);
+DEFINE_STAT(STAT_OBJPool_Grown);
+DEFINE_STAT(STAT_OBJPool_Trimmed);
+DEFINE_STAT(STAT_OBJPool_Recycled);
+DEFINE_STAT(STAT_OBJPool_Failures);
+
+DEFINE_STAT(STAT_OBJPool_Pools);
+DEFINE_STAT(STAT_OBJPool_Members);
+DEFINE_STAT(STAT_OBJPool_Active);
+DEFINE_STAT(STAT_OBJPool_Inactive);
+
+CSV_DEFINE_CATEGORY_MODULE(OBJPOOL_API,OBJPool,true);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Reports
+
+template<typename TComponent>
+static void DescribeTemplate(const TComponent* Component, FPoolReport &Report) {
+	Report.Template = GetNameSafe(Component->TemplateClass.Get());
+	Report.PoolSize = Component->PoolSize;
+}
+
+static void DescribeTemplate(const USharedObjectPool* Component, FPoolReport &Report) {
+	TArray<FString> Names;
+	for (const auto &Template : Component->TemplateClasses) {
+		if (Template.Key.Get()==nullptr) {continue;}
+		//
+		Names.Add(Template.Key->GetName());
+		Report.PoolSize += Template.Value;
+	} Report.Template = FString::Join(Names,TEXT("|"));
+}
+
+template<typename TComponent>
+static void DescribeCore(const TComponent* Component, FPoolReport &Report) {
+	const auto &Core = Component->GetPoolCore();
+	//
+	Report.Members = Core.NumAlive();
+	Report.Active = Core.NumActive();
+	Report.Inactive = Core.NumFree();
+	Report.Stats = Core.GetStats();
+}
+
+static void DescribeCore(const USharedObjectPool* Component, FPoolReport &Report) {
+	Report.Members = Component->GetNumMembers();
+	Report.Active = Component->GetNumSpawned();
+	Report.Inactive = Component->GetNumInactive();
+	Report.Stats = Component->GetPoolStats();
+}
+
+template<typename TComponent>
+static void GatherReports(const UWorld* World, TArray<FPoolReport> &Reports) {
+	ForEachObjectOfClass(TComponent::StaticClass(),[World,&Reports](UObject* OBJ) {
+		const TComponent* Component = static_cast<const TComponent*>(OBJ);
+		if (Component->IsTemplate()||Component->IsPendingKill()) {return;}
+		//
+		const UWorld* PoolWorld = Component->GetWorld();
+		if ((PoolWorld==nullptr)||(!PoolWorld->IsGameWorld())) {return;}
+		if ((World!=nullptr)&&(PoolWorld!=World)) {return;}
+		//
+		FPoolReport &Report = Reports.AddDefaulted_GetRef();
+		//
+		Report.Pool = Component->GetName();
+		Report.Owner = GetNameSafe(Component->GetOwner());
+		DescribeTemplate(Component,Report);
+		DescribeCore(Component,Report);
+	});
+}
+
+void GatherPoolReports(const UWorld* World, TArray<FPoolReport> &Reports) {
+	GatherReports<UObjectPool>(World,Reports);
+	GatherReports<UPawnPool>(World,Reports);
+	GatherReports<UCharacterPool>(World,Reports);
+	GatherReports<USharedObjectPool>(World,Reports);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Telemetry
+
+bool TickPoolTelemetry(float DeltaTime) {
+  #if STATS || CSV_PROFILER
+	bool Collecting = false;
+   #if STATS
+	Collecting |= FThreadStats::IsCollectingData();
+   #endif
+   #if CSV_PROFILER
+	Collecting |= FCsvProfiler::Get()->IsCapturing();
+   #endif
+	if (!Collecting) {return true;}
+	//
+	TArray<FPoolReport> Reports;
+	GatherPoolReports(nullptr,Reports);
+	//
+	FPoolReport Total;
+	for (const FPoolReport &Report : Reports) {
+		Total.Members += Report.Members;
+		Total.Active += Report.Active;
+		Total.Inactive += Report.Inactive;
+		Total.Stats.Failures += Report.Stats.Failures;
+		Total.Stats.Recycled += Report.Stats.Recycled;
+		Total.Stats.Grown += Report.Stats.Grown;
+		Total.Stats.Trimmed += Report.Stats.Trimmed;
+	}///
+	//
+	SET_DWORD_STAT(STAT_OBJPool_Pools,Reports.Num());
+	SET_DWORD_STAT(STAT_OBJPool_Members,Total.Members);
+	SET_DWORD_STAT(STAT_OBJPool_Active,Total.Active);
+	SET_DWORD_STAT(STAT_OBJPool_Inactive,Total.Inactive);
+	//
+	CSV_CUSTOM_STAT(OBJPool,Members,Total.Members,ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OBJPool,Active,Total.Active,ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OBJPool,Inactive,Total.Inactive,ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OBJPool,Failures,Total.Stats.Failures,ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OBJPool,Recycled,Total.Stats.Recycled,ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OBJPool,Grown,Total.Stats.Grown,ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OBJPool,Trimmed,Total.Stats.Trimmed,ECsvCustomStatOp::Set);
+  #endif
+	//
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Telemetry:: 'OBJPool.DumpStats [File]'
+
+/// Writes one CSV row per Pool Component of the current World; the numbers to size 'Pool Size' and 'Growth Chunk' from.
+/// Without a File argument, the dump goes to '[Project]/Saved/Profiling/OBJPool/'.
+
+static void OBJPool_DumpStats(const TArray<FString> &Args, UWorld* World) {
+	TArray<FPoolReport> Reports;
+	GatherPoolReports(World,Reports);
+	//
+	FString CSV = TEXT("Pool,Owner,Template,PoolSize,Members,Active,Inactive,PeakActive,Spawns,Returns,Instantiated,Grown,Trimmed,Recycled,Failures\n");
+	for (const FPoolReport &Report : Reports) {
+		const FPoolStats &Stats = Report.Stats;
+		CSV += FString::Printf(TEXT("%s,%s,%s,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i\n"),
+			*Report.Pool,*Report.Owner,*Report.Template,Report.PoolSize,Report.Members,Report.Active,Report.Inactive,
+			Stats.PeakActive,Stats.Spawns,Stats.Returns,Stats.Instantiated,Stats.Grown,Stats.Trimmed,Stats.Recycled,Stats.Failures
+		);
+	}///
+	//
+	const FString File = Args.IsValidIndex(0) ? Args[0] : FPaths::Combine(FPaths::ProfilingDir(),TEXT("OBJPool"),FString::Printf(TEXT("OBJPool-%s.csv"),*FDateTime::Now().ToString()));
+	//
+	if (FFileHelper::SaveStringToFile(CSV,*File)) {
+		UE_LOG(LogTemp,Display,TEXT("{Pool}:: Stats of %i Pools dumped to: %s"),Reports.Num(),*FPaths::ConvertRelativePathToFull(File));
+	} else {UE_LOG(LogTemp,Warning,TEXT("{Pool}:: Couldn't write Pool stats to: %s"),*File);}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs OBJPoolDumpStatsCommand(
+	TEXT("OBJPool.DumpStats"),
+	TEXT("Dumps usage stats of every Pool Component in the current World to a CSV [File]."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&OBJPool_DumpStats)
+);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,441 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OBJPool.h"
+#include "OBJPool_Shared.h"
+
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Object-Pool Stress Suite:: Automation Test 'OBJPool.Stress'
+
+/// Runs every stress scenario against transient Pools of a transient World; each scenario fails the test if its check or the Free-List invariants break.
+/// Spawn churn runs at 1000, 10000 and 50000 members; the policy scenarios run at 1000.
+/// p50/p99 times and memory are written as JSON to '[Project]/Saved/Profiling/OBJPool/', to track regressions.
+/// Headless runs: 'UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests OBJPool.Stress;Quit"'.
+
+/// Outcome of one scenario; times are microseconds per call, memory is bytes of physical memory taken by initialization.
+struct FPoolStressResult {
+	FString Scenario;
+	int32 Count = 0;
+	//
+	double InitMs = 0.0;
+	double SpawnP50 = 0.0;
+	double SpawnP99 = 0.0;
+	double ReturnP50 = 0.0;
+	double ReturnP99 = 0.0;
+	int64 Memory = 0;
+	//
+	int32 Spawned = 0;
+	FPoolStats Stats;
+	//
+	bool Passed = false;
+	FString Check;
+	//
+	/// First broken Free-List invariant, with the stage it was found at; empty if none broke.
+	FString Invariants;
+};
+
+/// Overrides the project's Pool Settings for the length of a scenario.
+/// Prewarm and Adaptive Sizing are always off, so Pools initialize at once and grow only as the scenario asks.
+struct FPoolStressSettings {
+	UPoolSettings* Settings;
+	//
+	bool InstantiateOnDemand;
+	bool NeverFailDeferredSpawn;
+	bool KeepOrphanActorsAlive;
+	bool TimeSlicedPrewarm;
+	bool AdaptiveSizing;
+	int32 MaxPoolSize;
+	//
+	FPoolStressSettings(const bool OnDemand, const bool NeverFail, const bool KeepOrphans) : Settings(GetMutableDefault<UPoolSettings>()) {
+		InstantiateOnDemand = Settings->InstantiateOnDemand;
+		NeverFailDeferredSpawn = Settings->NeverFailDeferredSpawn;
+		KeepOrphanActorsAlive = Settings->KeepOrphanActorsAlive;
+		TimeSlicedPrewarm = Settings->TimeSlicedPrewarm;
+		AdaptiveSizing = Settings->AdaptiveSizing;
+		MaxPoolSize = Settings->MaxPoolSize;
+		//
+		Settings->InstantiateOnDemand = OnDemand;
+		Settings->NeverFailDeferredSpawn = NeverFail;
+		Settings->KeepOrphanActorsAlive = KeepOrphans;
+		Settings->TimeSlicedPrewarm = false;
+		Settings->AdaptiveSizing = false;
+		Settings->MaxPoolSize = 0;
+	}
+	//
+	~FPoolStressSettings() {
+		Settings->InstantiateOnDemand = InstantiateOnDemand;
+		Settings->NeverFailDeferredSpawn = NeverFailDeferredSpawn;
+		Settings->KeepOrphanActorsAlive = KeepOrphanActorsAlive;
+		Settings->TimeSlicedPrewarm = TimeSlicedPrewarm;
+		Settings->AdaptiveSizing = AdaptiveSizing;
+		Settings->MaxPoolSize = MaxPoolSize;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void StressPercentiles(TArray<double> &Samples, double &P50, double &P99) {
+	if (Samples.Num()==0) {P50=0.0; P99=0.0; return;}
+	//
+	Samples.Sort();
+	P50 = Samples[FMath::Clamp(FMath::CeilToInt(0.50f*Samples.Num())-1,0,Samples.Num()-1)];
+	P99 = Samples[FMath::Clamp(FMath::CeilToInt(0.99f*Samples.Num())-1,0,Samples.Num()-1)];
+}
+
+static int64 StressUsedMemory() {
+	return (int64)FPlatformMemory::GetStats().UsedPhysical;
+}
+
+static AActor* StressHost(UWorld* World) {
+	FActorSpawnParameters Params; Params.ObjectFlags |= RF_Transient;
+	return World->SpawnActor<AActor>(AActor::StaticClass(),FTransform::Identity,Params);
+}
+
+template<typename TPool>
+static TPool* StressPool(AActor* Host) {
+	TPool* Pool = NewObject<TPool>(Host);
+	Pool->AutoInitialize = false;
+	Pool->RegisterComponent();
+	//
+	return Pool;
+}
+
+/// Records the first broken Free-List invariant of Pool on Result.
+template<typename TActor>
+static void StressValidate(const TPoolCore<TActor> &Pool, const TCHAR* Stage, FPoolStressResult &Result) {
+	FString Error;
+	if (Result.Invariants.IsEmpty()&&!Pool.Validate(Error)) {Result.Invariants = FString::Printf(TEXT("%s: %s"),Stage,*Error);}
+}
+
+/// Times Count calls to Spawn, one sample per call; successful Spawns are counted on Result.
+template<typename FSpawn>
+static void StressSpawn(const int32 Count, FPoolStressResult &Result, FSpawn &&Spawn) {
+	TArray<double> Samples; Samples.Reserve(Count);
+	//
+	for (int32 I=0; I<Count; ++I) {
+		const double Start = FPlatformTime::Seconds();
+		APooledActor* Actor = Spawn(I);
+		Samples.Add((FPlatformTime::Seconds()-Start)*1000000.0);
+		//
+		if (Actor!=nullptr) {Result.Spawned++;}
+	}///
+	//
+	StressPercentiles(Samples,Result.SpawnP50,Result.SpawnP99);
+}
+
+/// Times the Return of every member currently Spawned by the Pool, one sample per call.
+template<typename TPool>
+static void StressReturn(TPool* Pool, FPoolStressResult &Result) {
+	TArray<APooledActor*> Spawned;
+	Pool->ForEachSpawned([&Spawned](APooledActor* Actor){Spawned.Add(Actor);});
+	//
+	TArray<double> Samples; Samples.Reserve(Spawned.Num());
+	for (APooledActor* Actor : Spawned) {
+		const double Start = FPlatformTime::Seconds();
+		Actor->ReturnToPool();
+		Samples.Add((FPlatformTime::Seconds()-Start)*1000000.0);
+	}///
+	//
+	StressPercentiles(Samples,Result.ReturnP50,Result.ReturnP99);
+}
+
+static APooledActor* StressSpawnFrom(AActor* Host, UObjectPool* Pool) {
+	bool SpawnSuccessful = false;
+	APooledActor* Actor = UObjectPool::BeginDeferredSpawnFromPool(Host,Pool,Pool->TemplateClass,FPoolSpawnOptions(),FTransform::Identity,ESpawnActorCollisionHandlingMethod::AlwaysSpawn,Host,false,SpawnSuccessful);
+	return SpawnSuccessful ? UObjectPool::FinishDeferredSpawnFromPool(Actor,false,FTransform::Identity) : nullptr;
+}
+
+static APooledActor* StressSpawnFrom(AActor* Host, USharedObjectPool* Pool, UClass* Class) {
+	bool SpawnSuccessful = false;
+	APooledActor* Actor = USharedObjectPool::BeginDeferredSpawnFromPool(Host,Pool,Class,FPoolSpawnOptions(),FTransform::Identity,ESpawnActorCollisionHandlingMethod::AlwaysSpawn,Host,false,SpawnSuccessful);
+	return SpawnSuccessful ? USharedObjectPool::FinishDeferredSpawnFromPool(Actor,false,FTransform::Identity) : nullptr;
+}
+
+/// Initializes a transient Object-Pool of Size members, recording the time and memory taken.
+static UObjectPool* StressObjectPool(AActor* Host, const int32 Size, FPoolStressResult &Result) {
+	UObjectPool* Pool = StressPool<UObjectPool>(Host);
+	//
+	const int64 Memory = StressUsedMemory();
+	const double Start = FPlatformTime::Seconds();
+	Pool->InitializeObjectPoolWithNewTemplateClass(APooledActor::StaticClass(),Size);
+	//
+	Result.InitMs = (FPlatformTime::Seconds()-Start)*1000.0;
+	Result.Memory = StressUsedMemory()-Memory;
+	//
+	return Pool;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Fills a Pool of Count members, Spawns all of them, then Returns all of them.
+static FPoolStressResult Stress_Churn(UWorld* World, const int32 Count) {
+	FPoolStressResult Result; Result.Scenario = TEXT("Churn"); Result.Count = Count;
+	FPoolStressSettings Settings(false,false,false);
+	//
+	AActor* Host = StressHost(World); if (Host==nullptr) {return Result;}
+	UObjectPool* Pool = StressObjectPool(Host,Count,Result);
+	//
+	StressValidate(Pool->GetPoolCore(),TEXT("init"),Result);
+	StressSpawn(Count,Result,[Host,Pool](const int32){return StressSpawnFrom(Host,Pool);});
+	StressValidate(Pool->GetPoolCore(),TEXT("spawn"),Result);
+	StressReturn(Pool,Result);
+	StressValidate(Pool->GetPoolCore(),TEXT("return"),Result);
+	//
+	Result.Stats = Pool->GetPoolCore().GetStats();
+	Result.Passed = (Result.Spawned==Count) && (Pool->GetNumSpawned()==0) && (Pool->GetNumInactive()==Count);
+	Result.Check = TEXT("every member spawned once and returned");
+	//
+	Host->Destroy();
+	return Result;
+}
+
+/// Up to 8 loaded Pooled Actor classes to use as Shared-Pool Templates.
+/// Blueprint Pooled Actors take part once loaded; without any, only the native class is found.
+static void StressTemplateClasses(TArray<UClass*> &Classes) {
+	for (TObjectIterator<UClass> Class; Class; ++Class) {
+		if (!Class->IsChildOf(APooledActor::StaticClass())) {continue;}
+		if (Class->HasAnyClassFlags(CLASS_Abstract|CLASS_Deprecated|CLASS_NewerVersionExists)) {continue;}
+		if (Class->GetName().StartsWith(TEXT("SKEL_"))||Class->GetName().StartsWith(TEXT("REINST_"))) {continue;}
+		//
+		Classes.Add(*Class);
+	if (Classes.Num()>=8) {break;}}
+}
+
+/// A Shared-Pool holding every loaded Pooled Actor class as a Template, Spawning them round-robin.
+static FPoolStressResult Stress_Shared(UWorld* World, const int32 Count) {
+	FPoolStressResult Result; Result.Scenario = TEXT("SharedTemplates"); Result.Count = Count;
+	FPoolStressSettings Settings(false,false,false);
+	//
+	TArray<UClass*> Classes;
+	StressTemplateClasses(Classes); if (Classes.Num()==0) {return Result;}
+	//
+	const int32 PerClass = FMath::Max(1,Count/Classes.Num());
+	//
+	AActor* Host = StressHost(World); if (Host==nullptr) {return Result;}
+	USharedObjectPool* Pool = StressPool<USharedObjectPool>(Host);
+	for (UClass* Class : Classes) {Pool->TemplateClasses.Add(Class,PerClass);}
+	//
+	const int64 Memory = StressUsedMemory();
+	const double Start = FPlatformTime::Seconds();
+	Pool->InitializeObjectPool();
+	Result.InitMs = (FPlatformTime::Seconds()-Start)*1000.0;
+	Result.Memory = StressUsedMemory()-Memory;
+	//
+	int32 Mismatches = 0;
+	StressSpawn(PerClass*Classes.Num(),Result,[Host,Pool,&Classes,&Mismatches](const int32 I){
+		UClass* Class = Classes[I%Classes.Num()];
+		APooledActor* Actor = StressSpawnFrom(Host,Pool,Class);
+		if (Actor && (Actor->GetClass()!=Class)) {Mismatches++;}
+		return Actor;
+	});
+	for (UClass* Class : Classes) { if (const TPoolCore<APooledActor>* Core = Pool->GetPoolCore(Class)) {StressValidate(*Core,TEXT("spawn"),Result);} }
+	StressReturn(Pool,Result);
+	for (UClass* Class : Classes) { if (const TPoolCore<APooledActor>* Core = Pool->GetPoolCore(Class)) {StressValidate(*Core,TEXT("return"),Result);} }
+	//
+	Result.Count = PerClass*Classes.Num();
+	Result.Stats = Pool->GetPoolStats();
+	Result.Passed = (Result.Spawned==Result.Count) && (Mismatches==0) && (Pool->GetNumSpawned()==0);
+	Result.Check = FString::Printf(TEXT("%i templates; every request served by its own class"),Classes.Num());
+	//
+	Host->Destroy();
+	return Result;
+}
+
+/// A Shared-Pool Spawning and then Returning the members of one Template Class at a time.
+/// Only one bucket is ever Spawned at once, so the Peak Active of the Pool is the members of one class, not the sum of every bucket peak.
+static FPoolStressResult Stress_SharedPeak(UWorld* World, const int32 Count) {
+	FPoolStressResult Result; Result.Scenario = TEXT("SharedPeak"); Result.Count = Count;
+	FPoolStressSettings Settings(false,false,false);
+	//
+	TArray<UClass*> Classes;
+	StressTemplateClasses(Classes); if (Classes.Num()==0) {return Result;}
+	//
+	const int32 PerClass = FMath::Max(1,Count/Classes.Num());
+	//
+	AActor* Host = StressHost(World); if (Host==nullptr) {return Result;}
+	USharedObjectPool* Pool = StressPool<USharedObjectPool>(Host);
+	for (UClass* Class : Classes) {Pool->TemplateClasses.Add(Class,PerClass);}
+	Pool->InitializeObjectPool();
+	//
+	int32 BucketPeaks = 0;
+	for (UClass* Class : Classes) {
+		StressSpawn(PerClass,Result,[Host,Pool,Class](const int32){return StressSpawnFrom(Host,Pool,Class);});
+		StressReturn(Pool,Result);
+		if (const TPoolCore<APooledActor>* Core = Pool->GetPoolCore(Class)) {BucketPeaks += Core->GetStats().PeakActive; StressValidate(*Core,TEXT("return"),Result);}
+	}///
+	//
+	Result.Count = PerClass*Classes.Num();
+	Result.Stats = Pool->GetPoolStats();
+	Result.Passed = (Result.Spawned==Result.Count) && (Result.Stats.PeakActive==PerClass) && (BucketPeaks==Result.Count);
+	Result.Check = FString::Printf(TEXT("%i templates; Peak Active %i of one class at a time, bucket peaks sum to %i"),Classes.Num(),Result.Stats.PeakActive,BucketPeaks);
+	//
+	Host->Destroy();
+	return Result;
+}
+
+/// A Pool of a single member fulfilling Count requests with 'Instantiate On Demand'; every Spawn past the first grows the Pool.
+static FPoolStressResult Stress_OnDemand(UWorld* World, const int32 Count) {
+	FPoolStressResult Result; Result.Scenario = TEXT("InstantiateOnDemand"); Result.Count = Count;
+	FPoolStressSettings Settings(true,false,false);
+	//
+	AActor* Host = StressHost(World); if (Host==nullptr) {return Result;}
+	UObjectPool* Pool = StressObjectPool(Host,1,Result);
+	//
+	const int64 Memory = StressUsedMemory();
+	StressSpawn(Count,Result,[Host,Pool](const int32){return StressSpawnFrom(Host,Pool);});
+	Result.Memory += StressUsedMemory()-Memory;
+	StressValidate(Pool->GetPoolCore(),TEXT("spawn"),Result);
+	StressReturn(Pool,Result);
+	StressValidate(Pool->GetPoolCore(),TEXT("return"),Result);
+	//
+	Result.Stats = Pool->GetPoolCore().GetStats();
+	Result.Passed = (Result.Spawned==Count) && (Pool->GetPoolCore().Num()==Count) && (Result.Stats.Failures==0);
+	Result.Check = TEXT("pool grew to one member per request, no failures");
+	//
+	Host->Destroy();
+	return Result;
+}
+
+/// A Pool a tenth of Count fulfilling Count requests with 'Never Fail Deferred Spawn'; requests past its size recycle Spawned members.
+static FPoolStressResult Stress_NeverFail(UWorld* World, const int32 Count) {
+	FPoolStressResult Result; Result.Scenario = TEXT("NeverFailDeferredSpawn"); Result.Count = Count;
+	FPoolStressSettings Settings(false,true,false);
+	//
+	const int32 Size = FMath::Max(1,Count/10);
+	//
+	AActor* Host = StressHost(World); if (Host==nullptr) {return Result;}
+	UObjectPool* Pool = StressObjectPool(Host,Size,Result);
+	//
+	StressSpawn(Count,Result,[Host,Pool](const int32){return StressSpawnFrom(Host,Pool);});
+	StressValidate(Pool->GetPoolCore(),TEXT("spawn"),Result);
+	StressReturn(Pool,Result);
+	StressValidate(Pool->GetPoolCore(),TEXT("return"),Result);
+	//
+	Result.Stats = Pool->GetPoolCore().GetStats();
+	Result.Passed = (Result.Spawned==Count) && (Result.Stats.Recycled==Count-Size) && (Pool->GetPoolCore().Num()==Size);
+	Result.Check = FString::Printf(TEXT("pool held at %i members, %i requests recycled"),Size,Count-Size);
+	//
+	Host->Destroy();
+	return Result;
+}
+
+/// Destroys a Pool with half of its members Spawned and 'Keep Orphan Actors Alive' on; Spawned members must survive it, Inactive ones must not.
+/// The Return percentiles of this scenario measure the teardown of the Pool Component, per member.
+static FPoolStressResult Stress_Orphans(UWorld* World, const int32 Count) {
+	FPoolStressResult Result; Result.Scenario = TEXT("KeepOrphanActorsAlive"); Result.Count = Count;
+	FPoolStressSettings Settings(false,false,true);
+	//
+	const int32 Half = FMath::Max(1,Count/2);
+	//
+	AActor* Host = StressHost(World); if (Host==nullptr) {return Result;}
+	UObjectPool* Pool = StressObjectPool(Host,Count,Result);
+	//
+	StressSpawn(Half,Result,[Host,Pool](const int32){return StressSpawnFrom(Host,Pool);});
+	StressValidate(Pool->GetPoolCore(),TEXT("spawn"),Result);
+	//
+	TArray<APooledActor*> Orphans, Inactive;
+	Pool->FillSpawnedObjects(Orphans);
+	Pool->FillInactiveObjects(Inactive);
+	Result.Stats = Pool->GetPoolCore().GetStats();
+	//
+	const double Start = FPlatformTime::Seconds();
+	Host->Destroy();
+	Result.ReturnP50 = Result.ReturnP99 = ((FPlatformTime::Seconds()-Start)*1000000.0)/FMath::Max(1,Count);
+	//
+	int32 Alive = 0, Leaked = 0;
+	for (APooledActor* Actor : Orphans) {
+		if (IsValid(Actor)) {Alive++; Actor->Destroy();}
+	}///
+	for (APooledActor* Actor : Inactive) {
+		if (IsValid(Actor)) {Leaked++; Actor->Destroy();}
+	}///
+	//
+	Result.Passed = (Result.Spawned==Half) && (Alive==Orphans.Num()) && (Leaked==0);
+	Result.Check = FString::Printf(TEXT("%i of %i orphans alive, %i inactive members left behind"),Alive,Orphans.Num(),Leaked);
+	//
+	return Result;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static FString StressToJSON(const TArray<FPoolStressResult> &Results) {
+	FString JSON = TEXT("{\n");
+	JSON += FString::Printf(TEXT("\t\"Engine\": \"%s\",\n"),*FEngineVersion::Current().ToString());
+	JSON += FString::Printf(TEXT("\t\"Date\": \"%s\",\n"),*FDateTime::UtcNow().ToIso8601());
+	JSON += TEXT("\t\"Scenarios\": [\n");
+	//
+	for (int32 I=0; I<Results.Num(); ++I) {
+		const FPoolStressResult &Result = Results[I];
+		const FPoolStats &Stats = Result.Stats;
+		//
+		JSON += FString::Printf(
+			TEXT("\t\t{\"Scenario\": \"%s\", \"Count\": %i, \"Passed\": %s, \"Check\": \"%s\", \"Invariants\": \"%s\", ")
+			TEXT("\"InitMs\": %.3f, \"SpawnP50Us\": %.3f, \"SpawnP99Us\": %.3f, \"ReturnP50Us\": %.3f, \"ReturnP99Us\": %.3f, \"MemoryBytes\": %lld, ")
+			TEXT("\"Spawned\": %i, \"Spawns\": %i, \"Returns\": %i, \"Instantiated\": %i, \"Grown\": %i, \"Recycled\": %i, \"Failures\": %i, \"PeakActive\": %i}%s\n"),
+			*Result.Scenario,Result.Count,Result.Passed?TEXT("true"):TEXT("false"),*Result.Check.ReplaceCharWithEscapedChar(),*Result.Invariants.ReplaceCharWithEscapedChar(),
+			Result.InitMs,Result.SpawnP50,Result.SpawnP99,Result.ReturnP50,Result.ReturnP99,Result.Memory,
+			Result.Spawned,Stats.Spawns,Stats.Returns,Stats.Instantiated,Stats.Grown,Stats.Recycled,Stats.Failures,Stats.PeakActive,
+			(I<Results.Num()-1)?TEXT(","):TEXT("")
+		);
+	}///
+	//
+	JSON += TEXT("\t]\n}\n");
+	return JSON;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOBJPoolStressTest,"OBJPool.Stress",EAutomationTestFlags::ApplicationContextMask|EAutomationTestFlags::StressFilter)
+
+bool FOBJPoolStressTest::RunTest(const FString &Parameters) {
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game,false);
+	FWorldContext &Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+	//
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+	//
+	TArray<FPoolStressResult> Results;
+	for (const int32 Count : {1000,10000,50000}) {Results.Add(Stress_Churn(World,Count));}
+	Results.Add(Stress_Shared(World,1000));
+	Results.Add(Stress_SharedPeak(World,1000));
+	Results.Add(Stress_OnDemand(World,1000));
+	Results.Add(Stress_NeverFail(World,1000));
+	Results.Add(Stress_Orphans(World,1000));
+	//
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	//
+	for (const FPoolStressResult &Result : Results) {
+		AddInfo(FString::Printf(TEXT("%-24s %6i :: spawn p50 %.3f us, p99 %.3f us :: return p50 %.3f us, p99 %.3f us :: %.1f KB"),
+			*Result.Scenario,Result.Count,Result.SpawnP50,Result.SpawnP99,Result.ReturnP50,Result.ReturnP99,Result.Memory/1024.0
+		));
+		//
+		TestTrue(FString::Printf(TEXT("%s %i: %s"),*Result.Scenario,Result.Count,*Result.Check),Result.Passed);
+		TestTrue(FString::Printf(TEXT("%s %i: Free-List invariants hold (%s)"),*Result.Scenario,Result.Count,*Result.Invariants),Result.Invariants.IsEmpty());
+	}///
+	//
+	const FString File = FPaths::Combine(FPaths::ProfilingDir(),TEXT("OBJPool"),FString::Printf(TEXT("OBJPoolStress-%s.json"),*FDateTime::Now().ToString()));
+	if (FFileHelper::SaveStringToFile(StressToJSON(Results),*File)) {
+		AddInfo(FString::Printf(TEXT("Results written to: %s"),*FPaths::ConvertRelativePathToFull(File)));
+	} else {AddWarning(FString::Printf(TEXT("Couldn't write stress results to: %s"),*File));}
+	//
+	return true;
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PoolActivation.h"
+
+#include "Runtime/Engine/Classes/GameFramework/Actor.h"
+#include "Runtime/Engine/Classes/Components/PrimitiveComponent.h"
+#include "Runtime/Engine/Classes/Particles/ParticleSystemComponent.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EPoolActivationRole FPoolActivationLayout::Sort(const UActorComponent* Component) {
+	if (Component->IsA<UParticleSystemComponent>()) {return EPoolActivationRole::Particle;}
+	//
+	if (const UPrimitiveComponent* P = Cast<UPrimitiveComponent>(Component)) {
+		if (P->BodyInstance.bSimulatePhysics||(P->GetBodySetup()!=nullptr)) {return EPoolActivationRole::Body;}
+		return EPoolActivationRole::Primitive;
+	}///
+	//
+	return EPoolActivationRole::Component;
+}
+
+EPoolActivationRole FPoolActivationLayout::GetRole(const UActorComponent* Component) {
+	if (Component->CreationMethod==EComponentCreationMethod::Instance) {return Sort(Component);}
+	//
+	if (const EPoolActivationRole* Role = Roles.Find(Component->GetFName())) {return *Role;}
+	return Roles.Add(Component->GetFName(),Sort(Component));
+}
+
+FPoolActivationLayout &FPoolActivationLayout::Get(const UClass* Class) {
+	check(IsInGameThread());
+	static TMap<TWeakObjectPtr<const UClass>,TUniquePtr<FPoolActivationLayout>> Layouts;
+	//
+	if (TUniquePtr<FPoolActivationLayout>* Layout = Layouts.Find(Class)) {return **Layout;}
+	//
+	// Blueprint recompiles and hot reloads leave layouts of classes that are gone.
+	for (auto It = Layouts.CreateIterator(); It; ++It) {
+		if (!It.Key().IsValid()) {It.RemoveCurrent();}
+	}///
+	//
+	return *Layouts.Add(Class,MakeUnique<FPoolActivationLayout>());
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FPoolActivationPlan::IsCurrent(const TSet<UActorComponent*> &Owned) const {
+	if (Resolved!=Owned.Num()) {return false;}
+	//
+	// Same count, but a planned component was destroyed: another one took its place.
+	for (const TWeakObjectPtr<UActorComponent> &C : Components) {
+		if (!C.IsValid()) {return false;}
+	} return true;
+}
+
+void FPoolActivationPlan::Resolve(const AActor* Owner) {
+	const TSet<UActorComponent*> &Owned = Owner->GetComponents();
+	if (IsCurrent(Owned)) {return;}
+	//
+	FPoolActivationLayout &Layout = FPoolActivationLayout::Get(Owner->GetClass());
+	Components.Reset(Owned.Num());
+	Particles.Reset(); Primitives.Reset(); Bodies.Reset();
+	//
+	for (UActorComponent* C : Owned) {
+		if (C==nullptr) {continue;}
+		Components.Add(C);
+		//
+		switch (Layout.GetRole(C)) {
+			case EPoolActivationRole::Particle: Particles.Add(CastChecked<UParticleSystemComponent>(C)); break;
+			case EPoolActivationRole::Body: Bodies.Add(CastChecked<UPrimitiveComponent>(C)); //fallthrough
+			case EPoolActivationRole::Primitive: Primitives.Add(CastChecked<UPrimitiveComponent>(C)); break;
+		default: break;}
+	}///
+	//
+	Resolved = Owned.Num();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FPoolActivationPlan::Deactivate(const bool ComponentTick) const {
+	for (const TWeakObjectPtr<UParticleSystemComponent> &PS : Particles) {
+		if (PS.IsValid()) {PS->DeactivateSystem();}
+	}///
+	//
+	for (const TWeakObjectPtr<UActorComponent> &C : Components) {
+		if (!C.IsValid()) {continue;}
+		//
+		C->SetActive(false);
+		if (ComponentTick) {C->SetComponentTickEnabled(false);}
+	}///
+	//
+	for (const TWeakObjectPtr<UPrimitiveComponent> &P : Bodies) {
+		if (!P.IsValid()) {continue;}
+		//
+		P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+		P->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		P->SetSimulatePhysics(false);
+	}///
+	//
+	for (const TWeakObjectPtr<UPrimitiveComponent> &P : Primitives) {
+		if (!P.IsValid()) {continue;}
+		//
+		P->SetComponentTickEnabled(false);
+		P->SetVisibility(false,true);
+	}///
+}
+
+void FPoolActivationPlan::Show(const FPoolSpawnOptions &SpawnOptions) const {
+	for (const TWeakObjectPtr<UPrimitiveComponent> &P : Primitives) {
+		if (!P.IsValid()) {continue;}
+		//
+		P->SetComponentTickEnabled(SpawnOptions.ActorTickEnabled);
+		P->SetVisibility(true,true);
+	}///
+	//
+	for (const TWeakObjectPtr<UPrimitiveComponent> &P : Bodies) {
+		if (P.IsValid()) {P->SetSimulatePhysics(SpawnOptions.SimulatePhysics);}
+	}///
+}
+
+void FPoolActivationPlan::Activate(const bool ComponentTick) const {
+	for (const TWeakObjectPtr<UParticleSystemComponent> &PS : Particles) {
+		if (PS.IsValid()) {PS->ActivateSystem(false);}
+	}///
+	//
+	for (const TWeakObjectPtr<UActorComponent> &C : Components) {
+		if (!C.IsValid()) {continue;}
+		//
+		C->SetActive(true);
+		if (ComponentTick) {C->SetComponentTickEnabled(true);}
+	}///
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
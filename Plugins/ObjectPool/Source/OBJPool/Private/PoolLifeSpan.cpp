@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PoolLifeSpan.h"
+
+#include "OBJPoolStats.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Life Span Subsystem Functions
+
+void UPoolLifeSpanSubsystem::Deinitialize() {
+	for (TArray<FEntry> &Slot : Slots) {Slot.Empty();}
+	Due.Empty();
+	//
+	Cursor = INDEX_NONE;
+	Entries = 0;
+	//
+	Super::Deinitialize();
+}
+
+void UPoolLifeSpanSubsystem::Insert(AActor* Member, const double Expiry, const uint32 Serial, FExpire Expire) {
+	// An empty wheel doesn't tick; catch up with the World before scheduling on it.
+	if ((Cursor==INDEX_NONE)||(Entries==0)) {Cursor = (int64)FMath::FloorToDouble(GetWorld()->GetTimeSeconds()/Resolution);}
+	//
+	// Due on the first wheel tick at or after Expiry; never on one that's already been expired.
+	const int64 Tick = FMath::Max(Cursor+1,(int64)FMath::CeilToDouble(Expiry/Resolution));
+	const int64 Distance = Tick-Cursor-1;
+	//
+	FEntry Entry;
+	Entry.Member = Member;
+	Entry.Expire = Expire;
+	Entry.Serial = Serial;
+	Entry.Rounds = (int32)(Distance/NumSlots);
+	//
+	Slots[Tick%NumSlots].Add(Entry);
+	Entries++;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UPoolLifeSpanSubsystem::Tick(float DeltaTime) {
+	SCOPE_CYCLE_COUNTER(STAT_OBJPool_LifeSpan);
+	//
+	const int64 Now = (int64)FMath::FloorToDouble(GetWorld()->GetTimeSeconds()/Resolution);
+	//
+	while (Cursor<Now) {
+		TArray<FEntry> &Slot = Slots[(++Cursor)%NumSlots];
+		//
+		for (int32 ID=Slot.Num()-1; ID>=0; --ID) {
+			FEntry &Entry = Slot[ID];
+			if (Entry.Rounds>0) {Entry.Rounds--; continue;}
+			//
+			Due.Add({Entry.Member,Entry.Expire,Entry.Serial});
+			Slot.RemoveAtSwap(ID,1,false);
+			Entries--;
+		}///
+		//
+		if (Entries==0) {Cursor=Now; break;}
+	}///
+	//
+	// Returns run after the wheel is settled: members may schedule new Life Spans from their Pool events.
+	for (const FDue &Expired : Due) {
+		AActor* Member = Expired.Member.Get();
+		if (Member && !Member->IsPendingKill()) {Expired.Expire(Member,Expired.Serial);}
+	} Due.Reset();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
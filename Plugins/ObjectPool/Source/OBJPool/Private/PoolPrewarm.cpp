@@ -0,0 +1,206 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PoolPrewarm.h"
+
+#include "OBJPool.h"
+#include "OBJPool_Shared.h"
+
+#include "MoviePlayer.h"
+#include "UObject/UnrealType.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Template Classes are hard references of their Pools, thus already loaded;
+/// what's left to stream in are the soft references still pending on their Class Defaults.
+static void GatherPendingSoftReferences(UClass* Class, TArray<FSoftObjectPath> &Paths) {
+	const UObject* CDO = Class->GetDefaultObject();
+	//
+	for (TFieldIterator<FSoftObjectProperty> IT(Class); IT; ++IT) {
+		for (int32 I=0; I<IT->ArrayDim; I++) {
+			const FSoftObjectPtr &Ptr = IT->GetPropertyValue_InContainer(CDO,I);
+			if (Ptr.IsPending()) {Paths.AddUnique(Ptr.ToSoftObjectPath());}
+		}///
+	}///
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Prewarm Subsystem Functions
+
+UPoolPrewarmSubsystem* UPoolPrewarmSubsystem::Find(const UObject* WorldContextObject) {
+	if (!GetDefault<UPoolSettings>()->TimeSlicedPrewarm) {return nullptr;}
+	//
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject,EGetWorldErrorMode::ReturnNull) : nullptr;
+	if ((World==nullptr)||(!World->IsGameWorld())) {return nullptr;}
+	//
+	return World->GetSubsystem<UPoolPrewarmSubsystem>();
+}
+
+void UPoolPrewarmSubsystem::Deinitialize() {
+	Jobs.Empty();
+	Preloads.Empty();
+	//
+	BatchTotal = 0;
+	BatchDone = 0;
+	//
+	Super::Deinitialize();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UPoolPrewarmSubsystem::Enqueue(UActorComponent* Pool, UClass* Class, const int32 Count, FPoolPrewarmStep &&Step, TFunction<void()> &&Finish) {
+	if ((Pool==nullptr)||(Class==nullptr)||(Count<=0)) {return;}
+	//
+	FPoolPrewarmJob Job;
+	Job.Pool = Pool;
+	Job.Class = Class;
+	Job.Total = Count;
+	Job.Step = MoveTemp(Step);
+	Job.Finish = MoveTemp(Finish);
+	//
+	TArray<FSoftObjectPath> Paths;
+	GatherPendingSoftReferences(Class,Paths);
+	//
+	if (Paths.Num()>0) {
+		Job.Preload = Streamable.RequestAsyncLoad(Paths,FStreamableDelegate(),FStreamableManager::AsyncLoadHighPriority);
+		if (Job.Preload.IsValid()) {Preloads.Add(Job.Preload);}
+	}///
+	//
+	BatchTotal += Count;
+	Jobs.Add(MoveTemp(Job));
+	//
+	BroadcastProgress();
+}
+
+void UPoolPrewarmSubsystem::Cancel(const UActorComponent* Pool, const UClass* Class) {
+	for (int32 ID = Jobs.Num()-1; ID>=0; --ID) {
+		const FPoolPrewarmJob &Job = Jobs[ID];
+		if (Job.Pool.Get(true)!=Pool) {continue;}
+		if ((Class!=nullptr)&&Job.Class.IsValid()&&(!Job.Class->IsChildOf(Class))) {continue;}
+		//
+		BatchTotal -= (Job.Total-Job.Done);
+		Jobs.RemoveAt(ID,1,false);
+	}///
+	//
+	BroadcastProgress();
+}
+
+bool UPoolPrewarmSubsystem::IsPrewarming(const UActorComponent* Pool) {
+	UPoolPrewarmSubsystem* Prewarm = Find(Pool);
+	if (Prewarm==nullptr) {return false;}
+	//
+	for (const FPoolPrewarmJob &Job : Prewarm->Jobs) {
+		if (Job.Pool.Get()==Pool) {return true;}
+	} return false;
+}
+
+void UPoolPrewarmSubsystem::PrewarmOnDemand(const UActorComponent* Pool, const UClass* Class) {
+	UPoolPrewarmSubsystem* Prewarm = Find(Pool);
+	if (Prewarm==nullptr) {return;}
+	//
+	for (const FPoolPrewarmJob &Job : Prewarm->Jobs) {
+		if ((Job.Pool.Get()==Pool) && Job.Preload.IsValid()) {Job.Preload->WaitUntilComplete();}
+	}///
+	//
+	Prewarm->Step(1,0.0,Pool,Class);
+}
+
+void UPoolPrewarmSubsystem::CompletePrewarm(const UActorComponent* Pool) {
+	UPoolPrewarmSubsystem* Prewarm = Find(Pool);
+	if (Prewarm==nullptr) {return;}
+	//
+	for (const FPoolPrewarmJob &Job : Prewarm->Jobs) {
+		if ((Job.Pool.Get()==Pool) && Job.Preload.IsValid()) {Job.Preload->WaitUntilComplete();}
+	}///
+	//
+	Prewarm->Step(MAX_int32,0.0,Pool);
+}
+
+void UPoolPrewarmSubsystem::FlushPrewarm() {
+	for (const FPoolPrewarmJob &Job : Jobs) {
+		if (Job.Preload.IsValid()) {Job.Preload->WaitUntilComplete();}
+	}///
+	//
+	Step(MAX_int32,0.0);
+}
+
+float UPoolPrewarmSubsystem::GetPrewarmProgress() const {
+	if ((Jobs.Num()==0)||(BatchTotal<=0)) {return 1.f;}
+	//
+	return FMath::Clamp((float)BatchDone/(float)BatchTotal,0.f,1.f);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UPoolPrewarmSubsystem::Tick(float DeltaTime) {
+	const auto &Settings = GetDefault<UPoolSettings>();
+	const bool LoadingScreen = Settings->PrewarmDuringLoadingScreen && IsLoadingScreenUp();
+	//
+	const float BudgetMs = LoadingScreen ? Settings->PrewarmLoadingScreenBudgetMs : Settings->PrewarmBudgetMs;
+	const int32 Quota = ((!LoadingScreen)&&(Settings->PrewarmActorsPerFrame>0)) ? Settings->PrewarmActorsPerFrame : MAX_int32;
+	//
+	Step(Quota,FPlatformTime::Seconds()+FMath::Max(BudgetMs,0.1f)/1000.0);
+}
+
+void UPoolPrewarmSubsystem::Step(int32 Quota, const double Deadline, const UActorComponent* Filter, const UClass* ClassFilter) {
+	for (int32 ID=0; (ID<Jobs.Num())&&(Quota>0);) {
+		FPoolPrewarmJob &Job = Jobs[ID];
+		//
+		if (!Job.Pool.IsValid()||!Job.Class.IsValid()) {
+			BatchTotal -= (Job.Total-Job.Done);
+			Jobs.RemoveAt(ID,1,false);
+		continue;}
+		//
+		const bool Skip = ((Filter!=nullptr)&&(Job.Pool.Get()!=Filter)) || ((ClassFilter!=nullptr)&&(!Job.Class->IsChildOf(ClassFilter)));
+		const bool Preloading = Job.Preload.IsValid() && (!Job.Preload->HasLoadCompleted());
+		if (Skip||Preloading) {ID++; continue;}
+		//
+		// Members may enqueue Pools of their own on Begin Play, reallocating the queue; don't run or hold on to the queued Job itself.
+		const FPoolPrewarmStep Instantiate = Job.Step;
+		const int32 Made = Instantiate(FMath::Min(Quota,Job.Total-Job.Done),Deadline);
+		BatchDone += Made; Quota -= Made;
+		//
+		if (!Jobs.IsValidIndex(ID)) {break;}
+		FPoolPrewarmJob &Current = Jobs[ID];
+		Current.Done += Made;
+		//
+		// A Step that instantiates nothing won't ever recover (World tearing down, abstract Class, etc.); give up on it.
+		if ((Current.Done>=Current.Total)||(Made<=0)) {
+			BatchTotal -= (Current.Total-Current.Done);
+			FinishJob(ID);
+		continue;}
+		//
+		if ((Deadline>0.0)&&(FPlatformTime::Seconds()>=Deadline)) {break;}
+	}///
+	//
+	if (Jobs.Num()==0) {BatchTotal=0; BatchDone=0;}
+	//
+	BroadcastProgress();
+}
+
+void UPoolPrewarmSubsystem::FinishJob(const int32 ID) {
+	TFunction<void()> Finish = MoveTemp(Jobs[ID].Finish);
+	Jobs.RemoveAt(ID,1,false);
+	//
+	if (Finish) {Finish();}
+}
+
+void UPoolPrewarmSubsystem::BroadcastProgress() {
+	const float Progress = GetPrewarmProgress();
+	if (FMath::IsNearlyEqual(Progress,LastProgress)) {return;}
+	//
+	LastProgress = Progress;
+	OnPrewarmProgress.Broadcast(Progress);
+}
+
+bool UPoolPrewarmSubsystem::IsLoadingScreenUp() {
+	return IsMoviePlayerEnabled() && GetMoviePlayer()->IsMovieCurrentlyPlaying();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -7,13 +7,13 @@
 
 #include "PooledActor.h"
 #include "OBJPool_Shared.h"
-#include "Runtime/Engine/Classes/Particles/ParticleSystemComponent.h"
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 APooledActor::APooledActor(const FObjectInitializer &OBJ) : Super(OBJ) {
 	InitialLifeSpan = 0.f;
 	LifeSpanPool = 0.f;
+	PoolSlot = INDEX_NONE;
 	//
 	SharedPool = nullptr;
 	OwningPool = nullptr;
@@ -45,25 +45,8 @@ void APooledActor::Initialize() {
 	SetActorTickEnabled(false);
 	SetActorEnableCollision(false);
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->DeactivateSystem();}
-		//
-		C->SetActive(false);
-		C->SetComponentTickEnabled(false);
-		//
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
-			P->SetPhysicsLinearVelocity(FVector::ZeroVector);
-			P->SetComponentTickEnabled(false);
-			P->SetSimulatePhysics(false);
-			P->SetVisibility(false,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Deactivate(true);
 	//
 	if (OwningPool && OwningPool->IsValidLowLevelFast()) {
 		OwningPool->ReturnActor(const_cast<APooledActor*>(this));
@@ -77,14 +60,13 @@ void APooledActor::SetLifeSpanPool(float InLifespan) {
 		LifeSpanPool = InLifespan;
 		//
 		if (InLifespan>0.0001f) {
-			GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledActor::ReturnToPool,InLifespan);
-		} else {GetWorldTimerManager().ClearTimer(LifeSpanHandle);}
+			UPoolLifeSpanSubsystem::Schedule(this,InLifespan);
+		} else {UPoolLifeSpanSubsystem::Clear(this);}
 	}///
 }
 
 float APooledActor::GetLifeSpanPool() const {
-	const float CurrentLifespan = GetWorldTimerManager().GetTimerRemaining(LifeSpanHandle);
-	return (CurrentLifespan!=-1.0f) ? CurrentLifespan : 0.0f;
+	return UPoolLifeSpanSubsystem::GetRemaining(this);
 }
 
 UObjectPool* APooledActor::GetOwningPool() const {
@@ -105,17 +87,8 @@ void APooledActor::SpawnFromPool(const bool Reconstruct, const FPoolSpawnOptions
 	Spawned = true;
 	//
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetComponentTickEnabled(SpawnOptions.ActorTickEnabled);
-			P->SetSimulatePhysics(SpawnOptions.SimulatePhysics);
-			P->SetVisibility(true,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Show(SpawnOptions);
 	//
 	const auto &Settings = GetDefault<UPoolSettings>();
 	if (Settings->ReinitializeInstances) {
@@ -170,23 +143,16 @@ void APooledActor::FinishSpawnFromPool(const bool Reconstruct, const FTransform
 	if (Reconstruct) {
 		ResetPropertiesForConstruction();
 		RerunConstructionScripts();
+		ActivationPlan.Invalidate();
 	}///
 	//
 	if (LifeSpanPool>0.0001f) {
-		GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledActor::ReturnToPool,LifeSpanPool);
+		UPoolLifeSpanSubsystem::Schedule(this,LifeSpanPool);
 	}///
 	//
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->ActivateSystem(false);}
-		//
-		C->SetActive(true);
-		C->SetComponentTickEnabled(true);
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Activate(true);
 	//
 	//
 	EVENT_OnPoolBeginPlay();
@@ -198,25 +164,8 @@ void APooledActor::FinishSpawnFromPool(const bool Reconstruct, const FTransform
 void APooledActor::ReturnToPool() {
 	const auto &Settings = GetDefault<UPoolSettings>();
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->DeactivateSystem();}
-		//
-		C->SetActive(false);
-		C->SetComponentTickEnabled(false);
-		//
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
-			P->SetPhysicsLinearVelocity(FVector::ZeroVector);
-			P->SetComponentTickEnabled(false);
-			P->SetSimulatePhysics(false);
-			P->SetVisibility(false,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Deactivate(true);
 	//
 	SetActorEnableCollision(false);
 	SetActorHiddenInGame(true);
@@ -224,14 +173,14 @@ void APooledActor::ReturnToPool() {
 	//
 	if (OwningPool && OwningPool->IsValidLowLevelFast()) {
 		if (Settings->ReinitializeInstances) {
-			GetWorld()->GetTimerManager().ClearTimer(LifeSpanHandle);
+			UPoolLifeSpanSubsystem::Clear(this);
 		} OwningPool->ReturnActor(const_cast<APooledActor*>(this));
 		//
 		OnPoolEndPlay.Broadcast();
 		EVENT_OnPoolEndPlay();
 	} else if (SharedPool && SharedPool->IsValidLowLevelFast()) {
 		if (Settings->ReinitializeInstances) {
-			GetWorld()->GetTimerManager().ClearTimer(LifeSpanHandle);
+			UPoolLifeSpanSubsystem::Clear(this);
 		} SharedPool->ReturnActor(const_cast<APooledActor*>(this));
 		//
 		OnPoolEndPlay.Broadcast();
@@ -8,12 +8,11 @@
 #include "PooledCharacter.h"
 #include "OBJPool_Shared.h"
 
-#include "Runtime/Engine/Classes/Particles/ParticleSystemComponent.h"
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 APooledCharacter::APooledCharacter(const FObjectInitializer &OBJ) : Super(OBJ) {
 	LifeSpanPool = 0.f;
+	PoolSlot = INDEX_NONE;
 }
 
 void APooledCharacter::Initialize() {
@@ -25,24 +24,8 @@ void APooledCharacter::Initialize() {
 	SetActorTickEnabled(false);
 	SetActorEnableCollision(false);
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->DeactivateSystem();}
-		//
-		C->SetActive(false);
-		//
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
-			P->SetPhysicsLinearVelocity(FVector::ZeroVector);
-			P->SetComponentTickEnabled(false);
-			P->SetSimulatePhysics(false);
-			P->SetVisibility(false,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Deactivate(false);
 	//
 	if (OwningPool && OwningPool->IsValidLowLevelFast()) {
 		OwningPool->ReturnActor(const_cast<APooledCharacter*>(this));
@@ -54,14 +37,13 @@ void APooledCharacter::SetLifeSpanPool(float InLifespan) {
 		LifeSpanPool = InLifespan;
 		//
 		if (InLifespan>0.0001f) {
-			GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledCharacter::ReturnToPool,InLifespan);
-		} else {GetWorldTimerManager().ClearTimer(LifeSpanHandle);}
+			UPoolLifeSpanSubsystem::Schedule(this,InLifespan);
+		} else {UPoolLifeSpanSubsystem::Clear(this);}
 	}///
 }
 
 float APooledCharacter::GetLifeSpanPool() const {
-	const float CurrentLifespan = GetWorldTimerManager().GetTimerRemaining(LifeSpanHandle);
-	return (CurrentLifespan!=-1.0f) ? CurrentLifespan : 0.0f;
+	return UPoolLifeSpanSubsystem::GetRemaining(this);
 }
 
 void APooledCharacter::BeginPlay() {
@@ -83,17 +65,8 @@ void APooledCharacter::SpawnFromPool(const bool Reconstruct, const FPoolSpawnOpt
 	Spawned = true;
 	//
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetComponentTickEnabled(SpawnOptions.ActorTickEnabled);
-			P->SetSimulatePhysics(SpawnOptions.SimulatePhysics);
-			P->SetVisibility(true,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Show(SpawnOptions);
 	//
 	const auto &Settings = GetDefault<UPoolSettings>();
 	if (Settings->ReinitializeInstances) {
@@ -106,7 +79,7 @@ void APooledCharacter::SpawnFromPool(const bool Reconstruct, const FPoolSpawnOpt
 		if (!Spawned) {return;}
 		//
 		if (LifeSpanPool>0.0001f) {
-			GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledCharacter::ReturnToPool,LifeSpanPool);
+			UPoolLifeSpanSubsystem::Schedule(this,LifeSpanPool);
 		}///
 	}///
 	//
@@ -154,22 +127,16 @@ void APooledCharacter::FinishSpawnFromPool(const bool Reconstruct, const FTransf
 	if (Reconstruct) {
 		ResetPropertiesForConstruction();
 		RerunConstructionScripts();
+		ActivationPlan.Invalidate();
 	Reset();}
 	//
 	if (LifeSpanPool>0.0001f) {
-		GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledCharacter::ReturnToPool,LifeSpanPool);
+		UPoolLifeSpanSubsystem::Schedule(this,LifeSpanPool);
 	}///
 	//
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->ActivateSystem(false);}
-		//
-		C->SetActive(true);
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Activate(false);
 	//
 	//
 	EVENT_OnPoolBeginPlay();
@@ -182,24 +149,8 @@ void APooledCharacter::ReturnToPool() {
 	const auto &Settings = GetDefault<UPoolSettings>();
 	Spawned = false;
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->DeactivateSystem();}
-		//
-		C->SetActive(false);
-		//
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
-			P->SetPhysicsLinearVelocity(FVector::ZeroVector);
-			P->SetComponentTickEnabled(false);
-			P->SetSimulatePhysics(false);
-			P->SetVisibility(false,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Deactivate(false);
 	//
 	SetActorEnableCollision(false);
 	SetActorHiddenInGame(true);
@@ -207,7 +158,7 @@ void APooledCharacter::ReturnToPool() {
 	//
 	if (OwningPool && OwningPool->IsValidLowLevelFast()) {
 		if (Settings->ReinitializeInstances) {
-			GetWorld()->GetTimerManager().ClearTimer(LifeSpanHandle);
+			UPoolLifeSpanSubsystem::Clear(this);
 		} OwningPool->ReturnActor(const_cast<APooledCharacter*>(this));
 		//
 		OnPoolEndPlay.Broadcast();
@@ -7,12 +7,12 @@
 
 #include "PooledPawn.h"
 #include "OBJPool_Shared.h"
-#include "Runtime/Engine/Classes/Particles/ParticleSystemComponent.h"
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 APooledPawn::APooledPawn(const FObjectInitializer &OBJ) : Super(OBJ) {
 	LifeSpanPool = 0.f;
+	PoolSlot = INDEX_NONE;
 }
 
 void APooledPawn::Initialize() {
@@ -24,25 +24,8 @@ void APooledPawn::Initialize() {
 	SetActorTickEnabled(false);
 	SetActorEnableCollision(false);
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->DeactivateSystem();}
-		//
-		C->SetActive(false);
-		C->SetComponentTickEnabled(false);
-		//
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
-			P->SetPhysicsLinearVelocity(FVector::ZeroVector);
-			P->SetComponentTickEnabled(false);
-			P->SetSimulatePhysics(false);
-			P->SetVisibility(false,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Deactivate(true);
 	//
 	if (OwningPool && OwningPool->IsValidLowLevelFast()) {
 		OwningPool->ReturnActor(const_cast<APooledPawn*>(this));
@@ -54,14 +37,13 @@ void APooledPawn::SetLifeSpanPool(float InLifespan) {
 		LifeSpanPool = InLifespan;
 		//
 		if (InLifespan>0.0001f) {
-			GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledPawn::ReturnToPool,InLifespan);
-		} else {GetWorldTimerManager().ClearTimer(LifeSpanHandle);}
+			UPoolLifeSpanSubsystem::Schedule(this,InLifespan);
+		} else {UPoolLifeSpanSubsystem::Clear(this);}
 	}///
 }
 
 float APooledPawn::GetLifeSpanPool() const {
-	const float CurrentLifespan = GetWorldTimerManager().GetTimerRemaining(LifeSpanHandle);
-	return (CurrentLifespan!=-1.0f) ? CurrentLifespan : 0.0f;
+	return UPoolLifeSpanSubsystem::GetRemaining(this);
 }
 
 void APooledPawn::BeginPlay() {
@@ -83,17 +65,8 @@ void APooledPawn::SpawnFromPool(const bool Reconstruct, const FPoolSpawnOptions
 	Spawned = true;
 	//
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetComponentTickEnabled(SpawnOptions.ActorTickEnabled);
-			P->SetSimulatePhysics(SpawnOptions.SimulatePhysics);
-			P->SetVisibility(true,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Show(SpawnOptions);
 	//
 	const auto &Settings = GetDefault<UPoolSettings>();
 	if (Settings->ReinitializeInstances) {
@@ -106,7 +79,7 @@ void APooledPawn::SpawnFromPool(const bool Reconstruct, const FPoolSpawnOptions
 		if (!Spawned) {return;}
 		//
 		if (LifeSpanPool>0.0001f) {
-			GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledPawn::ReturnToPool,LifeSpanPool);
+			UPoolLifeSpanSubsystem::Schedule(this,LifeSpanPool);
 		}///
 	}///
 	//
@@ -154,23 +127,16 @@ void APooledPawn::FinishSpawnFromPool(const bool Reconstruct, const FTransform &
 	if (Reconstruct) {
 		ResetPropertiesForConstruction();
 		RerunConstructionScripts();
+		ActivationPlan.Invalidate();
 	Reset();}
 	//
 	if (LifeSpanPool>0.0001f) {
-		GetWorldTimerManager().SetTimer(LifeSpanHandle,this,&APooledPawn::ReturnToPool,LifeSpanPool);
+		UPoolLifeSpanSubsystem::Schedule(this,LifeSpanPool);
 	}///
 	//
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->ActivateSystem(false);}
-		//
-		C->SetActive(true);
-		C->SetComponentTickEnabled(true);
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Activate(true);
 	//
 	//
 	EVENT_OnPoolBeginPlay();
@@ -183,25 +149,8 @@ void APooledPawn::ReturnToPool() {
 	const auto &Settings = GetDefault<UPoolSettings>();
 	Spawned = false;
 	//
-	TInlineComponentArray<UActorComponent*>Components;
-	GetComponents(Components);
-	//
-	for (UActorComponent* C : Components) {
-		const auto &PS = Cast<UParticleSystemComponent>(C);
-		if (PS) {PS->DeactivateSystem();}
-		//
-		C->SetActive(false);
-		C->SetComponentTickEnabled(false);
-		//
-		const auto &P = Cast<UPrimitiveComponent>(C);
-		if (P && !P->IsA(UParticleSystemComponent::StaticClass())) {
-			P->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
-			P->SetPhysicsLinearVelocity(FVector::ZeroVector);
-			P->SetComponentTickEnabled(false);
-			P->SetSimulatePhysics(false);
-			P->SetVisibility(false,true);
-		}///
-	}///
+	ActivationPlan.Resolve(this);
+	ActivationPlan.Deactivate(true);
 	//
 	SetActorEnableCollision(false);
 	SetActorHiddenInGame(true);
@@ -209,7 +158,7 @@ void APooledPawn::ReturnToPool() {
 	//
 	if (OwningPool && OwningPool->IsValidLowLevelFast()) {
 		if (Settings->ReinitializeInstances) {
-			GetWorld()->GetTimerManager().ClearTimer(LifeSpanHandle);
+			UPoolLifeSpanSubsystem::Clear(this);
 		} OwningPool->ReturnActor(const_cast<APooledPawn*>(this));
 		//
 		OnPoolEndPlay.Broadcast();
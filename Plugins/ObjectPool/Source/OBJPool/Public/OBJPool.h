@@ -11,6 +11,7 @@
 #include "PooledActor.h"
 #include "PooledCharacter.h"
 #include "PooledProjectile.h"
+#include "OBJPoolCore.h"
 #include "PoolSpawnOptions.h"
 #include "PooledSplineProjectile.h"
 
@@ -41,6 +42,48 @@ public:
 	/// If enabled, keeps alive Pooled Actors that are still active when the parent Pool Component has been destroyed.
 	UPROPERTY(Category="General Settings", config, EditAnywhere, BlueprintReadOnly)
 	bool KeepOrphanActorsAlive;
+	//
+	//
+	/// If enabled, Pool Components initialize their members across several frames instead of all at once on Begin Play;
+	/// Soft references of Template Classes are streamed in asynchronously before their first member is instantiated.
+	UPROPERTY(Category="Prewarm Settings", config, EditAnywhere, BlueprintReadOnly)
+	bool TimeSlicedPrewarm;
+	//
+	/// Maximum amount of members instantiated per frame, for all Pools in a World. Zero means no count limit.
+	UPROPERTY(Category="Prewarm Settings", config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0", EditCondition="TimeSlicedPrewarm"))
+	int32 PrewarmActorsPerFrame;
+	//
+	/// Maximum time (milliseconds) spent instantiating members per frame, for all Pools in a World.
+	UPROPERTY(Category="Prewarm Settings", config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.1", EditCondition="TimeSlicedPrewarm"))
+	float PrewarmBudgetMs;
+	//
+	/// If enabled, while a Loading Screen is up the per-frame member limit is lifted and 'Loading Screen Budget' is used instead;
+	/// Pools get warm faster behind the Loading Screen, where a long frame can't be noticed.
+	UPROPERTY(Category="Prewarm Settings", config, EditAnywhere, BlueprintReadOnly, meta=(EditCondition="TimeSlicedPrewarm"))
+	bool PrewarmDuringLoadingScreen;
+	//
+	/// Maximum time (milliseconds) spent instantiating members per frame while a Loading Screen is up.
+	UPROPERTY(Category="Prewarm Settings", config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.1", EditCondition="PrewarmDuringLoadingScreen"))
+	float PrewarmLoadingScreenBudgetMs;
+	//
+	//
+	/// If enabled, Pools resize themselves from usage: they grow in chunks as soon as their Free-List runs dry,
+	/// and periodically trim idle members beyond their recent peak usage; never going below their 'Pool Size'.
+	UPROPERTY(Category="Adaptive Sizing", config, EditAnywhere, BlueprintReadOnly)
+	bool AdaptiveSizing;
+	//
+	/// How many members a Pool instantiates at once when it grows.
+	UPROPERTY(Category="Adaptive Sizing", config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="1", EditCondition="AdaptiveSizing"))
+	int32 GrowthChunk;
+	//
+	/// A Pool never grows beyond this amount of members, on demand or adaptively. Zero means no limit.
+	UPROPERTY(Category="Adaptive Sizing", config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0"))
+	int32 MaxPoolSize;
+	//
+	/// Interval (seconds) between trims of idle members. Members beyond the peak usage seen during the interval are destroyed.
+	/// Zero disables trimming.
+	UPROPERTY(Category="Adaptive Sizing", config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0", EditCondition="AdaptiveSizing"))
+	float TrimCooldown;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,9 +107,10 @@ class OBJPOOL_API UObjectPool : public UActorComponent {
 	//
 	friend class APooledActor;
 protected:
-	/// The Memory Pool.
-	UPROPERTY()
-	TArray<APooledActor*> Pool;
+	/// The Memory Pool; storage, Free-List and stats.
+	TPoolCore<APooledActor> Pool;
+	//
+	FTimerHandle TrimTimer;
 public:
 	/// Empties the Pool; Respawns all of its members based on 'Pool Size' allocation.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Initialize Object Pool", Keywords="initialize pool"))
@@ -78,6 +122,7 @@ public:
 public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector);
 	//
 	virtual void FlushObjectPool();
 	//
@@ -103,11 +148,35 @@ public:
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Empty Object Pool", Keywords="empty delete pool"))
 	void EmptyObjectPool();
 	//
+	/// Destroys idle Inactive members beyond the peak usage seen since the last trim, never going below 'Pool Size'.
+	/// Runs periodically by itself when 'Adaptive Sizing' is enabled in the project's Pool Settings.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Trim Object Pool", Keywords="trim shrink pool"))
+	void TrimObjectPool();
+	//
 	//
 	/// Returns the Container Array of Pooled Objects.
 	/// WARNING: Danger! Do not manually Add or Remove members from this!
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Object Array", Keywords="get pool objects"))
-	TArray<APooledActor*> GetObjectArray() const {return Pool;}
+	const TArray<APooledActor*> &GetObjectArray() const {return Pool.GetMembers();}
+	//
+	/// Read-only access to the Memory Pool; for queries and telemetry.
+	FORCEINLINE const TPoolCore<APooledActor> &GetPoolCore() const {return Pool;}
+	//
+	/// Amount of Spawned members of this Pool; kept up to date by the Pool, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Spawned", Keywords="count spawned pool"))
+	int32 GetNumSpawned() const {return Pool.NumActive();}
+	//
+	/// Amount of Inactive members of this Pool; kept up to date by the Pool, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Inactive", Keywords="count inactive pool"))
+	int32 GetNumInactive() const {return Pool.NumFree();}
+	//
+	/// Fills the given list with this Pool's Spawned members, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Spawned Objects", Keywords="get spawned objects"))
+	void FillSpawnedObjects(UPARAM(ref) TArray<APooledActor*> &Spawned) const {Pool.Fill(Spawned,true);}
+	//
+	/// Fills the given list with this Pool's Inactive members, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Inactive Objects", Keywords="get inactive objects"))
+	void FillInactiveObjects(UPARAM(ref) TArray<APooledActor*> &Inactive) const {Pool.Fill(Inactive,false);}
 	//
 	/// Fast-Query this Pool and returns all of its Spawned or Inactive Actors as separate lists.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Objects From Pool", Keywords="get pool objects"))
@@ -138,36 +207,47 @@ public:
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(WorldContext="WorldContextObject", UnsafeDuringActorConstruction = "true", BlueprintInternalUseOnly = "true"))
 	static APooledActor* FinishDeferredSpawnFromPool(APooledActor* Actor, const bool Reconstruct, const FTransform &SpawnTransform);
 	//
+	/// Spawns Count Actors from Pool in one pass, each placed on the matching Spawn Transform (cycled if fewer are given); for bursts.
+	/// Returns how many Actors have been Spawned.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(WorldContext="WorldContextObject", DisplayName="Spawn Many from Pool", Keywords="spawn many burst pool", AutoCreateRefTerm="SpawnTransforms"))
+	static int32 SpawnManyFromPool(const UObject* WorldContextObject, UObjectPool* ObjectPool, const FPoolSpawnOptions &SpawnOptions, const TArray<FTransform> &SpawnTransforms, const int32 Count, AActor* Owner, const bool Reconstruct, TArray<APooledActor*> &Spawned);
+	//
 	//
 	/// Gets this Pool's Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetObjectsFromPool() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(&TC,&TC);
+		return TC;
+	}
 	//
 	/// Gets this Pool's Spawned Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetSpawnedObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&O->Spawned) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(&TC,nullptr);
+		return TC;
+	}
 	//
 	/// Gets this Pool's Inactive Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetInactiveObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&(!O->Spawned)) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(nullptr,&TC);
+		return TC;
+	}
+	//
+	/// Visits this Pool's Spawned Objects of type T, without building a list.
+	template <typename T=APooledActor>
+	FORCEINLINE void ForEachSpawned(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		Pool.template ForEachSpawned<T>(Visit,Class);
+	}
+	//
+	/// Visits this Pool's Inactive Objects of type T, without building a list.
+	template <typename T=APooledActor>
+	FORCEINLINE void ForEachInactive(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		Pool.template ForEachInactive<T>(Visit,Class);
+	}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,9 +262,10 @@ class OBJPOOL_API UPawnPool : public UActorComponent {
 	//
 	friend class APooledPawn;
 protected:
-	/// The Memory Pool.
-	UPROPERTY()
-	TArray<APooledPawn*> Pool;
+	/// The Memory Pool; storage, Free-List and stats.
+	TPoolCore<APooledPawn> Pool;
+	//
+	FTimerHandle TrimTimer;
 public:
 	/// Empties the Pool; Respawns all of its members based on 'Pool Size' allocation.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Initialize Object Pool", Keywords="initialize pool"))
@@ -196,6 +277,7 @@ public:
 public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector);
 	//
 	virtual void FlushObjectPool();
 	//
@@ -221,11 +303,35 @@ public:
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Empty Object Pool", Keywords="empty delete pool"))
 	void EmptyObjectPool();
 	//
+	/// Destroys idle Inactive members beyond the peak usage seen since the last trim, never going below 'Pool Size'.
+	/// Runs periodically by itself when 'Adaptive Sizing' is enabled in the project's Pool Settings.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Trim Object Pool", Keywords="trim shrink pool"))
+	void TrimObjectPool();
+	//
 	//
 	/// Returns the Container Array of Pooled Objects.
 	/// WARNING: Danger! Do not manually Add or Remove members from this!
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Object Array", Keywords="get pool objects"))
-	TArray<APooledPawn*> GetObjectArray() const {return Pool;}
+	const TArray<APooledPawn*> &GetObjectArray() const {return Pool.GetMembers();}
+	//
+	/// Read-only access to the Memory Pool; for queries and telemetry.
+	FORCEINLINE const TPoolCore<APooledPawn> &GetPoolCore() const {return Pool;}
+	//
+	/// Amount of Spawned members of this Pool; kept up to date by the Pool, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Spawned", Keywords="count spawned pool"))
+	int32 GetNumSpawned() const {return Pool.NumActive();}
+	//
+	/// Amount of Inactive members of this Pool; kept up to date by the Pool, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Inactive", Keywords="count inactive pool"))
+	int32 GetNumInactive() const {return Pool.NumFree();}
+	//
+	/// Fills the given list with this Pool's Spawned members, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Spawned Objects", Keywords="get spawned objects"))
+	void FillSpawnedObjects(UPARAM(ref) TArray<APooledPawn*> &Spawned) const {Pool.Fill(Spawned,true);}
+	//
+	/// Fills the given list with this Pool's Inactive members, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Inactive Objects", Keywords="get inactive objects"))
+	void FillInactiveObjects(UPARAM(ref) TArray<APooledPawn*> &Inactive) const {Pool.Fill(Inactive,false);}
 	//
 	/// Fast-Query this Pool and returns all of its Spawned or Inactive Actors as separate lists.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Objects From Pool", Keywords="get pool objects"))
@@ -261,31 +367,37 @@ public:
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetObjectsFromPool() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(&TC,&TC);
+		return TC;
+	}
 	//
 	/// Gets this Pool's Spawned Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetSpawnedObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&O->Spawned) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(&TC,nullptr);
+		return TC;
+	}
 	//
 	/// Gets this Pool's Inactive Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetInactiveObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&(!O->Spawned)) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(nullptr,&TC);
+		return TC;
+	}
+	//
+	/// Visits this Pool's Spawned Objects of type T, without building a list.
+	template <typename T=APooledPawn>
+	FORCEINLINE void ForEachSpawned(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		Pool.template ForEachSpawned<T>(Visit,Class);
+	}
+	//
+	/// Visits this Pool's Inactive Objects of type T, without building a list.
+	template <typename T=APooledPawn>
+	FORCEINLINE void ForEachInactive(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		Pool.template ForEachInactive<T>(Visit,Class);
+	}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,9 +412,10 @@ class OBJPOOL_API UCharacterPool : public UActorComponent {
 	//
 	friend class APooledCharacter;
 protected:
-	/// The Memory Pool.
-	UPROPERTY()
-	TArray<APooledCharacter*> Pool;
+	/// The Memory Pool; storage, Free-List and stats.
+	TPoolCore<APooledCharacter> Pool;
+	//
+	FTimerHandle TrimTimer;
 public:
 	/// Empties the Pool; Respawns all of its members based on 'Pool Size' allocation.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Initialize Object Pool", Keywords="initialize pool"))
@@ -314,6 +427,7 @@ public:
 public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector);
 	//
 	virtual void FlushObjectPool();
 	//
@@ -339,11 +453,35 @@ public:
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Empty Object Pool", Keywords="empty delete pool"))
 	void EmptyObjectPool();
 	//
+	/// Destroys idle Inactive members beyond the peak usage seen since the last trim, never going below 'Pool Size'.
+	/// Runs periodically by itself when 'Adaptive Sizing' is enabled in the project's Pool Settings.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Trim Object Pool", Keywords="trim shrink pool"))
+	void TrimObjectPool();
+	//
 	//
 	/// Returns the Container Array of Pooled Objects.
 	/// WARNING: Danger! Do not manually Add or Remove members from this!
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Object Array", Keywords="get pool objects"))
-	TArray<APooledCharacter*> GetObjectArray() const {return Pool;}
+	const TArray<APooledCharacter*> &GetObjectArray() const {return Pool.GetMembers();}
+	//
+	/// Read-only access to the Memory Pool; for queries and telemetry.
+	FORCEINLINE const TPoolCore<APooledCharacter> &GetPoolCore() const {return Pool;}
+	//
+	/// Amount of Spawned members of this Pool; kept up to date by the Pool, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Spawned", Keywords="count spawned pool"))
+	int32 GetNumSpawned() const {return Pool.NumActive();}
+	//
+	/// Amount of Inactive members of this Pool; kept up to date by the Pool, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Inactive", Keywords="count inactive pool"))
+	int32 GetNumInactive() const {return Pool.NumFree();}
+	//
+	/// Fills the given list with this Pool's Spawned members, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Spawned Objects", Keywords="get spawned objects"))
+	void FillSpawnedObjects(UPARAM(ref) TArray<APooledCharacter*> &Spawned) const {Pool.Fill(Spawned,true);}
+	//
+	/// Fills the given list with this Pool's Inactive members, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Inactive Objects", Keywords="get inactive objects"))
+	void FillInactiveObjects(UPARAM(ref) TArray<APooledCharacter*> &Inactive) const {Pool.Fill(Inactive,false);}
 	//
 	/// Fast-Query this Pool and returns all of its Spawned or Inactive Actors as separate lists.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Objects From Pool", Keywords="get pool objects"))
@@ -379,31 +517,37 @@ public:
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetObjectsFromPool() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(&TC,&TC);
+		return TC;
+	}
 	//
 	/// Gets this Pool's Spawned Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetSpawnedObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&O->Spawned) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(&TC,nullptr);
+		return TC;
+	}
 	//
 	/// Gets this Pool's Inactive Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetInactiveObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&(!O->Spawned)) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; Pool.Gather<T>(nullptr,&TC);
+		return TC;
+	}
+	//
+	/// Visits this Pool's Spawned Objects of type T, without building a list.
+	template <typename T=APooledCharacter>
+	FORCEINLINE void ForEachSpawned(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		Pool.template ForEachSpawned<T>(Visit,Class);
+	}
+	//
+	/// Visits this Pool's Inactive Objects of type T, without building a list.
+	template <typename T=APooledCharacter>
+	FORCEINLINE void ForEachInactive(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		Pool.template ForEachInactive<T>(Visit,Class);
+	}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,19 +562,59 @@ class OBJPOOL_API USharedObjectPool : public UActorComponent {
 	//
 	friend class APooledActor;
 protected:
-	/// The Memory Pool.
-	UPROPERTY()
-	TArray<APooledActor*> Pool;
+	/// The Memory Pools, one per Template Class; each bucket has its own storage, Free-List and stats.
+	/// A request for a Class only ever touches the members of that Class, however many Templates share this Pool.
+	/// Buckets live on the heap: a Spawn may run member Begin Play or Construction Scripts that add buckets and rehash the map,
+	/// while the bucket serving the request is still in use.
+	TMap<const UClass*,TUniquePtr<TPoolCore<APooledActor>>> Buckets;
+	//
+	/// Every member across buckets; rebuilt on request by 'Get Object Array'.
+	mutable TArray<APooledActor*> Members;
+	//
+	/// Highest amount of members Spawned at once across buckets, since the last Initialization.
+	/// Buckets peak at different times, so the sum of their own peaks would overstate it.
+	int32 PeakActive = 0;
+	//
+	FTimerHandle TrimTimer;
+	//
+	//
+	/// The bucket holding members of Class; members of a subclass of a Template Class live in the Template's bucket.
+	TPoolCore<APooledActor>* FindBucket(const UClass* Class);
+	const TPoolCore<APooledActor>* FindBucket(const UClass* Class) const;
+	//
+	/// The bucket of a Template Class, made if missing.
+	TPoolCore<APooledActor> &FindOrAddBucket(const UClass* Class);
+	//
+	/// Instantiates Size members of a Template Class; sliced over frames when the project's Prewarm Settings ask for it.
+	void PopulateTemplateClass(UClass* Class, const int32 Size);
+	//
+	/// Raises Peak Active to the members Spawned right now; called after every Spawn request.
+	void TrackPeakActive() {PeakActive = FMath::Max(PeakActive,GetNumSpawned());}
+	//
+	/// Visits every bucket holding members of Class, with the filter its members must still pass; every bucket if Class is null.
+	template<typename TBuckets, typename FVisit>
+	static void VisitBuckets(TBuckets &Buckets, const UClass* Class, FVisit &&Visit) {
+		for (auto &Bucket : Buckets) {
+			if ((Class==nullptr)||Bucket.Key->IsChildOf(Class)) {Visit(*Bucket.Value,nullptr);}
+			else if (Class->IsChildOf(Bucket.Key)) {Visit(*Bucket.Value,Class);}
+		}///
+	}
 public:
 	virtual void FlushObjectPool();
 	//
 	/// Empties the Pool; Respawns all of its members based on 'Pool Size' allocation.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Initialize Object Pool", Keywords="initialize pool"))
 	void InitializeObjectPool();
+	//
+	/// Adds a Template Class to this Pool at runtime, for Pools shared by Actors that only become known during play.
+	/// Once the Pool has begun play its members are instantiated right away; does nothing if Class is already a Template Class.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Add Template Class", Keywords="add template class pool"))
+	void AddTemplateClass(TSubclassOf<APooledActor> Class, const int32 Size);
 public:
 	virtual void BeginPlay() override;
 	virtual void PostInitProperties() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector &Collector);
 	//
 	//
 	/// If checked, this will make this Pool Component to automatically load Object Instances when the Game starts.
@@ -451,11 +635,41 @@ public:
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Empty Object Pool", Keywords="empty delete pool"))
 	void EmptyObjectPool(const UClass* Class);
 	//
+	/// Destroys idle Inactive members beyond the peak usage seen since the last trim, never going below the sizes set on 'Template Classes'.
+	/// Runs periodically by itself when 'Adaptive Sizing' is enabled in the project's Pool Settings.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Trim Object Pool", Keywords="trim shrink pool"))
+	void TrimObjectPool();
+	//
 	//
 	/// Returns the Container Array of Pooled Objects.
 	/// WARNING: Danger! Do not manually Add or Remove members from this!
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Object Array", Keywords="get pool objects"))
-	TArray<APooledActor*> GetObjectArray() const {return Pool;}
+	const TArray<APooledActor*> &GetObjectArray() const;
+	//
+	/// Read-only access to the Memory Pool of a Template Class; for queries and telemetry. Null if Class has no bucket.
+	FORCEINLINE const TPoolCore<APooledActor>* GetPoolCore(const UClass* Class) const {return FindBucket(Class);}
+	//
+	/// Stats of every bucket, summed; Peak Active is the peak of the whole Pool, the bucket peaks stay on each Pool Core.
+	FPoolStats GetPoolStats() const;
+	//
+	/// Amount of live members of this Pool, across buckets.
+	int32 GetNumMembers() const;
+	//
+	/// Amount of Spawned members of this Pool; kept up to date by each bucket, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Spawned", Keywords="count spawned pool"))
+	int32 GetNumSpawned() const;
+	//
+	/// Amount of Inactive members of this Pool; kept up to date by each bucket, no query involved.
+	UFUNCTION(Category="Object Pool", BlueprintPure, meta=(DisplayName="Get Num Inactive", Keywords="count inactive pool"))
+	int32 GetNumInactive() const;
+	//
+	/// Fills the given list with this Pool's Spawned members of Class, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Spawned Objects", Keywords="get spawned objects"))
+	void FillSpawnedObjects(const UClass* Class, UPARAM(ref) TArray<APooledActor*> &Spawned) const;
+	//
+	/// Fills the given list with this Pool's Inactive members of Class, reusing its memory; for queries made every tick.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Fill Inactive Objects", Keywords="get inactive objects"))
+	void FillInactiveObjects(const UClass* Class, UPARAM(ref) TArray<APooledActor*> &Inactive) const;
 	//
 	/// Fast-Query this Pool and returns all of its Spawned or Inactive Actors as separate lists.
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Objects From Pool", Keywords="get pool objects"))
@@ -486,36 +700,47 @@ public:
 	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(WorldContext="WorldContextObject", UnsafeDuringActorConstruction="true", BlueprintInternalUseOnly="true"))
 	static APooledActor* FinishDeferredSpawnFromPool(APooledActor* Actor, const bool Reconstruct, const FTransform &SpawnTransform);
 	//
+	/// Spawns Count Actors of Class from Pool in one pass, each placed on the matching Spawn Transform (cycled if fewer are given); for bursts.
+	/// Returns how many Actors have been Spawned.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(WorldContext="WorldContextObject", DisplayName="Spawn Many from Pool", Keywords="spawn many burst pool", AutoCreateRefTerm="SpawnTransforms"))
+	static int32 SpawnManyFromPool(const UObject* WorldContextObject, USharedObjectPool* SharedPool, UClass* Class, const FPoolSpawnOptions &SpawnOptions, const TArray<FTransform> &SpawnTransforms, const int32 Count, AActor* Owner, const bool Reconstruct, TArray<APooledActor*> &Spawned);
+	//
 	//
 	/// Gets this Pool's Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetObjectsFromPool() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; VisitBuckets(Buckets,nullptr,[&TC](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.template Gather<T>(&TC,&TC,Filter);});
+		return TC;
+	}
 	//
 	/// Gets this Pool's Spawned Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetSpawnedObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&O->Spawned) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; VisitBuckets(Buckets,nullptr,[&TC](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.template Gather<T>(&TC,nullptr,Filter);});
+		return TC;
+	}
 	//
 	/// Gets this Pool's Inactive Objects, Type-casting.
 	/// Returns Empty Array if Cast fails.
 	template <typename T>
 	FORCEINLINE TArray<T*> GetInactiveObjects() const {
-		TArray<T*> TC;
-		for (const auto &OBJ : Pool) {
-			if (!OBJ->IsValidLowLevelFast()||OBJ->IsPendingKill()) {continue;}
-			T* O = Cast<T>(*&OBJ); if (O&&(!O->Spawned)) {TC.Add(O);}
-	} return TC;}
+		TArray<T*> TC; VisitBuckets(Buckets,nullptr,[&TC](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.template Gather<T>(nullptr,&TC,Filter);});
+		return TC;
+	}
+	//
+	/// Visits this Pool's Spawned Objects of type T, without building a list.
+	template <typename T=APooledActor>
+	FORCEINLINE void ForEachSpawned(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		VisitBuckets(Buckets,Class,[&Visit](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.template ForEachSpawned<T>(Visit,Filter);});
+	}
+	//
+	/// Visits this Pool's Inactive Objects of type T, without building a list.
+	template <typename T=APooledActor>
+	FORCEINLINE void ForEachInactive(TFunctionRef<void(typename TIdentity<T>::Type*)> Visit, const UClass* Class=nullptr) const {
+		VisitBuckets(Buckets,Class,[&Visit](const TPoolCore<APooledActor> &Bucket, const UClass* Filter){Bucket.template ForEachInactive<T>(Visit,Filter);});
+	}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -523,5 +748,25 @@ public:
 
 void LOG_OBJ(const bool Debug, const float Duration, const FColor Color, const FString Message);
 
+/// Growth Policy currently set by the project's Pool Settings.
+FPoolGrowthPolicy GetPoolGrowthPolicy();
+
+/// Snapshot of one Pool Component, for telemetry.
+struct FPoolReport {
+	FString Pool;
+	FString Owner;
+	FString Template;
+	//
+	int32 PoolSize = 0;
+	int32 Members = 0;
+	int32 Active = 0;
+	int32 Inactive = 0;
+	//
+	FPoolStats Stats;
+};
+
+/// Collects a Report of every Pool Component alive in World; of every Game World if World is null.
+void GatherPoolReports(const UWorld* World, TArray<FPoolReport> &Reports);
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
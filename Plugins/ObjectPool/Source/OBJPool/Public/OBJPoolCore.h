@@ -0,0 +1,467 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "Templates/Identity.h"
+#include "PoolFreeList.h"
+#include "OBJPoolStats.h"
+#include "PoolSpawnOptions.h"
+#include "Runtime/Engine/Classes/Engine/World.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Core:: Growth Policy & Stats
+
+/// How a Pool reacts when a Spawn request finds no Inactive member.
+/// Pool Components fill this from the project's Pool Settings at the time of the request.
+struct FPoolGrowthPolicy {
+	/// Instantiate a new member to fulfill the request.
+	bool InstantiateOnDemand = false;
+	//
+	/// Recycle the most recently Spawned member instead of failing.
+	bool NeverFailDeferredSpawn = false;
+	//
+	/// Grow in chunks whenever the Free-List runs dry and trim idle members periodically.
+	bool AdaptiveSizing = false;
+	//
+	/// Members instantiated per growth event.
+	int32 GrowthChunk = 1;
+	//
+	/// Members a Pool may hold at most; zero means no limit.
+	int32 MaxPoolSize = 0;
+	//
+	/// Seconds between trims of idle members; zero disables trimming.
+	float TrimCooldown = 0.f;
+};
+
+/// Running counters of a Pool, since its last Initialization.
+struct FPoolStats {
+	/// Successful Spawn requests.
+	int32 Spawns = 0;
+	//
+	/// Members sent back to the Free-List.
+	int32 Returns = 0;
+	//
+	/// Members instantiated by the Pool, including the initial population.
+	int32 Instantiated = 0;
+	//
+	/// Spawned members forcefully returned to fulfill a request (Never Fail policy).
+	int32 Recycled = 0;
+	//
+	/// Spawn requests that could not be fulfilled.
+	int32 Failures = 0;
+	//
+	/// Highest amount of members Spawned at once.
+	int32 PeakActive = 0;
+	//
+	/// Times the Pool grew beyond its population, on demand or adaptively.
+	int32 Grown = 0;
+	//
+	/// Idle members destroyed by trims.
+	int32 Trimmed = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Core:: Storage, Free-List & Spawn Logic
+
+///  Pool Core;
+/// Owns the storage of a Pool Component, its Free-List, growth policy and stats.
+/// Object, Pawn, Character and Shared Pool Components are thin wrappers over this template; they only supply
+/// the member type, how members are bound to their owning Component and which Template Classes are accepted.
+/// Storage is not a reflected property: the owning Component must report it to GC via AddReferencedObjects().
+template<typename TActor>
+struct TPoolCore {
+private:
+	/// The Memory Pool; slots map 1:1 to the Free-List.
+	TArray<TActor*> Members;
+	//
+	FPoolFreeList FreeList;
+	FPoolStats Stats;
+	//
+	/// Highest amount of members Spawned at once since the last Trim.
+	int32 IdlePeak = 0;
+	//
+	//
+	static FORCEINLINE bool IsAlive(const TActor* Member) {
+		return (Member!=nullptr) && Member->IsValidLowLevelFast() && (!Member->IsPendingKill());
+	}
+	//
+	static FORCEINLINE bool PassFilter(const TActor* Member, const UClass* Filter) {
+		return (Filter==nullptr) || Member->IsA(Filter);
+	}
+	//
+	FORCEINLINE bool Owns(const TActor* Member) const {
+		return Members.IsValidIndex(Member->PoolSlot) && (Members[Member->PoolSlot]==Member);
+	}
+	//
+	template<typename T>
+	FORCEINLINE void GatherList(const TArray<int32> &Slots, TArray<T*> &Out, const UClass* Filter) const {
+		for (const int32 Slot : Slots) {
+			TActor* OBJ = Members[Slot];
+			if (!IsAlive(OBJ)||!PassFilter(OBJ,Filter)) {continue;}
+			if (T* O = Cast<T>(OBJ)) {Out.Add(O);}
+		}///
+	}
+	//
+	FORCEINLINE TActor* FindTop(const TArray<int32> &Slots, const UClass* Filter) const {
+		for (int32 ID = Slots.Num()-1; ID>=0; --ID) {
+			TActor* OBJ = Members[Slots[ID]];
+			if (!IsAlive(OBJ)) {continue;}
+			//
+			if (PassFilter(OBJ,Filter)) {return OBJ;}
+		}///
+		//
+		return nullptr;
+	}
+public:
+	void AddReferencedObjects(FReferenceCollector &Collector, const UObject* Referencer) {
+		Collector.AddReferencedObjects(Members,Referencer);
+	}
+	//
+	//
+	FORCEINLINE int32 Num() const {return Members.Num();}
+	FORCEINLINE int32 NumAlive() const {return Members.Num()-FreeList.NumDead();}
+	FORCEINLINE int32 NumFree() const {return FreeList.NumFree();}
+	FORCEINLINE int32 NumActive() const {return FreeList.NumActive();}
+	//
+	FORCEINLINE const FPoolStats &GetStats() const {return Stats;}
+	FORCEINLINE const TArray<TActor*> &GetMembers() const {return Members;}
+	//
+	/// Checks the Free-List invariants, and that every linked slot holds a live member that knows its slot and agrees on being Spawned.
+	/// Returns false with a description of the first broken invariant. For tests, walks every member.
+	bool Validate(FString &Error) const {
+		if (!FreeList.Validate(Error)) {return false;}
+		if (FreeList.NumSlots()!=Members.Num()) {Error=FString::Printf(TEXT("%i slots for %i members"),FreeList.NumSlots(),Members.Num()); return false;}
+		//
+		for (int32 Slot=0; Slot<Members.Num(); ++Slot) {
+			if (!FreeList.IsLinked(Slot)) {continue;}
+			//
+			const TActor* OBJ = Members[Slot];
+			if (!IsAlive(OBJ)) {continue;}
+			if (OBJ->PoolSlot!=Slot) {Error=FString::Printf(TEXT("member %s at slot %i thinks it is at %i"),*OBJ->GetName(),Slot,OBJ->PoolSlot); return false;}
+			if (OBJ->Spawned!=FreeList.IsSpawned(Slot)) {Error=FString::Printf(TEXT("member %s at slot %i is %s but listed %s"),*OBJ->GetName(),Slot,OBJ->Spawned?TEXT("spawned"):TEXT("inactive"),FreeList.IsSpawned(Slot)?TEXT("active"):TEXT("free")); return false;}
+		}///
+		//
+		return true;
+	}
+	//
+	//
+	/// Adds a member to storage, as Inactive.
+	void Add(TActor* Member) {
+		Member->PoolSlot = FreeList.AddSlot();
+		Members.Add(Member);
+	}
+	//
+	/// Moves a member back into the Free-List. Returns false if it doesn't belong to this Pool yet.
+	bool Release(TActor* Member) {
+		if (!Owns(Member)) {return false;}
+		//
+		if (FreeList.IsSpawned(Member->PoolSlot)) {Stats.Returns++; INC_DWORD_STAT(STAT_OBJPool_Returns);}
+		FreeList.MarkInactive(Member->PoolSlot);
+		//
+		return true;
+	}
+	//
+	/// Moves a member from the Free-List into the Active-Set, after it has been pulled for Spawn.
+	void Track(TActor* Member) {
+		if (!Owns(Member)) {return;}
+		//
+		FreeList.MarkSpawned(Member->PoolSlot);
+		Stats.PeakActive = FMath::Max(Stats.PeakActive,FreeList.NumActive());
+		IdlePeak = FMath::Max(IdlePeak,FreeList.NumActive());
+	}
+	//
+	/// Returns true if the growth policy allows this Pool to instantiate more members.
+	bool CanGrow(const FPoolGrowthPolicy &Policy) const {
+		if (!Policy.InstantiateOnDemand&&!Policy.AdaptiveSizing) {return false;}
+		return (Policy.MaxPoolSize<=0)||(NumAlive()<Policy.MaxPoolSize);
+	}
+	//
+	/// Rebuilds storage without the members destroyed outside of the Pool.
+	void Compact() {
+		if (Members.Num()==0) {return;}
+		//
+		FPoolFreeList Links; Links.Reset(Members.Num());
+		int32 Count = 0;
+		//
+		for (int32 ID=0; ID<Members.Num(); ++ID) {
+			TActor* OBJ = Members[ID];
+			if (!IsAlive(OBJ)) {continue;}
+			const bool IsSpawned = FreeList.IsValidSlot(ID) ? FreeList.IsSpawned(ID) : OBJ->Spawned;
+			//
+			OBJ->PoolSlot = Links.AddSlot();
+			if (IsSpawned) {Links.MarkSpawned(OBJ->PoolSlot);}
+			Members[Count++] = OBJ;
+		} Members.SetNum(Count,false);
+		//
+		FreeList = MoveTemp(Links);
+	}
+	//
+	/// Unlinks Free-List entries on top of the stack whose Actors have been destroyed outside of the Pool.
+	void Prune() {
+		const TArray<int32> &Free = FreeList.GetFree();
+		while (Free.Num()>0) {
+			const int32 Slot = Free.Last();
+			if (IsAlive(Members[Slot])) {break;}
+			FreeList.KillSlot(Slot);
+		}///
+		//
+		if (FreeList.NumDead()*2 > Members.Num()) {Compact();}
+	}
+	//
+	/// Destroys every member and releases storage.
+	void Empty() {
+		for (int32 ID = Members.Num()-1; ID>=0; --ID) {
+			if (IsAlive(Members[ID])) {Members[ID]->Destroy(true,true);}
+		} Members.Empty(); FreeList.Reset(); Stats = FPoolStats(); IdlePeak = 0;
+	}
+	//
+	/// Destroys every member of Class, Spawned or not.
+	void EmptyClass(const UClass* Class) {
+		for (int32 ID = Members.Num()-1; ID>=0; --ID) {
+			if (!IsAlive(Members[ID])||!Members[ID]->IsA(Class)) {continue;}
+			Members[ID]->Destroy(true,true);
+		}///
+		//
+		Compact();
+	}
+	//
+	/// Destroys Inactive members only; Spawned members are left alive as orphans.
+	void EmptyInactive() {
+		for (int32 ID = Members.Num()-1; ID>=0; --ID) {
+			if (!IsAlive(Members[ID])||Members[ID]->Spawned) {continue;}
+			Members[ID]->Destroy(true,true);
+		}///
+	}
+	//
+	//
+	FORCEINLINE TActor* GetSpawned(const UClass* Filter=nullptr) const {return FindTop(FreeList.GetActive(),Filter);}
+	FORCEINLINE TActor* GetInactive(const UClass* Filter=nullptr) const {return FindTop(FreeList.GetFree(),Filter);}
+	//
+	/// Appends live members of type T, optionally filtered by Class, to the given lists.
+	template<typename T>
+	void Gather(TArray<T*>* Spawned, TArray<T*>* Inactive, const UClass* Filter=nullptr) const {
+		if (Spawned) {GatherList(FreeList.GetActive(),*Spawned,Filter);}
+		if (Inactive) {GatherList(FreeList.GetFree(),*Inactive,Filter);}
+	}
+	//
+	/// Replaces the contents of Out with live members of type T, keeping its memory; nothing is allocated once Out has grown to fit.
+	template<typename T>
+	void Fill(TArray<T*> &Out, const bool Spawned, const UClass* Filter=nullptr) const {
+		Out.Reset();
+		GatherList(Spawned ? FreeList.GetActive() : FreeList.GetFree(),Out,Filter);
+	}
+	//
+	/// Visits live Spawned members of type T, optionally filtered by Class. Visitors must not Spawn or Return members of this Pool.
+	template<typename T>
+	void ForEachSpawned(TFunctionRef<void(T*)> Visit, const UClass* Filter=nullptr) const {
+		for (TActor* OBJ : SpawnedMembers()) {
+			if (!PassFilter(OBJ,Filter)) {continue;}
+			if (T* O = Cast<T>(OBJ)) {Visit(O);}
+		}///
+	}
+	//
+	/// Visits live Inactive members of type T, optionally filtered by Class. Visitors must not Spawn or Return members of this Pool.
+	template<typename T>
+	void ForEachInactive(TFunctionRef<void(T*)> Visit, const UClass* Filter=nullptr) const {
+		for (TActor* OBJ : InactiveMembers()) {
+			if (!PassFilter(OBJ,Filter)) {continue;}
+			if (T* O = Cast<T>(OBJ)) {Visit(O);}
+		}///
+	}
+	//
+	//
+	///  Member Range;
+	/// Live members of one list of the Free-List, for range-based loops that allocate nothing.
+	/// Spawning or Returning members of the Pool while iterating invalidates the range.
+	struct FMemberRange {
+	private:
+		const TArray<TActor*> &Members;
+		const TArray<int32> &Slots;
+	public:
+		struct FIterator {
+		private:
+			const FMemberRange &Range;
+			int32 Index;
+			//
+			FORCEINLINE void Skip() {
+				while ((Index<Range.Slots.Num()) && (!IsAlive(Range.Members[Range.Slots[Index]]))) {++Index;}
+			}
+		public:
+			FIterator(const FMemberRange &InRange, const int32 InIndex) : Range(InRange), Index(InIndex) {Skip();}
+			//
+			FORCEINLINE TActor* operator*() const {return Range.Members[Range.Slots[Index]];}
+			FORCEINLINE FIterator &operator++() {++Index; Skip(); return *this;}
+			FORCEINLINE bool operator!=(const FIterator &Other) const {return Index!=Other.Index;}
+		};
+		//
+		FMemberRange(const TArray<TActor*> &InMembers, const TArray<int32> &InSlots) : Members(InMembers), Slots(InSlots) {}
+		//
+		FORCEINLINE FIterator begin() const {return FIterator(*this,0);}
+		FORCEINLINE FIterator end() const {return FIterator(*this,Slots.Num());}
+	};
+	//
+	FORCEINLINE FMemberRange SpawnedMembers() const {return FMemberRange(Members,FreeList.GetActive());}
+	FORCEINLINE FMemberRange InactiveMembers() const {return FMemberRange(Members,FreeList.GetFree());}
+	//
+	//
+	/// Spawns a brand new member of Class; Bind is called before Finish Spawning, to link the member to its owning Component.
+	template<typename FBind>
+	TActor* Instantiate(UWorld* World, UClass* Class, const FTransform &Transform, AActor* Owner, APawn* Instigator, ESpawnActorCollisionHandlingMethod CollisionHandling, FBind &&Bind) {
+		if (World==nullptr||Class==nullptr) {return nullptr;}
+		//
+		TActor* ACT = World->SpawnActorDeferred<TActor>(Class,Transform,Owner,Instigator,CollisionHandling);
+		if (ACT) {
+			Bind(ACT);
+			ACT->FinishSpawning(Transform);
+			Stats.Instantiated++; INC_DWORD_STAT(STAT_OBJPool_Instantiated);
+		} return ACT;
+	}
+	//
+	/// Instantiates up to Count Inactive members of Class. Returns how many have been instantiated.
+	/// If a Deadline (FPlatformTime::Seconds) is given, stops as soon as it's crossed; at least one member is always instantiated.
+	template<typename FBind>
+	int32 Populate(UWorld* World, UClass* Class, const int32 Count, AActor* PoolOwner, FBind &&Bind, const double Deadline=0.0) {
+		const FTransform SpawnTransform(FRotator::ZeroRotator,FVector::ZeroVector,FVector(1.f,1.f,1.f));
+		APawn* Instigator = PoolOwner ? PoolOwner->GetInstigator() : nullptr;
+		//
+		int32 Done = 0;
+		Members.Reserve(Members.Num()+Count);
+		while (Done<Count) {
+			TActor* ACT = Instantiate(World,Class,SpawnTransform,PoolOwner,Instigator,ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn,Bind);
+			if (ACT==nullptr) {break;} ACT->Initialize(); Done++;
+			//
+			if ((Deadline>0.0) && (FPlatformTime::Seconds()>=Deadline)) {break;}
+		} return Done;
+	}
+	//
+	/// Instantiates a chunk of Inactive members of Class, as far as the growth policy allows. Returns how many have been instantiated.
+	template<typename FBind>
+	int32 Grow(UWorld* World, UClass* Class, AActor* PoolOwner, const FPoolGrowthPolicy &Policy, FBind &&Bind) {
+		SCOPE_CYCLE_COUNTER(STAT_OBJPool_Grow);
+		//
+		int32 Count = FMath::Max(1,Policy.GrowthChunk);
+		if (Policy.MaxPoolSize>0) {Count = FMath::Min(Count,Policy.MaxPoolSize-NumAlive());}
+		if (Count<=0) {return 0;}
+		//
+		const int32 Done = Populate(World,Class,Count,PoolOwner,Bind);
+		if (Done>0) {Stats.Grown++; INC_DWORD_STAT(STAT_OBJPool_Grown);}
+		//
+		return Done;
+	}
+	//
+	/// Destroys idle Inactive members beyond the peak usage seen since the last Trim, keeping at least Floor members alive.
+	/// A chunk of headroom is kept on top of the peak, so a Pool doesn't trim what it would have to grow back right away.
+	int32 Trim(const int32 Floor, const FPoolGrowthPolicy &Policy) {
+		SCOPE_CYCLE_COUNTER(STAT_OBJPool_Trim);
+		//
+		const int32 Target = FMath::Max(Floor,IdlePeak+FMath::Max(1,Policy.GrowthChunk));
+		int32 Count = 0;
+		//
+		while ((NumAlive()>Target)&&(FreeList.NumFree()>0)) {
+			const int32 Slot = FreeList.GetFree().Last();
+			TActor* OBJ = Members[Slot];
+			//
+			FreeList.KillSlot(Slot);
+			if (IsAlive(OBJ)) {OBJ->Destroy(true,true); Count++;}
+		}///
+		//
+		IdlePeak = FreeList.NumActive();
+		if (Count>0) {
+			Stats.Trimmed += Count; INC_DWORD_STAT_BY(STAT_OBJPool_Trimmed,Count);
+			Compact();
+		} return Count;
+	}
+	//
+	/// Pulls an Inactive member of Class and starts Spawning it, applying the growth policy when the Free-List is exhausted.
+	/// If the request can't be fulfilled, returns the most recently Spawned member with SpawnSuccessful = false.
+	template<typename FBind>
+	TActor* BeginDeferredSpawn(const UObject* WorldContextObject, UWorld* World, UClass* Class, const UClass* Filter, const FPoolGrowthPolicy &Policy, AActor* PoolOwner, AActor* Owner, const FPoolSpawnOptions &SpawnOptions, const FTransform &SpawnTransform, ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, const bool Reconstruct, FBind &&Bind, bool &SpawnSuccessful) {
+		SCOPE_CYCLE_COUNTER(STAT_OBJPool_Spawn);
+		Prune();
+		//
+		TActor* DeferredSpawn = GetInactive(Filter);
+		//
+		if ((DeferredSpawn==nullptr) && CanGrow(Policy)) {
+			DeferredSpawn = Instantiate(World,Class,SpawnTransform,Owner,PoolOwner->GetInstigator(),CollisionHandlingOverride,Bind);
+			if (DeferredSpawn!=nullptr) {Stats.Grown++; INC_DWORD_STAT(STAT_OBJPool_Grown);}
+		} if ((DeferredSpawn==nullptr) && Policy.NeverFailDeferredSpawn) {
+			DeferredSpawn = GetSpawned(Filter);
+			if (DeferredSpawn!=nullptr) {DeferredSpawn->ReturnToPool(); Stats.Recycled++; INC_DWORD_STAT(STAT_OBJPool_Recycled);}
+		}///
+		//
+		if (DeferredSpawn!=nullptr) {
+			const APawn* Instigator = Cast<APawn>(WorldContextObject);
+			if (Instigator==nullptr) { if (const AActor* ContextActor = Cast<AActor>(WorldContextObject)) {Instigator = ContextActor->GetInstigator();} }
+			if (Instigator!=nullptr) {DeferredSpawn->SetInstigator(const_cast<APawn*>(Instigator));}
+			if (Owner==nullptr) {DeferredSpawn->SetOwner(PoolOwner);}
+			//
+			Bind(DeferredSpawn);
+			DeferredSpawn->Initialize();
+			Track(DeferredSpawn);
+			//
+			DeferredSpawn->SpawnFromPool(Reconstruct,SpawnOptions,SpawnTransform);
+			SpawnSuccessful = DeferredSpawn->Spawned;
+			if (SpawnSuccessful) {Stats.Spawns++; INC_DWORD_STAT(STAT_OBJPool_Spawns);}
+			//
+			// Refill ahead of the next request, instead of growing one member at a time.
+			if (SpawnSuccessful && Policy.AdaptiveSizing && (GetInactive(Filter)==nullptr) && CanGrow(Policy)) {
+				Grow(World,Class,PoolOwner,Policy,Bind);
+			}///
+		} else {
+			SpawnSuccessful = false; Stats.Failures++; INC_DWORD_STAT(STAT_OBJPool_Failures);
+			DeferredSpawn = GetSpawned(Filter);
+		} return DeferredSpawn;
+	}
+	//
+	/// Finishes Deferred Spawning a member, after its exposed properties have been set.
+	static TActor* FinishDeferredSpawn(TActor* Member, const bool Reconstruct, const FTransform &SpawnTransform) {
+		if (Member->IsValidLowLevelFast()&&(!Member->IsPendingKill())&&(!Member->IsActorInitialized())) {
+			Member->FinishSpawning(SpawnTransform);
+		} if (Member->IsValidLowLevelFast()&&(!Member->IsPendingKill())) {
+			Member->FinishSpawnFromPool(Reconstruct,SpawnTransform);
+		} return Member;
+	}
+	//
+	/// Spawns Count members of Class in one pass, each placed on the matching Spawn Transform; Transforms are cycled if fewer than Count.
+	/// For a single-class Pool, what the burst lacks is grown in one go up front, instead of one member per request.
+	/// Stops at the first request that can't be fulfilled. Returns how many members have been Spawned into the Spawned list.
+	/// A burst never recycles Spawned members (Never Fail policy), so every member it adds is unique.
+	template<typename FBind>
+	int32 SpawnMany(const UObject* WorldContextObject, UWorld* World, UClass* Class, const UClass* Filter, const FPoolGrowthPolicy &InPolicy, AActor* PoolOwner, AActor* Owner, const FPoolSpawnOptions &SpawnOptions, const TArray<FTransform> &Transforms, const int32 Count, ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, const bool Reconstruct, FBind &&Bind, TArray<TActor*> &Spawned) {
+		if ((Count<=0)||(Transforms.Num()==0)) {return 0;}
+		//
+		FPoolGrowthPolicy Policy = InPolicy;
+		Policy.NeverFailDeferredSpawn = false;
+		//
+		Prune();
+		if ((Filter==nullptr) && (NumFree()<Count) && CanGrow(Policy)) {
+			int32 Missing = Count-NumFree();
+			if (Policy.MaxPoolSize>0) {Missing = FMath::Min(Missing,Policy.MaxPoolSize-NumAlive());}
+			if ((Missing>0) && (Populate(World,Class,Missing,PoolOwner,Bind)>0)) {Stats.Grown++; INC_DWORD_STAT(STAT_OBJPool_Grown);}
+		}///
+		//
+		const int32 First = Spawned.Num();
+		Spawned.Reserve(First+Count);
+		//
+		for (int32 I=0; I<Count; ++I) {
+			const FTransform &SpawnTransform = Transforms[I%Transforms.Num()];
+			bool SpawnSuccessful = false;
+			//
+			TActor* Member = BeginDeferredSpawn(WorldContextObject,World,Class,Filter,Policy,PoolOwner,Owner,SpawnOptions,SpawnTransform,CollisionHandlingOverride,Reconstruct,Bind,SpawnSuccessful);
+			if (!SpawnSuccessful) {break;}
+			//
+			FinishDeferredSpawn(Member,Reconstruct,SpawnTransform);
+			if (Member->Spawned) {Spawned.Add(Member);}
+		} return Spawned.Num()-First;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Telemetry:: 'stat OBJPool'
+
+DECLARE_STATS_GROUP(TEXT("OBJPool"),STATGROUP_OBJPool,STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn From Pool"),STAT_OBJPool_Spawn,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grow Pool"),STAT_OBJPool_Grow,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Trim Pool"),STAT_OBJPool_Trim,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Expire Life Spans"),STAT_OBJPool_LifeSpan,STATGROUP_OBJPool,OBJPOOL_API);
+
+/// Per frame counters; reset every frame.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawns"),STAT_OBJPool_Spawns,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Returns"),STAT_OBJPool_Returns,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instantiated"),STAT_OBJPool_Instantiated,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Growth Events"),STAT_OBJPool_Grown,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Trimmed"),STAT_OBJPool_Trimmed,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Recycled (Never Fail)"),STAT_OBJPool_Recycled,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawn Failures"),STAT_OBJPool_Failures,STATGROUP_OBJPool,OBJPOOL_API);
+
+/// Totals of every Pool in Game Worlds; sampled once per frame while stats or a CSV capture are being collected.
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pools"),STAT_OBJPool_Pools,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Members"),STAT_OBJPool_Members,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Members Active"),STAT_OBJPool_Active,STATGROUP_OBJPool,OBJPOOL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Members Inactive"),STAT_OBJPool_Inactive,STATGROUP_OBJPool,OBJPOOL_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(OBJPOOL_API,OBJPool);
+
+/// Samples Pool totals into 'stat OBJPool' and the CSV Profiler. Registered on the Core Ticker by the module.
+bool TickPoolTelemetry(float DeltaTime);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "PoolSpawnOptions.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "PoolActivation.generated.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AActor;
+class UActorComponent;
+class UPrimitiveComponent;
+class UParticleSystemComponent;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Activation:: Component Toggling
+
+/// How a component is toggled on Spawn and Return.
+enum class EPoolActivationRole : uint8 {
+	Component,
+	Particle,
+	Primitive,
+	Body
+};
+
+///  Activation Layout;
+/// The role of each component a Template Class defines, by component name; resolved once per class and shared by all of its members.
+/// Components added to an instance at runtime are not part of the layout, members sort those by type themselves.
+struct OBJPOOL_API FPoolActivationLayout {
+private:
+	TMap<FName,EPoolActivationRole> Roles;
+public:
+	/// Returns the role of a component, sorting it by type on first sight if the class defines it.
+	EPoolActivationRole GetRole(const UActorComponent* Component);
+	//
+	/// Layout of a Template Class; game thread only.
+	static FPoolActivationLayout &Get(const UClass* Class);
+	//
+	/// Role of a component, from its type.
+	static EPoolActivationRole Sort(const UActorComponent* Component);
+};
+
+///  Activation Plan;
+/// The components of a Pool member, sorted by how they are toggled on Spawn and Return.
+/// Members replay their plan instead of gathering and type-casting every component on each request; roles come from the layout of their class.
+/// The plan is resolved again when the component set of its member changes: components added, or any planned component destroyed (Reconstruct included).
+USTRUCT()
+struct OBJPOOL_API FPoolActivationPlan {
+	GENERATED_USTRUCT_BODY()
+private:
+	/// Every component; activation and tick.
+	UPROPERTY(Transient)
+	TArray<TWeakObjectPtr<UActorComponent>> Components;
+	//
+	/// Particle Systems; restarted on Spawn, stopped on Return.
+	UPROPERTY(Transient)
+	TArray<TWeakObjectPtr<UParticleSystemComponent>> Particles;
+	//
+	/// Primitives other than Particle Systems; visibility and tick.
+	UPROPERTY(Transient)
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Primitives;
+	//
+	/// Primitives with a physics body; velocity and simulation are reset.
+	UPROPERTY(Transient)
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Bodies;
+	//
+	/// Size of the component set this plan was resolved from.
+	int32 Resolved = INDEX_NONE;
+	//
+	/// True if the plan still matches the component set of its member.
+	bool IsCurrent(const TSet<UActorComponent*> &Owned) const;
+public:
+	/// Sorts the components of Owner; does nothing while its component set is unchanged.
+	void Resolve(const AActor* Owner);
+	//
+	/// Forces the next Resolve() to sort components again.
+	FORCEINLINE void Invalidate() {Resolved = INDEX_NONE;}
+	//
+	/// Initialize & Return: stops Particles, deactivates components, resets physics and hides Primitives.
+	void Deactivate(const bool ComponentTick) const;
+	//
+	/// Spawn from Pool: applies Spawn Options to Primitives and shows them.
+	void Show(const FPoolSpawnOptions &SpawnOptions) const;
+	//
+	/// Finish Spawn from Pool: activates components and restarts Particles.
+	void Activate(const bool ComponentTick) const;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
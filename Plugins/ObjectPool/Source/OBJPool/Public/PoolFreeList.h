@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Free-List:: Slot Bookkeeping
+
+/// Tracks which slots of a Pool's storage array are Inactive (Free-List) and which are Spawned (Active-Set).
+/// Every slot remembers its own position inside the list it currently belongs to, so moving a member
+/// between lists, or popping the next inactive member, costs O(1) regardless of how big the Pool is.
+/// Slot indices map 1:1 to the owning Pool's storage array; the storage itself is not touched here.
+struct FPoolFreeList {
+private:
+	/// Slots ready to be spawned; the top of the stack is the next candidate.
+	TArray<int32> Free;
+	//
+	/// Slots currently spawned.
+	TArray<int32> Active;
+	//
+	/// Per-slot position inside 'Free' or 'Active'. INDEX_NONE marks a dead slot.
+	TArray<int32> Links;
+	//
+	/// Per-slot flag telling which list 'Links' points into.
+	TBitArray<> Spawned;
+	//
+	int32 DeadSlots = 0;
+	//
+	//
+	FORCEINLINE void Unlink(const int32 Slot) {
+		TArray<int32> &List = Spawned[Slot] ? Active : Free;
+		const int32 Position = Links[Slot];
+		const int32 Moved = List.Last();
+		//
+		List[Position] = Moved; Links[Moved] = Position;
+		List.Pop(false); Links[Slot] = INDEX_NONE;
+	}
+	//
+	FORCEINLINE void Link(const int32 Slot, const bool IsSpawned) {
+		Spawned[Slot] = IsSpawned;
+		Links[Slot] = (IsSpawned ? Active : Free).Add(Slot);
+	}
+public:
+	/// Appends a new slot to the end of storage, linked as Inactive. Returns the new slot index.
+	FORCEINLINE int32 AddSlot() {
+		const int32 Slot = Links.Add(INDEX_NONE);
+		Spawned.Add(false);
+		//
+		Link(Slot,false);
+	return Slot;}
+	//
+	/// Moves a slot from the Free-List into the Active-Set.
+	FORCEINLINE void MarkSpawned(const int32 Slot) {
+		if (!IsLinked(Slot)||Spawned[Slot]) {return;}
+		Unlink(Slot); Link(Slot,true);
+	}
+	//
+	/// Moves a slot from the Active-Set back into the Free-List.
+	FORCEINLINE void MarkInactive(const int32 Slot) {
+		if (!IsLinked(Slot)||!Spawned[Slot]) {return;}
+		Unlink(Slot); Link(Slot,false);
+	}
+	//
+	/// Unlinks a slot whose member died; the slot stays a hole in storage until the Pool is compacted.
+	FORCEINLINE void KillSlot(const int32 Slot) {
+		if (!IsLinked(Slot)) {return;}
+		Unlink(Slot); DeadSlots++;
+	}
+	//
+	FORCEINLINE void Reset(const int32 ExpectedSlots=0) {
+		Free.Reset(ExpectedSlots);
+		Active.Reset(ExpectedSlots);
+		Links.Reset(ExpectedSlots);
+		Spawned.Empty(ExpectedSlots);
+		DeadSlots = 0;
+	}
+	//
+	//
+	FORCEINLINE bool IsValidSlot(const int32 Slot) const {return Links.IsValidIndex(Slot);}
+	FORCEINLINE bool IsLinked(const int32 Slot) const {return IsValidSlot(Slot)&&(Links[Slot]!=INDEX_NONE);}
+	FORCEINLINE bool IsSpawned(const int32 Slot) const {return IsLinked(Slot)&&Spawned[Slot];}
+	//
+	FORCEINLINE int32 NumSlots() const {return Links.Num();}
+	FORCEINLINE int32 NumFree() const {return Free.Num();}
+	FORCEINLINE int32 NumActive() const {return Active.Num();}
+	FORCEINLINE int32 NumDead() const {return DeadSlots;}
+	//
+	/// Slots ordered from bottom to top; the last entry is the most recently pushed one.
+	FORCEINLINE const TArray<int32> &GetFree() const {return Free;}
+	FORCEINLINE const TArray<int32> &GetActive() const {return Active;}
+	//
+	//
+	/// Checks that every slot is linked exactly once, into the list its flag names, at the position it remembers; and that dead slots add up.
+	/// Returns false with a description of the first broken invariant. For tests, walks every slot.
+	bool Validate(FString &Error) const {
+		if (Spawned.Num()!=Links.Num()) {Error=FString::Printf(TEXT("%i flags for %i slots"),Spawned.Num(),Links.Num()); return false;}
+		if (Free.Num()+Active.Num()+DeadSlots!=Links.Num()) {Error=FString::Printf(TEXT("%i free + %i active + %i dead != %i slots"),Free.Num(),Active.Num(),DeadSlots,Links.Num()); return false;}
+		//
+		for (int32 Position=0; Position<Free.Num(); ++Position) {
+			const int32 Slot = Free[Position];
+			if (!IsValidSlot(Slot)||(Links[Slot]!=Position)||Spawned[Slot]) {Error=FString::Printf(TEXT("free slot %i at %i is not linked there"),Slot,Position); return false;}
+		}///
+		//
+		for (int32 Position=0; Position<Active.Num(); ++Position) {
+			const int32 Slot = Active[Position];
+			if (!IsValidSlot(Slot)||(Links[Slot]!=Position)||!Spawned[Slot]) {Error=FString::Printf(TEXT("active slot %i at %i is not linked there"),Slot,Position); return false;}
+		}///
+		//
+		return true;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Engine/World.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PoolLifeSpan.generated.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Life Span:: Expiry Wheel
+
+/// Life Span of a Pool member, as scheduled on its World's expiry wheel.
+struct FPoolLifeSpan {
+	/// World time (seconds) the member goes back to its Pool.
+	double Expiry = 0.0;
+	//
+	/// Bumped on every schedule or clear; wheel entries carrying an older serial are stale and ignored.
+	uint32 Serial = 0;
+	//
+	bool Pending = false;
+};
+
+/// Pool Life Span Subsystem;
+/// Hashed timing wheel returning Pool members to their Pools once their 'Life Span Pool' expires.
+/// Replaces one World Timer per live member: scheduling is O(1) and the whole World is expired in a single batch per frame.
+/// Slots are one frame (at 60Hz) wide; Life Spans longer than a full turn of the wheel wait for their round.
+UCLASS(ClassGroup=Synaptech, Category="Performance")
+class OBJPOOL_API UPoolLifeSpanSubsystem : public UWorldSubsystem, public FTickableGameObject {
+	GENERATED_BODY()
+private:
+	typedef void(*FExpire)(AActor* Member, const uint32 Serial);
+	//
+	struct FEntry {
+		TWeakObjectPtr<AActor> Member;
+		FExpire Expire;
+		uint32 Serial;
+		int32 Rounds;
+	};
+	//
+	struct FDue {
+		TWeakObjectPtr<AActor> Member;
+		FExpire Expire;
+		uint32 Serial;
+	};
+	//
+	static constexpr int32 NumSlots = 256;
+	static constexpr double Resolution = 1.0/60.0;
+	//
+	TArray<FEntry> Slots[NumSlots];
+	TArray<FDue> Due;
+	//
+	/// Last wheel tick expired; INDEX_NONE until the first schedule.
+	int64 Cursor = INDEX_NONE;
+	int32 Entries = 0;
+	//
+	//
+	void Insert(AActor* Member, const double Expiry, const uint32 Serial, FExpire Expire);
+	//
+	template<typename TActor>
+	static void ExpireMember(AActor* Member, const uint32 Serial) {
+		TActor* ACT = static_cast<TActor*>(Member);
+		if ((!ACT->LifeSpan.Pending)||(ACT->LifeSpan.Serial!=Serial)) {return;}
+		//
+		ACT->LifeSpan.Pending = false;
+		ACT->ReturnToPool();
+	}
+public:
+	/// Schedules Member to return to its Pool in Seconds; replaces any Life Span it already had.
+	template<typename TActor>
+	static void Schedule(TActor* Member, const float Seconds) {
+		UWorld* World = Member->GetWorld();
+		UPoolLifeSpanSubsystem* Wheel = World ? World->GetSubsystem<UPoolLifeSpanSubsystem>() : nullptr;
+		if (Wheel==nullptr) {return;}
+		//
+		FPoolLifeSpan &Span = Member->LifeSpan;
+		Span.Expiry = World->GetTimeSeconds()+Seconds;
+		Span.Pending = true;
+		Span.Serial++;
+		//
+		Wheel->Insert(Member,Span.Expiry,Span.Serial,&ExpireMember<TActor>);
+	}
+	//
+	/// Cancels the Life Span of Member; its wheel entry is dropped lazily.
+	template<typename TActor>
+	static void Clear(TActor* Member) {
+		Member->LifeSpan.Pending = false;
+		Member->LifeSpan.Serial++;
+	}
+	//
+	/// Seconds left before Member returns to its Pool; zero if it has no Life Span.
+	template<typename TActor>
+	static float GetRemaining(const TActor* Member) {
+		const UWorld* World = Member->GetWorld();
+		if ((World==nullptr)||(!Member->LifeSpan.Pending)) {return 0.f;}
+		//
+		return FMath::Max(0.f,(float)(Member->LifeSpan.Expiry-World->GetTimeSeconds()));
+	}
+public:
+	virtual void Deinitialize() override;
+	//
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override {return Entries>0;}
+	virtual UWorld* GetTickableGameObjectWorld() const override {return GetWorld();}
+	virtual TStatId GetStatId() const override {RETURN_QUICK_DECLARE_CYCLE_STAT(UPoolLifeSpanSubsystem,STATGROUP_Tickables);}
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////
+///			Copyright 2019 (C) Bruno Xavier B. Leite
+//////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PoolPrewarm.generated.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Pool Prewarm:: Time-Sliced Initialization
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPoolPrewarmProgress,float);
+
+/// Instantiates up to Count members, stopping once Deadline (FPlatformTime::Seconds) is crossed. Returns how many were instantiated.
+typedef TFunction<int32(const int32 Count, const double Deadline)> FPoolPrewarmStep;
+
+/// A pending Initialization of one Template Class inside one Pool Component.
+struct FPoolPrewarmJob {
+	TWeakObjectPtr<UActorComponent> Pool;
+	TWeakObjectPtr<UClass> Class;
+	//
+	/// Streams in the soft references of Class; members are only instantiated once it completes.
+	TSharedPtr<FStreamableHandle> Preload;
+	//
+	FPoolPrewarmStep Step;
+	TFunction<void()> Finish;
+	//
+	int32 Total = 0;
+	int32 Done = 0;
+};
+
+/// Pool Prewarm Subsystem;
+/// Spreads the Initialization of Pool Components of a World across frames, under the budget set by the project's Pool Settings.
+/// Pool Components only enqueue work here when 'Time-Sliced Prewarm' is enabled; otherwise they keep initializing on the spot.
+UCLASS(ClassGroup=Synaptech, Category="Performance")
+class OBJPOOL_API UPoolPrewarmSubsystem : public UWorldSubsystem, public FTickableGameObject {
+	GENERATED_BODY()
+private:
+	TArray<FPoolPrewarmJob> Jobs;
+	//
+	/// Kept alive for as long as the World lives, so preloaded assets aren't collected before Pools use them.
+	TArray<TSharedPtr<FStreamableHandle>> Preloads;
+	FStreamableManager Streamable;
+	//
+	/// Members expected and instantiated since the queue was last empty; progress is relative to this batch.
+	int32 BatchTotal = 0;
+	int32 BatchDone = 0;
+	float LastProgress = 1.f;
+	//
+	//
+	void Step(int32 Quota, const double Deadline, const UActorComponent* Filter=nullptr, const UClass* ClassFilter=nullptr);
+	void FinishJob(const int32 ID);
+	void BroadcastProgress();
+	//
+	static bool IsLoadingScreenUp();
+public:
+	/// Fired on the Game Thread whenever the prewarm progress (0..1) of this World changes.
+	FOnPoolPrewarmProgress OnPrewarmProgress;
+	//
+	/// Returns the Prewarm Subsystem of Pool's World, if Pools of this project are set to prewarm over time.
+	static UPoolPrewarmSubsystem* Find(const UObject* WorldContextObject);
+	//
+	/// Queues Count members of Class to be instantiated over time by Step; Finish runs once they are all done.
+	void Enqueue(UActorComponent* Pool, UClass* Class, const int32 Count, FPoolPrewarmStep &&Step, TFunction<void()> &&Finish);
+	//
+	/// Drops pending work of Pool for Class and its children; of every Class if Class is null.
+	void Cancel(const UActorComponent* Pool, const UClass* Class=nullptr);
+	//
+	/// Returns true if Pool still has pending work queued.
+	static bool IsPrewarming(const UActorComponent* Pool);
+	//
+	/// Instantiates one pending member of Class for Pool right away, ignoring the frame budget.
+	/// Used by Spawn requests that find the Free-List exhausted while their Pool is still warming up.
+	static void PrewarmOnDemand(const UActorComponent* Pool, const UClass* Class);
+	//
+	/// Completes the pending work of Pool right away, waiting for its preloads if needed; other Pools keep warming up over time.
+	static void CompletePrewarm(const UActorComponent* Pool);
+	//
+	//
+	/// Completes every pending Pool Initialization of this World right away, waiting for preloads if needed.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Flush Pool Prewarm", Keywords="flush prewarm pool"))
+	void FlushPrewarm();
+	//
+	/// Prewarm progress of this World, from 0 to 1. Returns 1 when there's nothing left to prewarm.
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Get Pool Prewarm Progress", Keywords="get prewarm progress"))
+	float GetPrewarmProgress() const;
+	//
+	UFUNCTION(Category="Object Pool", BlueprintCallable, meta=(DisplayName="Is Pool Prewarm Complete", Keywords="prewarm complete"))
+	bool IsPrewarmComplete() const {return Jobs.Num()==0;}
+public:
+	virtual void Deinitialize() override;
+	//
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override {return Jobs.Num()>0;}
+	virtual UWorld* GetTickableGameObjectWorld() const override {return GetWorld();}
+	virtual TStatId GetStatId() const override {RETURN_QUICK_DECLARE_CYCLE_STAT(UPoolPrewarmSubsystem,STATGROUP_Tickables);}
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
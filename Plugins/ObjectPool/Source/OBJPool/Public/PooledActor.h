@@ -8,6 +8,8 @@
 #pragma once
 
 #include "PoolSpawnOptions.h"
+#include "PoolActivation.h"
+#include "PoolLifeSpan.h"
 #include "Runtime/Engine/Public/TimerManager.h"
 #include "Runtime/Engine/Classes/GameFramework/Actor.h"
 
@@ -33,6 +35,8 @@ class OBJPOOL_API APooledActor : public AActor {
 	friend class UPooledProjectile;
 	friend class USharedObjectPool;
 	friend class UPooledSplineProjectile;
+	template<typename> friend struct TPoolCore;
+	friend class UPoolLifeSpanSubsystem;
 protected:
 	/// Finishes Spawning this Actor, after deferred spawning from the Object-Pool.
 	virtual void FinishSpawnFromPool(const bool Reconstruct, const FTransform &Transform);
@@ -47,8 +51,15 @@ protected:
 	UPROPERTY()
 	USharedObjectPool* SharedPool;
 	//
-	UPROPERTY()
-	FTimerHandle LifeSpanHandle;
+	/// Remaining 'Life Span Pool', as scheduled on the World's expiry wheel.
+	FPoolLifeSpan LifeSpan;
+	//
+	/// Index of this Actor within its Pool's storage; maintained by the Pool.
+	int32 PoolSlot;
+	//
+	/// Components of this Actor, sorted by how they are toggled on Spawn and Return.
+	UPROPERTY(Transient)
+	FPoolActivationPlan ActivationPlan;
 public:
 	virtual void Initialize();
 	virtual void BeginPlay() override;
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "PoolSpawnOptions.h"
+#include "PoolActivation.h"
+#include "PoolLifeSpan.h"
 #include "Runtime/Engine/Public/TimerManager.h"
 #include "Runtime/Engine/Classes/GameFramework/Character.h"
 
@@ -29,6 +31,8 @@ class OBJPOOL_API APooledCharacter : public ACharacter {
 	//
 	friend class UCharacterPool;
 	friend class USharedObjectPool;
+	template<typename> friend struct TPoolCore;
+	friend class UPoolLifeSpanSubsystem;
 private:
 	UPROPERTY()
 	UCharacterPool* OwningPool;
@@ -36,8 +40,15 @@ private:
 	UPROPERTY()
 	bool Spawned;
 	//
-	UPROPERTY()
-	FTimerHandle LifeSpanHandle;
+	/// Remaining 'Life Span Pool', as scheduled on the World's expiry wheel.
+	FPoolLifeSpan LifeSpan;
+	//
+	/// Index of this Character within its Pool's storage; maintained by the Pool.
+	int32 PoolSlot;
+	//
+	/// Components of this Character, sorted by how they are toggled on Spawn and Return.
+	UPROPERTY(Transient)
+	FPoolActivationPlan ActivationPlan;
 protected:
 	/// Finishes Spawning this Character, after deferred spawning from the Object-Pool.
 	virtual void FinishSpawnFromPool(const bool Reconstruct, const FTransform& Transform);
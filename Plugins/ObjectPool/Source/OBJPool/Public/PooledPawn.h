@@ -8,6 +8,8 @@
 #pragma once
 
 #include "PoolSpawnOptions.h"
+#include "PoolActivation.h"
+#include "PoolLifeSpan.h"
 #include "Runtime/Engine/Public/TimerManager.h"
 #include "Runtime/Engine/Classes/GameFramework/Pawn.h"
 
@@ -33,6 +35,8 @@ class OBJPOOL_API APooledPawn : public APawn {
 	friend class UPooledProjectile;
 	friend class USharedObjectPool;
 	friend class UPooledSplineProjectile;
+	template<typename> friend struct TPoolCore;
+	friend class UPoolLifeSpanSubsystem;
 private:
 	UPROPERTY()
 	UPawnPool* OwningPool;
@@ -40,8 +44,15 @@ private:
 	UPROPERTY()
 	bool Spawned;
 	//
-	UPROPERTY()
-	FTimerHandle LifeSpanHandle;
+	/// Remaining 'Life Span Pool', as scheduled on the World's expiry wheel.
+	FPoolLifeSpan LifeSpan;
+	//
+	/// Index of this Pawn within its Pool's storage; maintained by the Pool.
+	int32 PoolSlot;
+	//
+	/// Components of this Pawn, sorted by how they are toggled on Spawn and Return.
+	UPROPERTY(Transient)
+	FPoolActivationPlan ActivationPlan;
 protected:
 	/// Finishes Spawning this Pawn, after deferred spawning from the Object-Pool.
 	virtual void FinishSpawnFromPool(const bool Reconstruct, const FTransform &Transform);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "OBJPool.h"
+#include "K2Node_SpawnFromPoolBase.h"
 #include "K2Node_SpawnPawnFromPool.h"
 #include "K2Node_SpawnActorFromPool.h"
 #include "K2Node_SpawnCharacterFromPool.h"
@@ -15,6 +15,61 @@
 #include "TweenManagerComponent.h"
 #include "Utils/Utility.h"
 #include "Tweens/BaseTween.h"
+#include "Utils/TweenStats.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/SceneComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Containers Full Rate"), STAT_TweenContainersFull, STATGROUP_TweenMaker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Containers Reduced Rate"), STAT_TweenContainersReduced, STATGROUP_TweenMaker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Containers Suspended"), STAT_TweenContainersSuspended, STATGROUP_TweenMaker);
+
+static TAutoConsoleVariable<int32> CVarTweenSignificance(
+    TEXT("TweenMaker.Significance"),
+    1,
+    TEXT("If 0, all TweenContainers are updated every frame, even the ones using SetSignificance."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTweenSignificanceEvaluationInterval(
+    TEXT("TweenMaker.Significance.EvaluationInterval"),
+    10,
+    TEXT("Number of frames between two evaluations of the significance of a TweenContainer."),
+    ECVF_Default);
+
+/**
+ * Upper bound on the sequences (or loops) a single update can roll over to, so that a long suspension of short looping Tweens
+ * doesn't cause a spike when it ends. The time left is given at the next update instead.
+ */
+static const int32 MaxRolloversPerUpdate = 16;
+
+/** How recently (in seconds) a target must have been rendered not to be suspended */
+static const float RecentlyRenderedTolerance = 0.2f;
+
+/**
+ * Returns true if the Tween moves, rotates or scales its target. Such a Tween may be what brings the target into view
+ * (or up from a zero scale), so it must keep running even if the target isn't rendered.
+ */
+static bool CanTweenRevealTarget(UBaseTween *pTween)
+{
+    switch(pTween->GetTweenGenericType())
+    {
+        case ETweenGenericType::Move:
+        case ETweenGenericType::Scale:
+        case ETweenGenericType::Rotate:
+        case ETweenGenericType::RotateAroundPoint:
+        case ETweenGenericType::FollowSpline:
+        {
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
 
 UTweenContainer::UTweenContainer(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer),
@@ -23,7 +78,14 @@ UTweenContainer::UTweenContainer(const FObjectInitializer& ObjectInitializer)
       bIsTweenContainerPaused(false),
 	  bIsTweenContainerPendingDeletion(false),
       bHasStartedTweening(false),
-	  bShouldTweenWhileGamePaused(false)
+	  bShouldTweenWhileGamePaused(false),
+      bUseSignificance(false),
+      mSignificanceNearDistance(3000.0f),
+      mReducedRateInterval(4),
+      mSignificance(ETweenSignificance::Full),
+      mFramesUntilSignificanceEvaluation(0),
+      mFramesSinceUpdate(0),
+      mSkippedTime(0.0f)
 {
 
 }
@@ -106,7 +168,81 @@ bool UTweenContainer::UpdateTweens(float pDeltaTime)
 {
     bHasStartedTweening = true;
 
+    float deltaTime = pDeltaTime + mSkippedTime;
+    mSkippedTime = 0.0f;
+
+    if(bUseSignificance && CVarTweenSignificance.GetValueOnGameThread() != 0)
+    {
+        if(--mFramesUntilSignificanceEvaluation <= 0)
+        {
+            mSignificance = EvaluateSignificance();
+            mFramesUntilSignificanceEvaluation = FMath::Max(1, CVarTweenSignificanceEvaluationInterval.GetValueOnGameThread());
+        }
+
+        ++mFramesSinceUpdate;
+
+        const bool bShouldUpdate = mSignificance == ETweenSignificance::Full ||
+                                   (mSignificance == ETweenSignificance::Reduced && mFramesSinceUpdate >= mReducedRateInterval);
+
+        if(mSignificance == ETweenSignificance::Reduced)
+        {
+            INC_DWORD_STAT(STAT_TweenContainersReduced);
+        }
+        else if(mSignificance == ETweenSignificance::Suspended)
+        {
+            INC_DWORD_STAT(STAT_TweenContainersSuspended);
+        }
+        else
+        {
+            INC_DWORD_STAT(STAT_TweenContainersFull);
+        }
+
+        // The time is kept for the next update, so that the Tweens don't fall behind
+        if(!bShouldUpdate)
+        {
+            mSkippedTime = deltaTime;
+            return false;
+        }
+    }
+    else
+    {
+        INC_DWORD_STAT(STAT_TweenContainersFull);
+    }
+
+    mFramesSinceUpdate = 0;
+
+    // When the current sequence ends (or loops) in the middle of the update, the rest of the time is given to what comes next,
+    // so that the sequences end and loop when they should however long the update is (e.g. after a suspension)
+    float timeToUpdate = deltaTime;
+    bool areSequencesDone = false;
+
+    for(int32 numRollovers = 0; ; ++numRollovers)
+    {
+        float leftoverTime = 0.0f;
+
+        // A sequence that ends has no Tween eased later, so the Tweens can always be deferred
+        areSequencesDone = UpdateSequences(timeToUpdate, true, leftoverTime);
+        timeToUpdate = leftoverTime;
+
+        if(timeToUpdate <= 0.0f || areSequencesDone || bIsTweenContainerPaused || bIsTweenContainerPendingDeletion)
+        {
+            break;
+        }
+
+        if(numRollovers >= MaxRolloversPerUpdate)
+        {
+            mSkippedTime = timeToUpdate;
+            break;
+        }
+    }
+
+    return areSequencesDone;
+}
+
+bool UTweenContainer::UpdateSequences(float pDeltaTime, bool pCanDeferEasing, float &OutLeftoverTime)
+{
     bool areSequencesDone = false;
+    OutLeftoverTime = 0.0f;
 
 	// If the TweenContainer was marked as persistent and it has endend, avoid updating but pretend like it's 
 	// not yet finished, so that the "outer system" won't delete the container!
@@ -118,9 +254,25 @@ bool UTweenContainer::UpdateTweens(float pDeltaTime)
 		// Getting the current FParallelTween object we need to process
 		FParallelTween &parallelTween = mSequences[mCurrentIndex];
 
+		// The updated Tweens are only collected if someone listens to the container update event
+		const bool bShouldBroadcastUpdate = OnTweenContainerUpdate.IsBound() || OnTweenContainerUpdateDelegate.IsBound();
+		mUpdatedTweens.Reset();
+
 		// Updating all parallel Tweens and checking if they're done
-		bool areTweensDone = parallelTween.UpdateParallelTweens(pDeltaTime, mTimeScaleAbsolute);
+		bool areTweensDone = parallelTween.UpdateParallelTweens(pDeltaTime, mTimeScaleAbsolute, bShouldBroadcastUpdate ? &mUpdatedTweens : nullptr,
+                                                                 pCanDeferEasing);
+		OutLeftoverTime = parallelTween.GetLeftoverTime();
 
+		// One event for all Tweens updated in this frame
+		if(bShouldBroadcastUpdate && mUpdatedTweens.Num() > 0)
+		{
+			if(OnTweenContainerUpdate.IsBound())
+			{
+				OnTweenContainerUpdate.Broadcast(this, mUpdatedTweens);
+			}
+
+			OnTweenContainerUpdateDelegate.ExecuteIfBound(this, mUpdatedTweens);
+		}
 
 
 		// If the tweens are done, I need to check if other tweens were added (because of a OnTweenEnd callback).
@@ -199,9 +351,8 @@ bool UTweenContainer::UpdateTweens(float pDeltaTime)
 }
 
 
-void UTweenContainer::RemoveTweensReferences(TMultiMap<TPair<TWeakObjectPtr<UObject>, ETweenGenericType>, TWeakObjectPtr<UBaseTween>> &pTweensReferenceMap)
+void UTweenContainer::RemoveTweensReferences(FTweenReferenceTable &pTweenReferences)
 {
-    // We need to look for the Tweens owned by this TweenContainer in the Map in order to remove the references
     for(int i = 0; i < mSequences.Num(); ++i)
     {
         FParallelTween &parallelTween = mSequences[i];
@@ -210,15 +361,82 @@ void UTweenContainer::RemoveTweensReferences(TMultiMap<TPair<TWeakObjectPtr<UObj
         {
             UBaseTween *tween = parallelTween.ParallelTweens[j];
 
-            const TPair<TWeakObjectPtr<UObject>, ETweenGenericType> *keyPair = pTweensReferenceMap.FindKey(tween);
+            // Each Tween knows its own entry, so there's no need to look for it
+            pTweenReferences.Remove(tween->mTweenReference);
+        }
+    }
+}
+
+ETweenSignificance UTweenContainer::EvaluateSignificance() const
+{
+    UWorld *world = OwningTweenManager != nullptr ? OwningTweenManager->GetWorld() : nullptr;
 
-            // The key is 100% there, but just to be safe
-            if(keyPair != nullptr)
+    // A persistent container that has ended has no current sequence; an empty sequence must be updated to move past it
+    if(world == nullptr || !mSequences.IsValidIndex(mCurrentIndex) || mSequences[mCurrentIndex].ParallelTweens.Num() == 0)
+    {
+        return ETweenSignificance::Full;
+    }
+
+    TArray<FVector, TInlineAllocator<4>> viewLocations;
+
+    for(FConstPlayerControllerIterator iterator = world->GetPlayerControllerIterator(); iterator; ++iterator)
+    {
+        APlayerController *playerController = iterator->Get();
+
+        if(playerController == nullptr || !playerController->IsLocalController())
+        {
+            continue;
+        }
+
+        if(playerController->PlayerCameraManager != nullptr)
+        {
+            viewLocations.Add(playerController->PlayerCameraManager->GetCameraLocation());
+        }
+        else if(APawn *pawn = playerController->GetPawn())
+        {
+            viewLocations.Add(pawn->GetActorLocation());
+        }
+    }
+
+    // Without local players (e.g. on a dedicated server) there's nothing to rate the targets against
+    if(viewLocations.Num() == 0)
+    {
+        return ETweenSignificance::Full;
+    }
+
+    const float nearDistanceSquared = FMath::Square(mSignificanceNearDistance);
+    ETweenSignificance significance = ETweenSignificance::Suspended;
+
+    for(UBaseTween *tween : mSequences[mCurrentIndex].ParallelTweens)
+    {
+        UObject *target = tween->mTargetObject.Get();
+        USceneComponent *component = Cast<USceneComponent>(target);
+        AActor *actor = component != nullptr ? component->GetOwner() : Cast<AActor>(target);
+
+        // Widgets, materials and custom targets can't be rated (and dead targets must be noticed soon)
+        if(actor == nullptr)
+        {
+            return ETweenSignificance::Full;
+        }
+
+        const FVector location = component != nullptr ? component->GetComponentLocation() : actor->GetActorLocation();
+
+        for(const FVector &viewLocation : viewLocations)
+        {
+            if(FVector::DistSquared(location, viewLocation) <= nearDistanceSquared)
             {
-                pTweensReferenceMap.RemoveSingle(*keyPair, tween);
+                return ETweenSignificance::Full;
             }
         }
+
+        // Suspended only if nothing is rendered and nothing could make it rendered
+        if(actor->WasRecentlyRendered(RecentlyRenderedTolerance) || CanTweenRevealTarget(tween))
+        {
+            significance = ETweenSignificance::Reduced;
+        }
     }
+
+    return significance;
 }
 
 bool UTweenContainer::IsPendingDeletion()
@@ -319,6 +537,10 @@ void UTweenContainer::RestartTweenContainer()
 	bIsTweenContainerPaused = false;
 	bAreSequencesDone = false;
 
+    // The time skipped belongs to the run that is being restarted
+    mSkippedTime = 0.0f;
+    mFramesSinceUpdate = 0;
+
 	mLoopCounter = 0;
 
 	// Depending on the container "direction flow", reset the position of each Tween to their starting one.
@@ -444,6 +666,22 @@ bool UTweenContainer::IsPaused()
     return bIsTweenContainerPaused;
 }
 
+void UTweenContainer::SetSignificance(bool pEnable, float pNearDistance, int32 pReducedRateInterval)
+{
+    bUseSignificance = pEnable;
+    mSignificanceNearDistance = FMath::Max(0.0f, pNearDistance);
+    mReducedRateInterval = FMath::Max(1, pReducedRateInterval);
+
+    // Evaluated again at the next update
+    mSignificance = ETweenSignificance::Full;
+    mFramesUntilSignificanceEvaluation = 0;
+}
+
+ETweenSignificance UTweenContainer::GetSignificance()
+{
+    return bUseSignificance && CVarTweenSignificance.GetValueOnGameThread() != 0 ? mSignificance : ETweenSignificance::Full;
+}
+
 
 /*
  **************************************************************************
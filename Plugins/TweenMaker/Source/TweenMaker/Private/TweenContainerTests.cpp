@@ -0,0 +1,86 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TweenContainer.h"
+#include "Tweens/TweenFloat.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ **************************************************************************
+ * Automation tests of the UTweenContainer update.
+ * Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests TweenMaker.Container;Quit"
+ **************************************************************************
+ */
+
+namespace TweenContainerTests
+{
+    /** Creates a looping container of "Custom" TweenFloats played one after the other, one per given duration */
+    UTweenContainer* CreateSequence(const TArray<float> &pDurations, TArray<UTweenFloat*> &OutTweens)
+    {
+        UTweenContainer *tweenContainer = NewObject<UTweenContainer>();
+        tweenContainer->Init(nullptr, 0, ETweenLoopType::Restart, 1.0f);
+
+        for(int32 i = 0; i < pDurations.Num(); ++i)
+        {
+            // Custom Tweens never touch their target, it only has to be valid
+            UTweenFloat *tween = NewObject<UTweenFloat>();
+            tween->InitBase(tweenContainer, i, tween, ETweenTargetType::Custom, ETweenEaseType::Linear, pDurations[i], 0.0f, 1.0f, false);
+            tween->Init(0.0f, 1.0f, ETweenFloatType::Custom, NAME_None, nullptr);
+
+            tweenContainer->AddSequenceTween(tween, i);
+            OutTweens.Add(tween);
+        }
+
+        return tweenContainer;
+    }
+}
+
+
+/**
+ * Plays the same looping sequence (0.4s then 0.6s) in small steps and in a single long update, as after a suspension.
+ * The time going past the end of a Tween must be given to the next one, so both must end up at the same point, without drifting.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenContainerRolloverTest, "TweenMaker.Container.LoopRollover",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenContainerRolloverTest::RunTest(const FString &Parameters)
+{
+    using namespace TweenContainerTests;
+
+    const TArray<float> durations = { 0.4f, 0.6f };
+    const float deltaTime = 0.13f;
+    const int32 numFrames = 20;
+
+    // 2.6 seconds: two full loops, the first Tween of the third loop and 0.2 seconds of the second one
+    const float expectedElapsedTime = 0.2f;
+    const float tolerance = 1e-3f;
+
+    TArray<UTweenFloat*> steppedTweens;
+    TArray<UTweenFloat*> suspendedTweens;
+    UTweenContainer *steppedContainer = CreateSequence(durations, steppedTweens);
+    UTweenContainer *suspendedContainer = CreateSequence(durations, suspendedTweens);
+
+    for(int32 frame = 0; frame < numFrames; ++frame)
+    {
+        steppedContainer->UpdateTweens(deltaTime);
+    }
+
+    suspendedContainer->UpdateTweens(deltaTime * numFrames);
+
+    TestTrue(TEXT("Stepped: the first Tween of the loop is done"), steppedTweens[0]->IsTweenDone());
+    TestTrue(TEXT("Suspended: the first Tween of the loop is done"), suspendedTweens[0]->IsTweenDone());
+
+    TestEqual(TEXT("Stepped: elapsed time of the second Tween"), steppedTweens[1]->GetTweenElapsedTime(), expectedElapsedTime, tolerance);
+    TestEqual(TEXT("Suspended: elapsed time of the second Tween"), suspendedTweens[1]->GetTweenElapsedTime(), expectedElapsedTime, tolerance);
+
+    for(UTweenContainer *tweenContainer : { steppedContainer, suspendedContainer })
+    {
+        tweenContainer->MarkPendingKill();
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenEasingBatch.h"
+#include "Tweens/BaseTween.h"
+#include "Utils/EaseEquations.h"
+#include "Utils/EaseLookupTable.h"
+#include "Utils/TweenParallel.h"
+#include "Utils/TweenStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ease Tweens"), STAT_TweenEaseBatch, STATGROUP_TweenMaker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tweens Eased In Batch"), STAT_TweenEasedInBatch, STATGROUP_TweenMaker);
+
+FTweenEasingBatch* FTweenEasingBatch::ActiveBatch = nullptr;
+
+/** Number of values of ETweenEaseType, i.e. of batches the Tweens can be split into */
+static constexpr int32 NumEaseTypes = (int32)ETweenEaseType::EaseOutInBounce + 1;
+
+
+void FTweenEasingBatch::Open()
+{
+    check(IsInGameThread());
+    ensureMsgf(ActiveBatch == nullptr, TEXT("FTweenEasingBatch: a batch is already open"));
+
+    ActiveBatch = this;
+}
+
+void FTweenEasingBatch::Close()
+{
+    check(IsInGameThread());
+
+    // Closed before applying, so that the Tweens updated by the callbacks fired while applying are eased right away
+    if(ActiveBatch == this)
+    {
+        ActiveBatch = nullptr;
+    }
+
+    const int32 numTweens = mTweens.Num();
+
+    if(numTweens == 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_TweenEaseBatch);
+
+    // Counting sort by ease type: the types are few, and each one becomes a contiguous batch.
+    // The Tweens that changed since they were deferred are left out
+    int32 batchStart[NumEaseTypes + 1] = {};
+
+    for(int32 i = 0; i < numTweens; ++i)
+    {
+        const UBaseTween *tween = mTweens[i].Get();
+
+        if(tween != nullptr && tween->CanFinishDeferredUpdate(mElapsedTimes[i]))
+        {
+            batchStart[(int32)mEaseTypes[i] + 1]++;
+        }
+        else
+        {
+            mTweens[i] = nullptr;
+        }
+    }
+
+    for(int32 type = 1; type <= NumEaseTypes; ++type)
+    {
+        batchStart[type] += batchStart[type - 1];
+    }
+
+    const int32 numEasing = batchStart[NumEaseTypes];
+
+    INC_DWORD_STAT_BY(STAT_TweenEasedInBatch, numEasing);
+
+    mSortedPositions.SetNumUninitialized(numTweens, false);
+    mSortedTweens.SetNumUninitialized(numEasing, false);
+    mSortedTimes.SetNumUninitialized(numEasing, false);
+    mSortedDurations.SetNumUninitialized(numEasing, false);
+    mAlphas.SetNumUninitialized(numEasing, false);
+
+    int32 batchCursor[NumEaseTypes];
+    FMemory::Memcpy(batchCursor, batchStart, sizeof(batchCursor));
+
+    for(int32 i = 0; i < numTweens; ++i)
+    {
+        UBaseTween *tween = mTweens[i].Get();
+
+        if(tween == nullptr)
+        {
+            mSortedPositions[i] = INDEX_NONE;
+            continue;
+        }
+
+        const int32 position = batchCursor[(int32)mEaseTypes[i]]++;
+
+        mSortedPositions[i] = position;
+        mSortedTweens[position] = tween;
+        mSortedTimes[position] = mElapsedTimes[i];
+        mSortedDurations[position] = mDurations[i];
+    }
+
+    // Tables are only baked on the game thread: without this, the worker threads would compute the equations instead
+    for(int32 type = 0; type < NumEaseTypes; ++type)
+    {
+        if(batchStart[type + 1] > batchStart[type])
+        {
+            FEaseLookupTables::FindEaseTable((ETweenEaseType)type);
+        }
+    }
+
+    // Compute phase: the eased progress and the value of each Tween only touch the Tween itself, so they run in parallel chunks
+    TweenParallel::ForEachChunk(numEasing, [this, &batchStart](int32 pStart, int32 pEnd)
+    {
+        // A chunk can span several batches; each one is computed on its part of the chunk
+        for(int32 type = 0; type < NumEaseTypes; ++type)
+        {
+            const int32 start = FMath::Max(batchStart[type], pStart);
+            const int32 end = FMath::Min(batchStart[type + 1], pEnd);
+
+            if(end > start)
+            {
+                EaseEquations::ComputeEasingAlphaBatch((ETweenEaseType)type, end - start, mSortedTimes.GetData() + start,
+                                                       mSortedDurations.GetData() + start, mAlphas.GetData() + start);
+            }
+        }
+
+        for(int32 position = pStart; position < pEnd; ++position)
+        {
+            mSortedTweens[position]->ComputeDeferredValue(mAlphas[position]);
+        }
+    });
+
+    // Apply phase, on the game thread: the values are applied in the order the Tweens were updated, as if they had been eased
+    // one at a time. The callbacks fired while applying (e.g. hit events) may change the Tweens that come after
+    for(int32 i = 0; i < numTweens; ++i)
+    {
+        UBaseTween *tween = mSortedPositions[i] != INDEX_NONE ? mTweens[i].Get() : nullptr;
+
+        if(tween != nullptr && tween->CanFinishDeferredUpdate(mElapsedTimes[i]))
+        {
+            tween->ApplyDeferredValue();
+        }
+    }
+
+    Reset();
+}
+
+void FTweenEasingBatch::Reset()
+{
+    mTweens.Reset();
+    mEaseTypes.Reset();
+    mElapsedTimes.Reset();
+    mDurations.Reset();
+    mTargets.Reset();
+}
+
+bool FTweenEasingBatch::Defer(UBaseTween *pTween, ETweenEaseType pEaseType, float pElapsedTime, float pDuration)
+{
+    if(ActiveBatch == nullptr)
+    {
+        return false;
+    }
+
+    ActiveBatch->mTweens.Add(pTween);
+    ActiveBatch->mEaseTypes.Add(pEaseType);
+    ActiveBatch->mElapsedTimes.Add(pElapsedTime);
+    ActiveBatch->mDurations.Add(pDuration);
+    ActiveBatch->mTargets.Add(pTween->GetTweenTarget());
+
+    return true;
+}
+
+void FTweenEasingBatch::FlushTarget(const UObject *pTarget)
+{
+    if(ActiveBatch == nullptr || pTarget == nullptr || !ActiveBatch->mTargets.Contains(pTarget))
+    {
+        return;
+    }
+
+    FTweenEasingBatch &batch = *ActiveBatch;
+    batch.mTargets.Remove(pTarget);
+
+    for(int32 i = 0; i < batch.mTweens.Num(); ++i)
+    {
+        UBaseTween *tween = batch.mTweens[i].Get();
+
+        if(tween == nullptr || tween->GetTweenTarget() != pTarget)
+        {
+            continue;
+        }
+
+        // Left out of the batch from now on: it's applied here, in its place in the update order
+        batch.mTweens[i] = nullptr;
+
+        if(tween->CanFinishDeferredUpdate(batch.mElapsedTimes[i]))
+        {
+            float alpha = 0.0f;
+            EaseEquations::ComputeEasingAlphaBatch(batch.mEaseTypes[i], 1, &batch.mElapsedTimes[i], &batch.mDurations[i], &alpha);
+
+            tween->ComputeDeferredValue(alpha);
+            tween->ApplyDeferredValue();
+        }
+    }
+}
@@ -509,6 +509,48 @@ UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenCustomFloat(UTweenContainer
 }
 
 
+/*
+ **************************************************************************
+ * "Play" methods
+ **************************************************************************
+ */
+
+FTweenHandle UTweenFloatStandardFactory::BP_PlayTweenMaterialFloatFromTo(UTweenManagerComponent *pTweenManagerComponent, UMaterialInstanceDynamic *pTweenTarget,
+                                                                         FName pParameterName, float pFrom, float pTo,
+                                                                         float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                         float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenFloat(pTweenManagerComponent, ETweenFloatType::MaterialScalarFromTo, pTweenTarget, ETweenTargetType::Material, pFrom, pTo,
+                           pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused, pParameterName);
+}
+
+FTweenHandle UTweenFloatStandardFactory::BP_PlayTweenMaterialFloatTo(UTweenManagerComponent *pTweenManagerComponent, UMaterialInstanceDynamic *pTweenTarget,
+                                                                     FName pParameterName, float pTo,
+                                                                     float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenFloat(pTweenManagerComponent, ETweenFloatType::MaterialScalarTo, pTweenTarget, ETweenTargetType::Material, 0.0f, pTo,
+                           pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused, pParameterName);
+}
+
+FTweenHandle UTweenFloatStandardFactory::BP_PlayTweenWidgetAngleTo(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                   float pTo,
+                                                                   float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                   float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenFloat(pTweenManagerComponent, ETweenFloatType::WidgetAngleTo, pTweenTarget, ETweenTargetType::UMG, 0.0f, pTo,
+                           pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused, NAME_None);
+}
+
+FTweenHandle UTweenFloatStandardFactory::BP_PlayTweenWidgetOpacityTo(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                     float pTo,
+                                                                     float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenFloat(pTweenManagerComponent, ETweenFloatType::WidgetOpacityTo, pTweenTarget, ETweenTargetType::UMG, 0.0f, pTo,
+                           pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused, NAME_None);
+}
+
 /*
  **************************************************************************
  * Helper methods that create the actual Tweens
@@ -706,3 +748,21 @@ UTweenFloat* UTweenFloatStandardFactory::CreateJoinTweenFollowSpline(UTweenConta
     return outTween;
 }
 
+FTweenHandle UTweenFloatStandardFactory::StoreTweenFloat(UTweenManagerComponent *pTweenManagerComponent, ETweenFloatType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                                         float pFrom, float pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                         float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused, FName pParameterName)
+{
+    // Same as the "Create" methods: if no TweenManager is passed, the global TweenManager (if present) is used
+    FTweenStore *tweenStore = pTweenManagerComponent != nullptr ? &pTweenManagerComponent->GetTweenStore() : UTweenManagerComponent::GetTweenStoreStatic();
+
+    if(tweenStore == nullptr || pTarget == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenFloatStandardFactory::StoreTweenFloat() -> the Tween couldn't be stored because %s was null."),
+               tweenStore == nullptr ? TEXT("the TweenManager") : TEXT("the target"));
+        return FTweenHandle();
+    }
+
+    const FTweenStoreParams params(pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+
+    return tweenStore->AddFloat(pTarget, pTargetType, pTweenType, pFrom, pTo, params, pParameterName);
+}
@@ -115,6 +115,30 @@ UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenMaterialVectorT
 }
 
 
+/*
+ **************************************************************************
+ * "Play" methods
+ **************************************************************************
+ */
+
+FTweenHandle UTweenLinearColorStandardFactory::BP_PlayTweenMaterialVectorFromTo(UTweenManagerComponent *pTweenManagerComponent, UMaterialInstanceDynamic *pTweenTarget,
+                                                                                FName pParameterName, FLinearColor pFrom, FLinearColor pTo,
+                                                                                float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                                float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenLinearColor(pTweenManagerComponent, ETweenLinearColorType::MaterialVectorFromTo, pTweenTarget, pParameterName, pFrom, pTo,
+                                 pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenLinearColorStandardFactory::BP_PlayTweenMaterialVectorTo(UTweenManagerComponent *pTweenManagerComponent, UMaterialInstanceDynamic *pTweenTarget,
+                                                                            FName pParameterName, FLinearColor pTo,
+                                                                            float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                            float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenLinearColor(pTweenManagerComponent, ETweenLinearColorType::MaterialVectorTo, pTweenTarget, pParameterName, FLinearColor::Black, pTo,
+                                 pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
 /*
  **************************************************************************
  * Helper methods that create the actual Tweens
@@ -181,3 +205,22 @@ UTweenLinearColor* UTweenLinearColorStandardFactory::CreateJoinTweenMaterialVect
 
     return outTween;
 }
+
+FTweenHandle UTweenLinearColorStandardFactory::StoreTweenLinearColor(UTweenManagerComponent *pTweenManagerComponent, ETweenLinearColorType pTweenType, UObject *pTarget, FName pParameterName,
+                                                                     const FLinearColor &pFrom, const FLinearColor &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                                                     ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    // Same as the "Create" methods: if no TweenManager is passed, the global TweenManager (if present) is used
+    FTweenStore *tweenStore = pTweenManagerComponent != nullptr ? &pTweenManagerComponent->GetTweenStore() : UTweenManagerComponent::GetTweenStoreStatic();
+
+    if(tweenStore == nullptr || pTarget == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenLinearColorStandardFactory::StoreTweenLinearColor() -> the Tween couldn't be stored because %s was null."),
+               tweenStore == nullptr ? TEXT("the TweenManager") : TEXT("the target"));
+        return FTweenHandle();
+    }
+
+    const FTweenStoreParams params(pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+
+    return tweenStore->AddLinearColor(pTarget, pParameterName, pTweenType, pFrom, pTo, params);
+}
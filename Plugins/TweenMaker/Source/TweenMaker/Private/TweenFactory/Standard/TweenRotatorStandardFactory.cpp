@@ -200,6 +200,48 @@ UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateSceneComponentBy(
 }
 
 
+/*
+ **************************************************************************
+ * "Play" methods
+ **************************************************************************
+ */
+
+FTweenHandle UTweenRotatorStandardFactory::BP_PlayTweenRotateActorTo(UTweenManagerComponent *pTweenManagerComponent, AActor *pTweenTarget,
+                                                                     FRotator pTo,
+                                                                     float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenRotator(pTweenManagerComponent, ETweenRotatorType::RotateTo, pTweenTarget, ETweenTargetType::Actor, FRotator::ZeroRotator, pTo,
+                             pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenRotatorStandardFactory::BP_PlayTweenRotateActorBy(UTweenManagerComponent *pTweenManagerComponent, AActor *pTweenTarget,
+                                                                     FRotator pBy,
+                                                                     float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenRotator(pTweenManagerComponent, ETweenRotatorType::RotateBy, pTweenTarget, ETweenTargetType::Actor, FRotator::ZeroRotator, pBy,
+                             pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenRotatorStandardFactory::BP_PlayTweenRotateSceneComponentTo(UTweenManagerComponent *pTweenManagerComponent, USceneComponent *pTweenTarget,
+                                                                              FRotator pTo,
+                                                                              float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                              float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenRotator(pTweenManagerComponent, ETweenRotatorType::RotateTo, pTweenTarget, ETweenTargetType::SceneComponent, FRotator::ZeroRotator, pTo,
+                             pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenRotatorStandardFactory::BP_PlayTweenRotateSceneComponentBy(UTweenManagerComponent *pTweenManagerComponent, USceneComponent *pTweenTarget,
+                                                                              FRotator pBy,
+                                                                              float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                              float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenRotator(pTweenManagerComponent, ETweenRotatorType::RotateBy, pTweenTarget, ETweenTargetType::SceneComponent, FRotator::ZeroRotator, pBy,
+                             pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
 /*
  **************************************************************************
  * Helper methods that create the actual Tweens
@@ -268,3 +310,21 @@ UTweenRotator* UTweenRotatorStandardFactory::CreateJoinTweenRotator(UTweenContai
     return outTween;
 }
 
+FTweenHandle UTweenRotatorStandardFactory::StoreTweenRotator(UTweenManagerComponent *pTweenManagerComponent, ETweenRotatorType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                                             const FRotator &pFrom, const FRotator &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                                             ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    // Same as the "Create" methods: if no TweenManager is passed, the global TweenManager (if present) is used
+    FTweenStore *tweenStore = pTweenManagerComponent != nullptr ? &pTweenManagerComponent->GetTweenStore() : UTweenManagerComponent::GetTweenStoreStatic();
+
+    if(tweenStore == nullptr || pTarget == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenRotatorStandardFactory::StoreTweenRotator() -> the Tween couldn't be stored because %s was null."),
+               tweenStore == nullptr ? TEXT("the TweenManager") : TEXT("the target"));
+        return FTweenHandle();
+    }
+
+    const FTweenStoreParams params(pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+
+    return tweenStore->AddRotator(pTarget, pTargetType, pTweenType, pFrom, pTo, params);
+}
@@ -276,6 +276,57 @@ UTweenVector2D* UTweenVector2DStandardFactory::BP_JoinTweenCustomVector2D(UTween
 }
 
 
+/*
+ **************************************************************************
+ * "Play" methods
+ **************************************************************************
+ */
+
+FTweenHandle UTweenVector2DStandardFactory::BP_PlayTweenMoveWidgetTo(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                     FVector2D pTo,
+                                                                     float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector2D(pTweenManagerComponent, ETweenVector2DType::MoveTo, pTweenTarget, ETweenTargetType::UMG, FVector2D(0, 0), pTo,
+                              pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVector2DStandardFactory::BP_PlayTweenMoveWidgetBy(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                     FVector2D pBy,
+                                                                     float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector2D(pTweenManagerComponent, ETweenVector2DType::MoveBy, pTweenTarget, ETweenTargetType::UMG, FVector2D(0, 0), pBy,
+                              pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVector2DStandardFactory::BP_PlayTweenScaleWidgetTo(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                      FVector2D pTo,
+                                                                      float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                      float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector2D(pTweenManagerComponent, ETweenVector2DType::ScaleTo, pTweenTarget, ETweenTargetType::UMG, FVector2D(0, 0), pTo,
+                              pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVector2DStandardFactory::BP_PlayTweenScaleWidgetBy(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                      FVector2D pBy,
+                                                                      float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                      float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector2D(pTweenManagerComponent, ETweenVector2DType::ScaleBy, pTweenTarget, ETweenTargetType::UMG, FVector2D(0, 0), pBy,
+                              pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVector2DStandardFactory::BP_PlayTweenShearWidgetTo(UTweenManagerComponent *pTweenManagerComponent, UWidget *pTweenTarget,
+                                                                      FVector2D pTo,
+                                                                      float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                      float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector2D(pTweenManagerComponent, ETweenVector2DType::ShearTo, pTweenTarget, ETweenTargetType::UMG, FVector2D(0, 0), pTo,
+                              pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
 /*
  **************************************************************************
  * Helper methods that create the actual Tweens
@@ -340,3 +391,22 @@ UTweenVector2D* UTweenVector2DStandardFactory::CreateJoinTweenVector2D(UTweenCon
 
     return outTween;
 }
+
+FTweenHandle UTweenVector2DStandardFactory::StoreTweenVector2D(UTweenManagerComponent *pTweenManagerComponent, ETweenVector2DType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                                               const FVector2D &pFrom, const FVector2D &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                                               ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    // Same as the "Create" methods: if no TweenManager is passed, the global TweenManager (if present) is used
+    FTweenStore *tweenStore = pTweenManagerComponent != nullptr ? &pTweenManagerComponent->GetTweenStore() : UTweenManagerComponent::GetTweenStoreStatic();
+
+    if(tweenStore == nullptr || pTarget == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector2DStandardFactory::StoreTweenVector2D() -> the Tween couldn't be stored because %s was null."),
+               tweenStore == nullptr ? TEXT("the TweenManager") : TEXT("the target"));
+        return FTweenHandle();
+    }
+
+    const FTweenStoreParams params(pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+
+    return tweenStore->AddVector2D(pTarget, pTargetType, pTweenType, pFrom, pTo, params);
+}
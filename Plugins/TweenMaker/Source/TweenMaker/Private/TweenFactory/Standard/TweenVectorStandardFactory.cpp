@@ -369,6 +369,84 @@ UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenCustomVector(UTweenContai
     return CreateJoinTweenVector(pTweenContainer, tweenType, pTweenTarget, targetType, pFrom, pTo, pDuration, pEaseType, false, false, pDelay, pTimeScale, pTweenWhileGameIsPaused, pSequenceIndex);
 }
 
+/*
+ **************************************************************************
+ * "Play" methods
+ **************************************************************************
+ */
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenMoveActorTo(UTweenManagerComponent *pTweenManagerComponent, AActor *pTweenTarget,
+                                                                  FVector pTo,
+                                                                  float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                  float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::MoveTo, pTweenTarget, ETweenTargetType::Actor, FVector(0, 0, 0), pTo,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenMoveActorBy(UTweenManagerComponent *pTweenManagerComponent, AActor *pTweenTarget,
+                                                                  FVector pBy,
+                                                                  float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                  float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::MoveBy, pTweenTarget, ETweenTargetType::Actor, FVector(0, 0, 0), pBy,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenScaleActorTo(UTweenManagerComponent *pTweenManagerComponent, AActor *pTweenTarget,
+                                                                   FVector pTo,
+                                                                   float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                   float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::ScaleTo, pTweenTarget, ETweenTargetType::Actor, FVector(0, 0, 0), pTo,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenScaleActorBy(UTweenManagerComponent *pTweenManagerComponent, AActor *pTweenTarget,
+                                                                   FVector pBy,
+                                                                   float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                   float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::ScaleBy, pTweenTarget, ETweenTargetType::Actor, FVector(0, 0, 0), pBy,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenMoveSceneComponentTo(UTweenManagerComponent *pTweenManagerComponent, USceneComponent *pTweenTarget,
+                                                                           FVector pTo,
+                                                                           float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                           float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::MoveTo, pTweenTarget, ETweenTargetType::SceneComponent, FVector(0, 0, 0), pTo,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenMoveSceneComponentBy(UTweenManagerComponent *pTweenManagerComponent, USceneComponent *pTweenTarget,
+                                                                           FVector pBy,
+                                                                           float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                           float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::MoveBy, pTweenTarget, ETweenTargetType::SceneComponent, FVector(0, 0, 0), pBy,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenScaleSceneComponentTo(UTweenManagerComponent *pTweenManagerComponent, USceneComponent *pTweenTarget,
+                                                                            FVector pTo,
+                                                                            float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                            float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::ScaleTo, pTweenTarget, ETweenTargetType::SceneComponent, FVector(0, 0, 0), pTo,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
+FTweenHandle UTweenVectorStandardFactory::BP_PlayTweenScaleSceneComponentBy(UTweenManagerComponent *pTweenManagerComponent, USceneComponent *pTweenTarget,
+                                                                            FVector pBy,
+                                                                            float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                                                            float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    return StoreTweenVector(pTweenManagerComponent, ETweenVectorType::ScaleBy, pTweenTarget, ETweenTargetType::SceneComponent, FVector(0, 0, 0), pBy,
+                            pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+}
+
 /*
  **************************************************************************
  * Helper methods that create the actual Tweens
@@ -437,3 +515,22 @@ UTweenVector* UTweenVectorStandardFactory::CreateJoinTweenVector(UTweenContainer
 
     return outTween;
 }
+
+FTweenHandle UTweenVectorStandardFactory::StoreTweenVector(UTweenManagerComponent *pTweenManagerComponent, ETweenVectorType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                                           const FVector &pFrom, const FVector &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                                           ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused)
+{
+    // Same as the "Create" methods: if no TweenManager is passed, the global TweenManager (if present) is used
+    FTweenStore *tweenStore = pTweenManagerComponent != nullptr ? &pTweenManagerComponent->GetTweenStore() : UTweenManagerComponent::GetTweenStoreStatic();
+
+    if(tweenStore == nullptr || pTarget == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVectorStandardFactory::StoreTweenVector() -> the Tween couldn't be stored because %s was null."),
+               tweenStore == nullptr ? TEXT("the TweenManager") : TEXT("the target"));
+        return FTweenHandle();
+    }
+
+    const FTweenStoreParams params(pDuration, pEaseType, pNumLoops, pLoopType, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+
+    return tweenStore->AddVector(pTarget, pTargetType, pTweenType, pFrom, pTo, params);
+}
@@ -1,18 +1,23 @@
 // Copyright 2018 Francesco Desogus. All Rights Reserved.
 
 #include "TweenMaker.h"
+#include "Utils/EaseLookupTable.h"
+#include "Utils/SplineArcLengthTable.h"
 
 #define LOCTEXT_NAMESPACE "FTweenMakerModule"
 
 void FTweenMakerModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FEaseLookupTables::Initialize();
 }
 
 void FTweenMakerModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FEaseLookupTables::Shutdown();
+	FSplineArcLengthTables::InvalidateAll();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -11,7 +11,8 @@ UTweenManagerComponent* ATweenManagerActor::Instance = nullptr;
 
 ATweenManagerActor::ATweenManagerActor()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// The Tweens are updated by the UTweenWorldSubsystem, the Actor itself has nothing to do every frame
+	PrimaryActorTick.bCanEverTick = false;
 }
 
 
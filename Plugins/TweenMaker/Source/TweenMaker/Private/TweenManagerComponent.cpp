@@ -2,6 +2,7 @@
 
 #include "TweenManagerComponent.h"
 #include "TweenManagerActor.h"
+#include "TweenWorldSubsystem.h"
 #include "Tweens/BaseTween.h"
 #include "Tweens/TweenVector.h"
 #include "Tweens/TweenVector2D.h"
@@ -11,11 +12,11 @@
 #include "Utils/Utility.h"
 #include "Utils/TweenEnums.h"
 #include "TweenContainer.h"
-#include "Kismet/GameplayStatics.h"
 
 UTweenManagerComponent::UTweenManagerComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // All TweenManagers are updated by the UTweenWorldSubsystem, from a single tick function
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UTweenManagerComponent::BeginPlay()
@@ -23,13 +24,25 @@ void UTweenManagerComponent::BeginPlay()
     Super::BeginPlay();
 
     mTweenContainers.Reset();
-	SetTickableWhenPaused(true);
+
+    if(UTweenWorldSubsystem *tweenSubsystem = UTweenWorldSubsystem::Get(this))
+    {
+        tweenSubsystem->RegisterTweenManager(this);
+    }
 }
 
-void UTweenManagerComponent::TickComponent(float pDeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UTweenManagerComponent::EndPlay(const EEndPlayReason::Type pEndPlayReason)
 {
-    Super::TickComponent(pDeltaTime, TickType, ThisTickFunction);
+    if(UTweenWorldSubsystem *tweenSubsystem = UTweenWorldSubsystem::Get(this))
+    {
+        tweenSubsystem->UnregisterTweenManager(this);
+    }
 
+    Super::EndPlay(pEndPlayReason);
+}
+
+void UTweenManagerComponent::UpdateTweens(float pDeltaTime, bool pIsGamePaused)
+{
     // Iterating all TweenContainers backward, so that they can be removed in the for itself if needed
     for(int i = mTweenContainers.Num() - 1; i >= 0; --i)
     {
@@ -41,7 +54,7 @@ void UTweenManagerComponent::TickComponent(float pDeltaTime, ELevelTick TickType
             DestroyTweenContainer(tweenContainer, i);
         }
         // Updating the TweenContainer, but only if it's not paused
-        else if(!tweenContainer->IsPaused() && (!UGameplayStatics::IsGamePaused(GetWorld()) || tweenContainer->bShouldTweenWhileGamePaused))
+        else if(!tweenContainer->IsPaused() && (!pIsGamePaused || tweenContainer->bShouldTweenWhileGamePaused))
         {
             bool bIsDone = tweenContainer->UpdateTweens(pDeltaTime);
 
@@ -53,6 +66,9 @@ void UTweenManagerComponent::TickComponent(float pDeltaTime, ELevelTick TickType
             }
         }
     }
+
+    // The stored Tweens are all updated in one go, lane by lane
+    mTweenStore.Update(pDeltaTime, pIsGamePaused);
 }
 
 
@@ -77,6 +93,9 @@ int32 UTweenManagerComponent::DeleteAllTweens()
         DestroyTweenContainer(tweenContainer, i);
     }
 
+    tweensDeleted += mTweenStore.Num();
+    mTweenStore.Reset();
+
     return tweensDeleted;
 }
 
@@ -85,58 +104,19 @@ bool UTweenManagerComponent::DeleteAllTweensByObject(UObject *pTweenTarget, ETwe
 {
     bool hasDeletedSomething = false;
 
-    switch(pTweensType)
-    {
-        case ETweenGenericType::Any:
-        {
-            // Looking for the specific pair in the reference map
-            for(auto iterator = mTweensByObjectMap.CreateIterator(); iterator; ++iterator)
-            {
-                TPair<TWeakObjectPtr<UObject>, ETweenGenericType> currentPair = iterator.Key();
-
-                if(currentPair.Key == pTweenTarget)
-                {
-                    TArray<TWeakObjectPtr<UBaseTween>> tweensToRemove;
-                    mTweensByObjectMap.MultiFind(currentPair, tweensToRemove);
-
-                    for(int i = 0; i < tweensToRemove.Num(); ++i)
-                    {
-                        TWeakObjectPtr<UBaseTween> tween = tweensToRemove[i];
-
-                        if(tween.IsValid())
-                        {
-                            tween.Get()->DeleteTween();
-                            hasDeletedSomething = true;
-                        }
-                    }
-
-                    mTweensByObjectMap.Remove(currentPair);
-                }
-            }
-            break;
-        }
-        default:
-        {
-            TPair<TWeakObjectPtr<UObject>, ETweenGenericType> pairToFind = TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, pTweensType);
-
-            TArray<TWeakObjectPtr<UBaseTween>> tweensToRemove;
-            mTweensByObjectMap.MultiFind(pairToFind, tweensToRemove);
+    // The references are released right away, the Tweens will be destroyed by their TweenContainers
+    TArray<UBaseTween*> tweensToRemove;
+    mTweenReferences.FindByObject(pTweenTarget, pTweensType, tweensToRemove, true);
 
-            // Looking for the specific pair in the reference map
-            for(int i = 0; i < tweensToRemove.Num(); ++i)
-            {
-                TWeakObjectPtr<UBaseTween> tween = tweensToRemove[i];
-
-                if(tween.IsValid())
-                {
-                    tween.Get()->DeleteTween();
-                    hasDeletedSomething = true;
-                }
-            }
+    for(UBaseTween *tween : tweensToRemove)
+    {
+        tween->DeleteTween();
+        hasDeletedSomething = true;
+    }
 
-            mTweensByObjectMap.Remove(pairToFind);
-            break;
-        }
+    if(mTweenStore.RemoveByObject(pTweenTarget, pTweensType) > 0)
+    {
+        hasDeletedSomething = true;
     }
 
     return hasDeletedSomething;
@@ -147,81 +127,126 @@ bool UTweenManagerComponent::IsObjectTweening(UObject *pTweenTarget, ETweenGener
     bool found = false;
     pTweenFound = nullptr;
 
-    if(pTweensType != ETweenGenericType::Any)
-    {
-        TPair<TWeakObjectPtr<UObject>, ETweenGenericType> pairToFind = TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, pTweensType);
+    TArray<UBaseTween*> tweensFound;
+    mTweenReferences.FindByObject(pTweenTarget, pTweensType, tweensFound);
 
-        TArray<TWeakObjectPtr<UBaseTween>> tweensFound;
-        mTweensByObjectMap.MultiFind(pairToFind, tweensFound);
+    for(int i = 0; i < tweensFound.Num() && !found; ++i)
+    {
+        found = tweensFound[i]->IsTweening();
 
-        for(int i = 0; i < tweensFound.Num() && !found; ++i)
+        if(found)
         {
-            TWeakObjectPtr<UBaseTween> tween = tweensFound[i];
-
-            if(tween.IsValid())
-            {
-                found = tween.Get()->IsTweening();
-
-                if(found)
-                {
-                    pTweenFound = tween.Get();
-                }
-            }
+            pTweenFound = tweensFound[i];
         }
     }
-    else
+
+    // The caller wants the Tween object: if the Tween lives in the TweenStore, this is the moment it gets one
+    FTweenHandle storedTween;
+
+    if(!found && mTweenStore.IsObjectTweening(pTweenTarget, pTweensType, storedTween))
     {
-        for(int i = 0; i < mTweenContainers.Num() && !found; ++i)
-        {
-            UTweenContainer *tweenContainer = mTweenContainers[i];
-            found = tweenContainer->IsObjectTweeningInContainer(pTweenTarget, pTweensType, pTweenFound);
-        }
+        pTweenFound = GetTweenObject(storedTween);
+        found = pTweenFound != nullptr;
     }
 
-
     return found;
 }
 
 bool UTweenManagerComponent::FindTweenByName(FName pTweenName, ETweenGenericType pTweensType, UBaseTween *&pTweenFound)
 {
-    bool found = false;
-    pTweenFound = nullptr;
+    // If there are more Tweens with the same name and type, only the first one will be retrieved
+    pTweenFound = mTweenReferences.FindByName(pTweenName, pTweensType);
+
+    return pTweenFound != nullptr;
+}
 
-    if(pTweensType != ETweenGenericType::Any)
+
+/*
+ **************************************************************************
+ * "Tween Handle" methods
+ **************************************************************************
+ */
+
+bool UTweenManagerComponent::IsTweenAlive(FTweenHandle pHandle) const
+{
+    if(mTweenStore.IsAlive(pHandle))
     {
-        TPair<FName, ETweenGenericType> pairToFind = TPair<FName, ETweenGenericType>(pTweenName, pTweensType);
+        return true;
+    }
 
-        // Find the specific pair
-        TWeakObjectPtr<UBaseTween> *tween = mTweensByNameMap.Find(pairToFind);
+    const TWeakObjectPtr<UBaseTween> *promotedTween = mPromotedTweens.Find(pHandle);
 
-        found = tween && tween->IsValid();
+    return promotedTween != nullptr && promotedTween->IsValid() && promotedTween->Get()->IsTweening();
+}
 
-        if (found)
+bool UTweenManagerComponent::DeleteTweenByHandle(FTweenHandle pHandle)
+{
+    if(mTweenStore.Remove(pHandle))
+    {
+        return true;
+    }
+
+    if(UBaseTween *promotedTween = mPromotedTweens.FindRef(pHandle).Get())
+    {
+        promotedTween->DeleteTween();
+        mPromotedTweens.Remove(pHandle);
+        return true;
+    }
+
+    return false;
+}
+
+bool UTweenManagerComponent::SetTweenPausedByHandle(FTweenHandle pHandle, bool pPaused)
+{
+    if(mTweenStore.SetPaused(pHandle, pPaused))
+    {
+        return true;
+    }
+
+    if(UBaseTween *promotedTween = mPromotedTweens.FindRef(pHandle).Get())
+    {
+        if(pPaused)
         {
-            pTweenFound = tween->Get();
+            promotedTween->PauseTween();
         }
+        else
+        {
+            promotedTween->ResumeTween();
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+UBaseTween* UTweenManagerComponent::GetTweenObject(FTweenHandle pHandle)
+{
+    // Already promoted: the handle keeps pointing to the same Tween object
+    if(const TWeakObjectPtr<UBaseTween> *promotedTween = mPromotedTweens.Find(pHandle))
+    {
+        return promotedTween->Get();
     }
-    else
+
+    UBaseTween *tween = PromoteStoredTween(pHandle);
+
+    if(tween != nullptr)
     {
-        // Iterate across all Tweens with a name
-        for (auto& element : mTweensByNameMap)
+        // Promotions are rare, so it's a good moment to forget about the promoted Tweens that are gone
+        for(auto iterator = mPromotedTweens.CreateIterator(); iterator; ++iterator)
         {
-            // If the element has the name we're looking for and it's valid, take it. If there are more than one element with
-            // the same name and type, only the first one will be retrieved
-            FName currentName = element.Key.Key;
-            if (currentName == pTweenName && element.Value.IsValid())
+            if(!iterator.Value().IsValid())
             {
-                pTweenFound = element.Value.Get();
-                found = true;
-                break;
+                iterator.RemoveCurrent();
             }
         }
+
+        mPromotedTweens.Add(pHandle, tween);
     }
 
-    return found;
+    return tween;
 }
 
-
 /*
  **************************************************************************
  * C++ methods (i.e. meant to be called when using this plugin in C++)
@@ -257,6 +282,13 @@ UTweenContainer* UTweenManagerComponent::CreateTweenContainerStatic(int32 pNumLo
     return outTweenContainer;
 }
 
+FTweenStore* UTweenManagerComponent::GetTweenStoreStatic()
+{
+    UTweenManagerComponent *instance = ATweenManagerActor::GetInstance();
+
+    return instance != nullptr ? &instance->mTweenStore : nullptr;
+}
+
 
 UTweenVector* UTweenManagerComponent::AppendTweenVector(UTweenContainer *pTweenContainer, int32 pSequenceIndex, ETweenVectorType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
                                                       const FVector &pFrom, const FVector &pTo, float pDuration, ETweenEaseType pEaseType,
@@ -529,8 +561,8 @@ UTweenFloat* UTweenManagerComponent::JoinTweenFollowSplineFloat(UTweenContainer
 
 void UTweenManagerComponent::DestroyTweenContainer(UTweenContainer *pTweenContainer, int32 pIndex)
 {
-    // Making the TweenContainer remove its own Tweens's references from the reference map
-    pTweenContainer->RemoveTweensReferences(mTweensByObjectMap);
+    // Making the TweenContainer remove its own Tweens's references from the reference table
+    pTweenContainer->RemoveTweensReferences(mTweenReferences);
 
     mTweenContainers.RemoveAt(pIndex);
 
@@ -538,10 +570,133 @@ void UTweenManagerComponent::DestroyTweenContainer(UTweenContainer *pTweenContai
     Utility::DestroyUObject(pTweenContainer);
 }
 
+/**
+ * Hands the progress of a stored Tween over to the Tween object that replaces it. If the stored Tween already started,
+ * its resolved starting values are kept, so that the Tween doesn't prepare itself again from the target's current state.
+ */
+template<typename TTween, typename TStored>
+static TTween* RestorePromotedTween(TTween *pTween, const TStored &pStoredTween)
+{
+    if(EnumHasAnyFlags(pStoredTween.Flags, ETweenStoreFlags::Prepared))
+    {
+        pTween->RestoreStoredValues(pStoredTween.From, pStoredTween.To, pStoredTween.BaseOffset);
+        pTween->RestoreProgress(pStoredTween.ElapsedTime);
+    }
+
+    if(EnumHasAnyFlags(pStoredTween.Flags, ETweenStoreFlags::Paused))
+    {
+        pTween->PauseTween();
+    }
+
+    return pTween;
+}
+
+/** A stored Tween that already started has its values inverted already, so its Tween object must not invert them again */
+template<typename TStored>
+static float GetPromotedTimeScale(const TStored &pStoredTween)
+{
+    return EnumHasAnyFlags(pStoredTween.Flags, ETweenStoreFlags::Prepared) ? FMath::Abs(pStoredTween.Params.TimeScale) : pStoredTween.Params.TimeScale;
+}
+
+UBaseTween* UTweenManagerComponent::PromoteStoredTween(const FTweenHandle &pHandle)
+{
+    UBaseTween *tween = nullptr;
+
+    switch(pHandle.GetLane())
+    {
+        case ETweenStoreLane::Vector:
+        {
+            FTweenVectorLane::FStoredTween stored;
+
+            if(mTweenStore.Take(pHandle, stored) && stored.Target.IsValid())
+            {
+                const FTweenStoreParams &params = stored.Params;
+                UTweenContainer *tweenContainer = CreateTweenContainer(params.NumLoops, params.LoopType);
+
+                tween = RestorePromotedTween(AppendTweenVector(tweenContainer, 0, stored.TweenType, stored.Target.Get(), stored.TargetType,
+                                                               stored.From, stored.To, params.Duration, params.EaseType, false, false,
+                                                               params.NumLoops, params.LoopType, params.Delay, GetPromotedTimeScale(stored),
+                                                               params.bTweenWhileGameIsPaused), stored);
+            }
+            break;
+        }
+        case ETweenStoreLane::Vector2D:
+        {
+            FTweenVector2DLane::FStoredTween stored;
+
+            if(mTweenStore.Take(pHandle, stored) && stored.Target.IsValid())
+            {
+                const FTweenStoreParams &params = stored.Params;
+                UTweenContainer *tweenContainer = CreateTweenContainer(params.NumLoops, params.LoopType);
+
+                tween = RestorePromotedTween(AppendTweenVector2D(tweenContainer, 0, stored.TweenType, stored.Target.Get(), stored.TargetType,
+                                                                 stored.From, stored.To, params.Duration, params.EaseType,
+                                                                 params.NumLoops, params.LoopType, params.Delay, GetPromotedTimeScale(stored),
+                                                                 params.bTweenWhileGameIsPaused), stored);
+            }
+            break;
+        }
+        case ETweenStoreLane::Rotator:
+        {
+            FTweenRotatorLane::FStoredTween stored;
+
+            if(mTweenStore.Take(pHandle, stored) && stored.Target.IsValid())
+            {
+                const FTweenStoreParams &params = stored.Params;
+                UTweenContainer *tweenContainer = CreateTweenContainer(params.NumLoops, params.LoopType);
+
+                tween = RestorePromotedTween(AppendTweenRotator(tweenContainer, 0, stored.TweenType, stored.Target.Get(), stored.TargetType,
+                                                                stored.From, stored.To, params.Duration, params.EaseType, false, false,
+                                                                params.NumLoops, params.LoopType, params.Delay, GetPromotedTimeScale(stored),
+                                                                params.bTweenWhileGameIsPaused), stored);
+            }
+            break;
+        }
+        case ETweenStoreLane::LinearColor:
+        {
+            FTweenLinearColorLane::FStoredTween stored;
+
+            if(mTweenStore.Take(pHandle, stored) && stored.Target.IsValid())
+            {
+                const FTweenStoreParams &params = stored.Params;
+                UTweenContainer *tweenContainer = CreateTweenContainer(params.NumLoops, params.LoopType);
+
+                tween = RestorePromotedTween(AppendTweenLinearColor(tweenContainer, 0, stored.TweenType, stored.Target.Get(), stored.ParameterName,
+                                                                    stored.TargetType, stored.From, stored.To, params.Duration, params.EaseType,
+                                                                    params.NumLoops, params.LoopType, params.Delay, GetPromotedTimeScale(stored),
+                                                                    params.bTweenWhileGameIsPaused), stored);
+            }
+            break;
+        }
+        case ETweenStoreLane::Float:
+        {
+            FTweenFloatLane::FStoredTween stored;
+
+            if(mTweenStore.Take(pHandle, stored) && stored.Target.IsValid())
+            {
+                const FTweenStoreParams &params = stored.Params;
+                UTweenContainer *tweenContainer = CreateTweenContainer(params.NumLoops, params.LoopType);
+
+                tween = RestorePromotedTween(AppendTweenFloat(tweenContainer, 0, stored.TweenType, stored.Target.Get(), stored.TargetType,
+                                                              stored.From, stored.To, params.Duration, params.EaseType,
+                                                              params.NumLoops, params.LoopType, params.Delay, GetPromotedTimeScale(stored),
+                                                              params.bTweenWhileGameIsPaused, nullptr, stored.ParameterName), stored);
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return tween;
+}
+
 void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenVectorType pTweenType, UBaseTween *pTween)
 {
     ETweenGenericType type = Utility::ConvertTweenTypeEnum(pTweenType);
-    mTweensByObjectMap.Add(TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, type), pTween);
+    pTween->mTweenReference = mTweenReferences.Add(pTween, pTweenTarget, type);
 
     pTween->OnNameChanged.AddDynamic(this, &UTweenManagerComponent::UpdateNameMap);
     pTween->OnTweenDestroyed.AddDynamic(this, &UTweenManagerComponent::TweenDestroyed);
@@ -550,7 +705,7 @@ void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenVec
 void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenVector2DType pTweenType, UBaseTween *pTween)
 {
     ETweenGenericType type = Utility::ConvertTweenTypeEnum(pTweenType);
-    mTweensByObjectMap.Add(TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, type), pTween);
+    pTween->mTweenReference = mTweenReferences.Add(pTween, pTweenTarget, type);
 
     pTween->OnNameChanged.AddDynamic(this, &UTweenManagerComponent::UpdateNameMap);
     pTween->OnTweenDestroyed.AddDynamic(this, &UTweenManagerComponent::TweenDestroyed);
@@ -559,7 +714,7 @@ void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenVec
 void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenRotatorType pTweenType, UBaseTween *pTween)
 {
     ETweenGenericType type = Utility::ConvertTweenTypeEnum(pTweenType);
-    mTweensByObjectMap.Add(TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, type), pTween);
+    pTween->mTweenReference = mTweenReferences.Add(pTween, pTweenTarget, type);
 
     pTween->OnNameChanged.AddDynamic(this, &UTweenManagerComponent::UpdateNameMap);
     pTween->OnTweenDestroyed.AddDynamic(this, &UTweenManagerComponent::TweenDestroyed);
@@ -568,7 +723,7 @@ void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenRot
 void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenLinearColorType pTweenType, UBaseTween *pTween)
 {
     ETweenGenericType type = Utility::ConvertTweenTypeEnum(pTweenType);
-    mTweensByObjectMap.Add(TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, type), pTween);
+    pTween->mTweenReference = mTweenReferences.Add(pTween, pTweenTarget, type);
 
     pTween->OnNameChanged.AddDynamic(this, &UTweenManagerComponent::UpdateNameMap);
     pTween->OnTweenDestroyed.AddDynamic(this, &UTweenManagerComponent::TweenDestroyed);
@@ -577,29 +732,20 @@ void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenLin
 void UTweenManagerComponent::SaveTweenReference(UObject *pTweenTarget, ETweenFloatType pTweenType, UBaseTween *pTween)
 {
     ETweenGenericType type = Utility::ConvertTweenTypeEnum(pTweenType);
-    mTweensByObjectMap.Add(TPair<TWeakObjectPtr<UObject>, ETweenGenericType>(pTweenTarget, type), pTween);
+    pTween->mTweenReference = mTweenReferences.Add(pTween, pTweenTarget, type);
 
     pTween->OnNameChanged.AddDynamic(this, &UTweenManagerComponent::UpdateNameMap);
     pTween->OnTweenDestroyed.AddDynamic(this, &UTweenManagerComponent::TweenDestroyed);
 }
 
 void UTweenManagerComponent::UpdateNameMap(UBaseTween *pTween, const FName& pPreviousName, const FName& pNewName)
-{    
-    TPair<FName, ETweenGenericType> pairToRemove = TPair<FName, ETweenGenericType>(pPreviousName, pTween->GetTweenGenericType());
-    TPair<FName, ETweenGenericType> pairToAdd = TPair<FName, ETweenGenericType>(pNewName, pTween->GetTweenGenericType());
-
-    // Remove the old entry, if there was one (since now the name has changed), and add the new one
-    if (pPreviousName != NAME_None)
-    {
-        mTweensByNameMap.RemoveSingle(pairToRemove, pTween);
-    }
-
-    mTweensByNameMap.Add(pairToAdd, pTween);
+{
+    // The previous name, if there was one, is replaced in the table
+    mTweenReferences.SetName(pTween->mTweenReference, pNewName);
 }
 
 void UTweenManagerComponent::TweenDestroyed(UBaseTween *pTween)
 {
-    // Remove the name pair from the map, in case it was present
-    TPair<FName, ETweenGenericType> pairToRemove = TPair<FName, ETweenGenericType>(pTween->GetTweenName(), pTween->GetTweenGenericType());
-    mTweensByNameMap.RemoveSingle(pairToRemove, pTween);
+    // Releasing the entry of the Tween. Does nothing if it was already released (e.g. by DeleteAllTweensByObject)
+    mTweenReferences.Remove(pTween->mTweenReference);
 }
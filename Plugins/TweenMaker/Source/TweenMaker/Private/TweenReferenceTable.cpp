@@ -0,0 +1,238 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenReferenceTable.h"
+#include "Tweens/BaseTween.h"
+
+
+FTweenReference FTweenReferenceTable::Add(UBaseTween *pTween, UObject *pTarget, ETweenGenericType pTweenType)
+{
+    int32 slotIndex;
+
+    if(mFreeSlots.Num() > 0)
+    {
+        slotIndex = mFreeSlots.Pop(false);
+    }
+    else
+    {
+        slotIndex = mSlots.AddDefaulted();
+    }
+
+    FSlot &slot = mSlots[slotIndex];
+    slot.Tween = pTween;
+    slot.TargetKey = pTarget;
+    slot.Target = pTarget;
+    slot.Name = NAME_None;
+    slot.TweenType = pTweenType;
+    slot.NameListIndex = INDEX_NONE;
+    slot.bInUse = true;
+
+    TArray<int32> &targetList = mSlotsByTarget.FindOrAdd(pTarget);
+    slot.TargetListIndex = targetList.Add(slotIndex);
+
+    FTweenReference reference;
+    reference.Index = slotIndex;
+    reference.Generation = slot.Generation;
+
+    return reference;
+}
+
+bool FTweenReferenceTable::Remove(const FTweenReference &pReference)
+{
+    if(FindSlot(pReference) == nullptr)
+    {
+        return false;
+    }
+
+    RemoveSlot(pReference.Index);
+    return true;
+}
+
+UBaseTween* FTweenReferenceTable::Resolve(const FTweenReference &pReference) const
+{
+    const FSlot *slot = FindSlot(pReference);
+
+    return slot != nullptr ? slot->Tween.Get() : nullptr;
+}
+
+void FTweenReferenceTable::SetName(const FTweenReference &pReference, FName pName)
+{
+    FSlot *slot = FindSlot(pReference);
+
+    if(slot == nullptr || slot->Name == pName)
+    {
+        return;
+    }
+
+    if(slot->Name != NAME_None)
+    {
+        RemoveFromList(mSlotsByName, slot->Name, slot->NameListIndex, &FSlot::NameListIndex);
+        slot->NameListIndex = INDEX_NONE;
+    }
+
+    slot->Name = pName;
+
+    if(pName != NAME_None)
+    {
+        slot->NameListIndex = mSlotsByName.FindOrAdd(pName).Add(pReference.Index);
+    }
+}
+
+void FTweenReferenceTable::FindByObject(const UObject *pTarget, ETweenGenericType pTweenType, TArray<UBaseTween*> &pOutTweens, bool pRemove)
+{
+    const TArray<int32> *targetList = mSlotsByTarget.Find(pTarget);
+
+    if(targetList == nullptr)
+    {
+        return;
+    }
+
+    // Walking backwards, so that removing the current slot only moves slots already visited
+    for(int32 i = targetList->Num() - 1; i >= 0; --i)
+    {
+        const int32 slotIndex = (*targetList)[i];
+        const FSlot &slot = mSlots[slotIndex];
+
+        if(pTweenType != ETweenGenericType::Any && slot.TweenType != pTweenType)
+        {
+            continue;
+        }
+
+        // The address could also belong to a target destroyed before its Tweens were, which is not the one asked for
+        if(slot.Target.Get() == pTarget)
+        {
+            if(UBaseTween *tween = slot.Tween.Get())
+            {
+                pOutTweens.Add(tween);
+            }
+        }
+
+        if(pRemove)
+        {
+            RemoveSlot(slotIndex);
+
+            // The last slot removed for a target also removes its list
+            targetList = mSlotsByTarget.Find(pTarget);
+            if(targetList == nullptr)
+            {
+                break;
+            }
+        }
+    }
+}
+
+UBaseTween* FTweenReferenceTable::FindByName(FName pName, ETweenGenericType pTweenType) const
+{
+    const TArray<int32> *nameList = mSlotsByName.Find(pName);
+
+    if(nameList == nullptr)
+    {
+        return nullptr;
+    }
+
+    // If there are more Tweens with the same name and type, the first one is returned
+    for(int32 slotIndex : *nameList)
+    {
+        const FSlot &slot = mSlots[slotIndex];
+
+        if(pTweenType == ETweenGenericType::Any || slot.TweenType == pTweenType)
+        {
+            if(UBaseTween *tween = slot.Tween.Get())
+            {
+                return tween;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+void FTweenReferenceTable::Reset()
+{
+    // The generations are kept, so that the references given out so far stay stale
+    mFreeSlots.Reset();
+
+    for(int32 i = mSlots.Num() - 1; i >= 0; --i)
+    {
+        FSlot &slot = mSlots[i];
+
+        if(slot.bInUse)
+        {
+            ClearSlot(slot);
+        }
+
+        mFreeSlots.Add(i);
+    }
+
+    mSlotsByTarget.Reset();
+    mSlotsByName.Reset();
+}
+
+/*
+ **************************************************************************
+ * Private methods
+ **************************************************************************
+ */
+
+FTweenReferenceTable::FSlot* FTweenReferenceTable::FindSlot(const FTweenReference &pReference)
+{
+    if(!mSlots.IsValidIndex(pReference.Index))
+    {
+        return nullptr;
+    }
+
+    FSlot &slot = mSlots[pReference.Index];
+
+    return slot.bInUse && slot.Generation == pReference.Generation ? &slot : nullptr;
+}
+
+const FTweenReferenceTable::FSlot* FTweenReferenceTable::FindSlot(const FTweenReference &pReference) const
+{
+    return const_cast<FTweenReferenceTable*>(this)->FindSlot(pReference);
+}
+
+void FTweenReferenceTable::RemoveSlot(int32 pSlotIndex)
+{
+    FSlot &slot = mSlots[pSlotIndex];
+
+    RemoveFromList(mSlotsByTarget, slot.TargetKey, slot.TargetListIndex, &FSlot::TargetListIndex);
+
+    if(slot.Name != NAME_None)
+    {
+        RemoveFromList(mSlotsByName, slot.Name, slot.NameListIndex, &FSlot::NameListIndex);
+    }
+
+    ClearSlot(slot);
+    mFreeSlots.Add(pSlotIndex);
+}
+
+void FTweenReferenceTable::ClearSlot(FSlot &pSlot)
+{
+    // Only the generation survives, so that a free slot has no Tween, target or name to be found by
+    const uint32 nextGeneration = pSlot.Generation + 1;
+
+    pSlot = FSlot();
+    pSlot.Generation = nextGeneration;
+}
+
+template<typename TKey>
+void FTweenReferenceTable::RemoveFromList(TMap<TKey, TArray<int32>> &pLists, const TKey &pKey, int32 pListIndex, int32 FSlot::*pListIndexMember)
+{
+    TArray<int32> *list = pLists.Find(pKey);
+
+    if(list == nullptr || !list->IsValidIndex(pListIndex))
+    {
+        return;
+    }
+
+    list->RemoveAtSwap(pListIndex, 1, false);
+
+    if(pListIndex < list->Num())
+    {
+        mSlots[(*list)[pListIndex]].*pListIndexMember = pListIndex;
+    }
+
+    if(list->Num() == 0)
+    {
+        pLists.Remove(pKey);
+    }
+}
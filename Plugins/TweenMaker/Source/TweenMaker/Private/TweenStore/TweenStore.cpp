@@ -0,0 +1,860 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenStore/TweenStore.h"
+#include "Utils/Utility.h"
+#include "Utils/EaseEquations.h"
+#include "Utils/EaseLookupTable.h"
+#include "TweenTransformBatch.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Components/Widget.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Utils/TweenParallel.h"
+
+
+/*
+ **************************************************************************
+ * Per-lane kernels. They mirror PrepareTween/ComputeValue/ApplyValue of the UTweenXYZ classes,
+ * minus everything that needs a UObject (delegates, hit/overlap events).
+ **************************************************************************
+ */
+
+namespace TweenStoreKernels
+{
+    /* TweenVector */
+
+    void Prepare(FTweenVectorLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        // The starting values are read from the target, so the writes still pending on it must be applied first
+        FTweenTransformBatch::FlushPending(pTarget);
+
+        AActor *actor = pLane.mTargetType[pIndex] == ETweenTargetType::Actor ? Cast<AActor>(pTarget) : nullptr;
+        USceneComponent *component = actor != nullptr ? actor->GetRootComponent() : Cast<USceneComponent>(pTarget);
+
+        if(component == nullptr)
+        {
+            return;
+        }
+
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenVectorType::MoveTo:
+            {
+                pLane.mFrom[pIndex] = actor != nullptr ? actor->GetActorLocation() : component->GetComponentLocation();
+                break;
+            }
+            case ETweenVectorType::MoveBy:
+            {
+                pLane.mFrom[pIndex] = FVector(0, 0, 0);
+                pLane.mBaseOffset[pIndex] = component->GetRelativeTransform().GetLocation();
+                break;
+            }
+            case ETweenVectorType::ScaleTo:
+            {
+                pLane.mFrom[pIndex] = actor != nullptr ? actor->GetActorScale3D() : component->GetComponentScale();
+                break;
+            }
+            case ETweenVectorType::ScaleBy:
+            {
+                pLane.mFrom[pIndex] = FVector(0, 0, 0);
+                pLane.mBaseOffset[pIndex] = component->GetRelativeTransform().GetScale3D();
+                break;
+            }
+            // Does nothing
+            case ETweenVectorType::Custom:
+            {
+                break;
+            }
+        }
+    }
+
+    void Blend(FTweenVectorLane &pLane, int32 pIndex, float pAlpha)
+    {
+        pLane.mCurrentValue[pIndex] = pLane.mFrom[pIndex] + (pLane.mTo[pIndex] - pLane.mFrom[pIndex]) * pAlpha;
+    }
+
+    void Apply(const FTweenVectorLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        const FVector &value = pLane.mCurrentValue[pIndex];
+        const FVector &offset = pLane.mBaseOffset[pIndex];
+        USceneComponent *component = FTweenTransformBatch::GetTargetComponent(pTarget);
+
+        // Stored Tweens have no hit/overlap events, so they never sweep
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenVectorType::MoveTo: FTweenTransformBatch::SetLocation(component, value, ETweenTransformSpace::World, false); break;
+            case ETweenVectorType::MoveBy: FTweenTransformBatch::SetLocation(component, value + offset, ETweenTransformSpace::Relative, false); break;
+            case ETweenVectorType::ScaleTo: FTweenTransformBatch::SetScale(component, value, ETweenTransformSpace::World); break;
+            case ETweenVectorType::ScaleBy: FTweenTransformBatch::SetScale(component, value + offset, ETweenTransformSpace::Relative); break;
+            case ETweenVectorType::Custom: break;
+        }
+    }
+
+    /* TweenVector2D */
+
+    void Prepare(FTweenVector2DLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        UWidget *widget = pLane.mTargetType[pIndex] == ETweenTargetType::UMG ? Cast<UWidget>(pTarget) : nullptr;
+
+        if(widget == nullptr)
+        {
+            return;
+        }
+
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenVector2DType::MoveTo:
+            {
+                pLane.mFrom[pIndex] = widget->RenderTransform.Translation;
+                break;
+            }
+            case ETweenVector2DType::MoveBy:
+            {
+                pLane.mFrom[pIndex] = FVector2D(0, 0);
+                pLane.mBaseOffset[pIndex] = widget->RenderTransform.Translation;
+                break;
+            }
+            case ETweenVector2DType::ScaleTo:
+            {
+                pLane.mFrom[pIndex] = widget->RenderTransform.Scale;
+                break;
+            }
+            case ETweenVector2DType::ScaleBy:
+            {
+                pLane.mFrom[pIndex] = FVector2D(0, 0);
+                pLane.mBaseOffset[pIndex] = widget->RenderTransform.Scale;
+                break;
+            }
+            case ETweenVector2DType::ShearTo:
+            {
+                pLane.mFrom[pIndex] = widget->RenderTransform.Shear;
+                break;
+            }
+            // Does nothing
+            case ETweenVector2DType::Custom:
+            {
+                break;
+            }
+        }
+    }
+
+    void Blend(FTweenVector2DLane &pLane, int32 pIndex, float pAlpha)
+    {
+        pLane.mCurrentValue[pIndex] = pLane.mFrom[pIndex] + (pLane.mTo[pIndex] - pLane.mFrom[pIndex]) * pAlpha;
+    }
+
+    void Apply(const FTweenVector2DLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        if(pLane.mTargetType[pIndex] != ETweenTargetType::UMG)
+        {
+            return;
+        }
+
+        UWidget *widget = Cast<UWidget>(pTarget);
+        const FVector2D &value = pLane.mCurrentValue[pIndex];
+        const FVector2D &offset = pLane.mBaseOffset[pIndex];
+
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenVector2DType::MoveTo: widget->SetRenderTranslation(value); break;
+            case ETweenVector2DType::MoveBy: widget->SetRenderTranslation(value + offset); break;
+            case ETweenVector2DType::ScaleTo: widget->SetRenderScale(value); break;
+            case ETweenVector2DType::ScaleBy: widget->SetRenderScale(value + offset); break;
+            case ETweenVector2DType::ShearTo: widget->SetRenderShear(value); break;
+            case ETweenVector2DType::Custom: break;
+        }
+    }
+
+    /* TweenRotator */
+
+    void Prepare(FTweenRotatorLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        // The starting values are read from the target, so the writes still pending on it must be applied first
+        FTweenTransformBatch::FlushPending(pTarget);
+
+        AActor *actor = pLane.mTargetType[pIndex] == ETweenTargetType::Actor ? Cast<AActor>(pTarget) : nullptr;
+        USceneComponent *component = actor != nullptr ? actor->GetRootComponent() : Cast<USceneComponent>(pTarget);
+
+        if(component == nullptr)
+        {
+            return;
+        }
+
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenRotatorType::RotateTo:
+            {
+                pLane.mFrom[pIndex] = actor != nullptr ? actor->GetActorRotation() : component->GetComponentRotation();
+                break;
+            }
+            case ETweenRotatorType::RotateBy:
+            {
+                pLane.mFrom[pIndex] = FRotator::ZeroRotator;
+                pLane.mBaseOffset[pIndex] = component->GetRelativeTransform().Rotator();
+                break;
+            }
+        }
+    }
+
+    void Blend(FTweenRotatorLane &pLane, int32 pIndex, float pAlpha)
+    {
+        const FRotator &from = pLane.mFrom[pIndex];
+        const FRotator &to = pLane.mTo[pIndex];
+
+        // "By" rotations interpolate each axis, so that they can go past 180 degrees; "To" rotations take the shortest path
+        if(pLane.mTweenType[pIndex] == ETweenRotatorType::RotateBy)
+        {
+            pLane.mCurrentValue[pIndex] = FRotator(FMath::Lerp(from.Pitch, to.Pitch, pAlpha),
+                                                   FMath::Lerp(from.Yaw, to.Yaw, pAlpha),
+                                                   FMath::Lerp(from.Roll, to.Roll, pAlpha));
+        }
+        else
+        {
+            pLane.mCurrentValue[pIndex] = FQuat::Slerp(from.Quaternion(), to.Quaternion(), pAlpha).Rotator();
+        }
+    }
+
+    void Apply(const FTweenRotatorLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        const FRotator &value = pLane.mCurrentValue[pIndex];
+        USceneComponent *component = FTweenTransformBatch::GetTargetComponent(pTarget);
+
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenRotatorType::RotateTo: FTweenTransformBatch::SetRotation(component, value, ETweenTransformSpace::World); break;
+            case ETweenRotatorType::RotateBy: FTweenTransformBatch::SetRotation(component, UKismetMathLibrary::ComposeRotators(pLane.mBaseOffset[pIndex], value), ETweenTransformSpace::Relative); break;
+        }
+    }
+
+    /* TweenLinearColor */
+
+    void Prepare(FTweenLinearColorLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        if(pLane.mTweenType[pIndex] == ETweenLinearColorType::MaterialVectorTo)
+        {
+            if(UMaterialInstanceDynamic *material = Cast<UMaterialInstanceDynamic>(pTarget))
+            {
+                material->GetVectorParameterValue(FMaterialParameterInfo(pLane.mParameterName[pIndex]), pLane.mFrom[pIndex]);
+            }
+        }
+    }
+
+    void Blend(FTweenLinearColorLane &pLane, int32 pIndex, float pAlpha)
+    {
+        pLane.mCurrentValue[pIndex] = pLane.mFrom[pIndex] + (pLane.mTo[pIndex] - pLane.mFrom[pIndex]) * pAlpha;
+    }
+
+    void Apply(const FTweenLinearColorLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        if(pLane.mTargetType[pIndex] == ETweenTargetType::Material)
+        {
+            Cast<UMaterialInstanceDynamic>(pTarget)->SetVectorParameterValue(pLane.mParameterName[pIndex], pLane.mCurrentValue[pIndex]);
+        }
+    }
+
+    /* TweenFloat */
+
+    void Prepare(FTweenFloatLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenFloatType::MaterialScalarTo:
+            {
+                if(UMaterialInstanceDynamic *material = Cast<UMaterialInstanceDynamic>(pTarget))
+                {
+                    material->GetScalarParameterValue(FMaterialParameterInfo(pLane.mParameterName[pIndex]), pLane.mFrom[pIndex]);
+                }
+                break;
+            }
+            case ETweenFloatType::WidgetAngleTo:
+            {
+                if(UWidget *widget = Cast<UWidget>(pTarget))
+                {
+                    pLane.mFrom[pIndex] = widget->RenderTransform.Angle;
+                }
+                break;
+            }
+            case ETweenFloatType::WidgetOpacityTo:
+            {
+                if(UWidget *widget = Cast<UWidget>(pTarget))
+                {
+                    pLane.mFrom[pIndex] = widget->RenderOpacity;
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    void Blend(FTweenFloatLane &pLane, int32 pIndex, float pAlpha)
+    {
+        pLane.mCurrentValue[pIndex] = pLane.mFrom[pIndex] + (pLane.mTo[pIndex] - pLane.mFrom[pIndex]) * pAlpha;
+    }
+
+    void Apply(const FTweenFloatLane &pLane, int32 pIndex, UObject *pTarget)
+    {
+        const float value = pLane.mCurrentValue[pIndex];
+
+        switch(pLane.mTweenType[pIndex])
+        {
+            case ETweenFloatType::MaterialScalarFromTo:
+            case ETweenFloatType::MaterialScalarTo:
+            {
+                Cast<UMaterialInstanceDynamic>(pTarget)->SetScalarParameterValue(pLane.mParameterName[pIndex], value);
+                break;
+            }
+            case ETweenFloatType::WidgetAngleTo:
+            {
+                Cast<UWidget>(pTarget)->SetRenderTransformAngle(value);
+                break;
+            }
+            case ETweenFloatType::WidgetOpacityTo:
+            {
+                Cast<UWidget>(pTarget)->SetRenderOpacity(value);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    /* Shared update loop */
+
+    /** Number of values of ETweenEaseType, i.e. of batches a lane can be split into */
+    constexpr int32 NumEaseTypes = (int32)ETweenEaseType::EaseOutInBounce + 1;
+
+    using TweenParallel::ForEachChunk;
+
+    FORCEINLINE bool ShouldUpdate(ETweenStoreFlags pFlags, bool pIsGamePaused)
+    {
+        return !EnumHasAnyFlags(pFlags, ETweenStoreFlags::Paused | ETweenStoreFlags::PendingDeletion) &&
+               (!pIsGamePaused || EnumHasAnyFlags(pFlags, ETweenStoreFlags::TweenWhileGameIsPaused));
+    }
+
+    /**
+     * Eases all Tweens listed in pScratch.EasingIndices. They're first sorted by ease type (counting sort, the types are few),
+     * so that each ease type is computed in a single batch over contiguous times and durations.
+     * The sort runs on the game thread; the batches and the blending run in parallel chunks.
+     */
+    template<typename TLane>
+    void EaseByType(TLane &pLane, FTweenStoreScratch &pScratch)
+    {
+        const int32 numEasing = pScratch.EasingIndices.Num();
+
+        if(numEasing == 0)
+        {
+            return;
+        }
+
+        int32 batchStart[NumEaseTypes + 1] = {};
+
+        for(int32 index : pScratch.EasingIndices)
+        {
+            batchStart[(int32)pLane.mEaseType[index] + 1]++;
+        }
+
+        for(int32 type = 1; type <= NumEaseTypes; ++type)
+        {
+            batchStart[type] += batchStart[type - 1];
+        }
+
+        pScratch.SortedIndices.SetNumUninitialized(numEasing, false);
+        pScratch.Times.SetNumUninitialized(numEasing, false);
+        pScratch.Durations.SetNumUninitialized(numEasing, false);
+        pScratch.Alphas.SetNumUninitialized(numEasing, false);
+
+        int32 batchCursor[NumEaseTypes];
+        FMemory::Memcpy(batchCursor, batchStart, sizeof(batchCursor));
+
+        for(int32 index : pScratch.EasingIndices)
+        {
+            const int32 position = batchCursor[(int32)pLane.mEaseType[index]]++;
+
+            pScratch.SortedIndices[position] = index;
+            pScratch.Times[position] = pLane.mElapsedTime[index];
+            pScratch.Durations[position] = pLane.mDuration[index];
+        }
+
+        // Tables are only baked on the game thread: without this, the worker threads would compute the equations instead
+        for(int32 type = 0; type < NumEaseTypes; ++type)
+        {
+            if(batchStart[type + 1] > batchStart[type])
+            {
+                FEaseLookupTables::FindEaseTable((ETweenEaseType)type);
+            }
+        }
+
+        ForEachChunk(numEasing, [&pLane, &pScratch, &batchStart](int32 pStart, int32 pEnd)
+        {
+            // A chunk can span several batches; each one is computed on its part of the chunk
+            for(int32 type = 0; type < NumEaseTypes; ++type)
+            {
+                const int32 start = FMath::Max(batchStart[type], pStart);
+                const int32 end = FMath::Min(batchStart[type + 1], pEnd);
+
+                if(end > start)
+                {
+                    EaseEquations::ComputeEasingAlphaBatch((ETweenEaseType)type, end - start, pScratch.Times.GetData() + start,
+                                                           pScratch.Durations.GetData() + start, pScratch.Alphas.GetData() + start);
+                }
+            }
+
+            for(int32 position = pStart; position < pEnd; ++position)
+            {
+                Blend(pLane, pScratch.SortedIndices[position], pScratch.Alphas[position]);
+            }
+        });
+    }
+
+    /**
+     * Updates a lane in two phases. The compute phase (advancing the time, easing, looping) only touches the lane and runs
+     * in parallel chunks (see ForEachChunk); preparing the Tweens that start and applying the values touch UObjects,
+     * so they run on the game thread.
+     */
+    template<typename TLane>
+    void UpdateLane(TLane &pLane, float pDeltaTime, bool pIsGamePaused, FTweenStoreScratch &pScratch)
+    {
+        pScratch.Reset();
+
+        // Tweens added while updating (i.e. from a callback triggered by a target) will start updating on the next frame
+        const int32 numTweens = pLane.Num();
+
+        // Advancing the time (compute)
+        ForEachChunk(numTweens, [&pLane, pDeltaTime, pIsGamePaused](int32 pStart, int32 pEnd)
+        {
+            for(int32 i = pStart; i < pEnd; ++i)
+            {
+                // A frame in which the delay is still running doesn't advance the Tween, just like UBaseTween::UpdateTween
+                if(ShouldUpdate(pLane.mFlags[i], pIsGamePaused) && pLane.mDelayLeft[i] <= 0.0f)
+                {
+                    pLane.mElapsedTime[i] += pDeltaTime * FMath::Abs(pLane.mTimeScale[i]);
+                }
+            }
+        });
+
+        // Checking the targets and preparing the Tweens that just started (game thread)
+        for(int32 i = 0; i < numTweens; ++i)
+        {
+            const ETweenStoreFlags flags = pLane.mFlags[i];
+
+            if(!ShouldUpdate(flags, pIsGamePaused))
+            {
+                continue;
+            }
+
+            // Still waiting for the delay, which isn't affected by the time scale
+            if(pLane.mDelayLeft[i] > 0.0f)
+            {
+                pLane.mDelayLeft[i] -= pDeltaTime;
+                continue;
+            }
+
+            // Just like UBaseTween, the Tween dies along with its target
+            UObject *target = pLane.mTarget[i].Get();
+
+            if(target == nullptr)
+            {
+                pLane.mFlags[i] |= ETweenStoreFlags::PendingDeletion;
+                continue;
+            }
+
+            // I only prepare the Tween once in its lifetime (so it's not executed again if it loops)
+            if(!EnumHasAnyFlags(flags, ETweenStoreFlags::Prepared))
+            {
+                Prepare(pLane, i, target);
+
+                if(pLane.mTimeScale[i] < 0.0f)
+                {
+                    Swap(pLane.mFrom[i], pLane.mTo[i]);
+                }
+
+                pLane.mFlags[i] |= ETweenStoreFlags::Prepared;
+            }
+
+            if(pLane.mElapsedTime[i] < pLane.mDuration[i])
+            {
+                pScratch.EasingIndices.Add(i);
+            }
+
+            pScratch.ActiveIndices.Add(i);
+        }
+
+        // Easing, one batch per ease type (compute)
+        EaseByType(pLane, pScratch);
+
+        // Ending and looping (compute). The values are applied later, so the ended Tweens keep their last value until then
+        ForEachChunk(pScratch.ActiveIndices.Num(), [&pLane, &pScratch](int32 pStart, int32 pEnd)
+        {
+            for(int32 position = pStart; position < pEnd; ++position)
+            {
+                const int32 i = pScratch.ActiveIndices[position];
+
+                if(pLane.mElapsedTime[i] < pLane.mDuration[i])
+                {
+                    continue;
+                }
+
+                pLane.mCurrentValue[i] = pLane.mTo[i];
+
+                int32 &loopsLeft = pLane.mLoopsLeft[i];
+
+                // Looping forever, or there are still loops left
+                if(loopsLeft <= 0 || --loopsLeft > 0)
+                {
+                    if(pLane.mLoopType[i] == ETweenLoopType::Yoyo)
+                    {
+                        Swap(pLane.mFrom[i], pLane.mTo[i]);
+                    }
+
+                    pLane.mElapsedTime[i] = 0.0f;
+                }
+                else
+                {
+                    pLane.mFlags[i] |= ETweenStoreFlags::PendingDeletion;
+                }
+            }
+        });
+
+        // Applying the values (game thread)
+        for(int32 i : pScratch.ActiveIndices)
+        {
+            // Applying a value may have side effects (e.g. overlaps) that destroy the target of a Tween further in the list
+            UObject *target = pLane.mTarget[i].Get();
+
+            if(target == nullptr)
+            {
+                pLane.mFlags[i] |= ETweenStoreFlags::PendingDeletion;
+                continue;
+            }
+
+            Apply(pLane, i, target);
+        }
+    }
+
+    template<typename TLane>
+    int32 RemoveByObject(TLane &pLane, const UObject *pTarget, ETweenGenericType pTweensType)
+    {
+        int32 removed = 0;
+
+        for(int32 i = 0; i < pLane.Num(); ++i)
+        {
+            if(!EnumHasAnyFlags(pLane.mFlags[i], ETweenStoreFlags::PendingDeletion) && pLane.mTarget[i] == pTarget &&
+               (pTweensType == ETweenGenericType::Any || Utility::ConvertTweenTypeEnum(pLane.mTweenType[i]) == pTweensType))
+            {
+                pLane.mFlags[i] |= ETweenStoreFlags::PendingDeletion;
+                removed++;
+            }
+        }
+
+        return removed;
+    }
+
+    template<typename TLane>
+    bool Take(TLane &pLane, const FTweenHandle &pHandle, typename TLane::FStoredTween &pOutTween, bool pDeferRemoval)
+    {
+        const int32 denseIndex = pLane.Find(pHandle);
+
+        if(denseIndex == INDEX_NONE)
+        {
+            return false;
+        }
+
+        pLane.Copy(denseIndex, pOutTween);
+
+        if(pDeferRemoval)
+        {
+            pLane.mFlags[denseIndex] |= ETweenStoreFlags::PendingDeletion;
+        }
+        else
+        {
+            pLane.RemoveAt(denseIndex);
+        }
+
+        return true;
+    }
+
+    template<typename TLane>
+    void MarkAllPendingDeletion(TLane &pLane)
+    {
+        for(int32 i = 0; i < pLane.Num(); ++i)
+        {
+            pLane.mFlags[i] |= ETweenStoreFlags::PendingDeletion;
+        }
+    }
+
+    template<typename TLane>
+    bool FindByObject(const TLane &pLane, const UObject *pTarget, ETweenGenericType pTweensType, FTweenHandle &pOutHandle)
+    {
+        for(int32 i = 0; i < pLane.Num(); ++i)
+        {
+            if(!EnumHasAnyFlags(pLane.mFlags[i], ETweenStoreFlags::PendingDeletion | ETweenStoreFlags::Paused) && pLane.mTarget[i] == pTarget &&
+               (pTweensType == ETweenGenericType::Any || Utility::ConvertTweenTypeEnum(pLane.mTweenType[i]) == pTweensType))
+            {
+                pOutHandle = pLane.GetHandle(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+
+FTweenStore::FTweenStore()
+    : mVectorTweens(ETweenStoreLane::Vector)
+    , mVector2DTweens(ETweenStoreLane::Vector2D)
+    , mRotatorTweens(ETweenStoreLane::Rotator)
+    , mLinearColorTweens(ETweenStoreLane::LinearColor)
+    , mFloatTweens(ETweenStoreLane::Float)
+    , bIsUpdating(false)
+{
+}
+
+/*
+ **************************************************************************
+ * Adding Tweens
+ **************************************************************************
+ */
+
+FTweenHandle FTweenStore::AddVector(UObject *pTarget, ETweenTargetType pTargetType, ETweenVectorType pTweenType,
+                                    const FVector &pFrom, const FVector &pTo, const FTweenStoreParams &pParams)
+{
+    return mVectorTweens.Add(pTarget, pTargetType, pTweenType, NAME_None, pFrom, pTo, pParams);
+}
+
+FTweenHandle FTweenStore::AddVector2D(UObject *pTarget, ETweenTargetType pTargetType, ETweenVector2DType pTweenType,
+                                      const FVector2D &pFrom, const FVector2D &pTo, const FTweenStoreParams &pParams)
+{
+    return mVector2DTweens.Add(pTarget, pTargetType, pTweenType, NAME_None, pFrom, pTo, pParams);
+}
+
+FTweenHandle FTweenStore::AddRotator(UObject *pTarget, ETweenTargetType pTargetType, ETweenRotatorType pTweenType,
+                                     const FRotator &pFrom, const FRotator &pTo, const FTweenStoreParams &pParams)
+{
+    return mRotatorTweens.Add(pTarget, pTargetType, pTweenType, NAME_None, pFrom, pTo, pParams);
+}
+
+FTweenHandle FTweenStore::AddLinearColor(UObject *pTarget, FName pParameterName, ETweenLinearColorType pTweenType,
+                                         const FLinearColor &pFrom, const FLinearColor &pTo, const FTweenStoreParams &pParams)
+{
+    return mLinearColorTweens.Add(pTarget, ETweenTargetType::Material, pTweenType, pParameterName, pFrom, pTo, pParams);
+}
+
+FTweenHandle FTweenStore::AddFloat(UObject *pTarget, ETweenTargetType pTargetType, ETweenFloatType pTweenType,
+                                   float pFrom, float pTo, const FTweenStoreParams &pParams, FName pParameterName)
+{
+    if(pTweenType == ETweenFloatType::RotateAroundPoint || pTweenType == ETweenFloatType::FollowSpline)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenStore::AddFloat -> RotateAroundPoint and FollowSpline Tweens can't be stored. "
+                                            "Use the UTweenFloat factories instead."));
+        return FTweenHandle();
+    }
+
+    return mFloatTweens.Add(pTarget, pTargetType, pTweenType, pParameterName, pFrom, pTo, pParams);
+}
+
+/*
+ **************************************************************************
+ * Handle methods
+ **************************************************************************
+ */
+
+template<typename TResult, typename TFunctor>
+TResult FTweenStore::VisitLane(ETweenStoreLane pLane, TResult pDefault, TFunctor &&pFunctor)
+{
+    switch(pLane)
+    {
+        case ETweenStoreLane::Vector: return pFunctor(mVectorTweens);
+        case ETweenStoreLane::Vector2D: return pFunctor(mVector2DTweens);
+        case ETweenStoreLane::Rotator: return pFunctor(mRotatorTweens);
+        case ETweenStoreLane::LinearColor: return pFunctor(mLinearColorTweens);
+        case ETweenStoreLane::Float: return pFunctor(mFloatTweens);
+        default: return pDefault;
+    }
+}
+
+template<typename TResult, typename TFunctor>
+TResult FTweenStore::VisitLane(ETweenStoreLane pLane, TResult pDefault, TFunctor &&pFunctor) const
+{
+    switch(pLane)
+    {
+        case ETweenStoreLane::Vector: return pFunctor(mVectorTweens);
+        case ETweenStoreLane::Vector2D: return pFunctor(mVector2DTweens);
+        case ETweenStoreLane::Rotator: return pFunctor(mRotatorTweens);
+        case ETweenStoreLane::LinearColor: return pFunctor(mLinearColorTweens);
+        case ETweenStoreLane::Float: return pFunctor(mFloatTweens);
+        default: return pDefault;
+    }
+}
+
+bool FTweenStore::IsAlive(const FTweenHandle &pHandle) const
+{
+    return VisitLane(pHandle.GetLane(), false, [&pHandle](const auto &pLane)
+    {
+        return pLane.Find(pHandle) != INDEX_NONE;
+    });
+}
+
+bool FTweenStore::Remove(const FTweenHandle &pHandle)
+{
+    const bool bDeferRemoval = bIsUpdating;
+
+    return VisitLane(pHandle.GetLane(), false, [&pHandle, bDeferRemoval](auto &pLane)
+    {
+        const int32 denseIndex = pLane.Find(pHandle);
+
+        if(denseIndex == INDEX_NONE)
+        {
+            return false;
+        }
+
+        // Dense indices can't move while the lanes are being walked
+        if(bDeferRemoval)
+        {
+            pLane.mFlags[denseIndex] |= ETweenStoreFlags::PendingDeletion;
+        }
+        else
+        {
+            pLane.RemoveAt(denseIndex);
+        }
+
+        return true;
+    });
+}
+
+bool FTweenStore::SetPaused(const FTweenHandle &pHandle, bool pPaused)
+{
+    return VisitLane(pHandle.GetLane(), false, [&pHandle, pPaused](auto &pLane)
+    {
+        const int32 denseIndex = pLane.Find(pHandle);
+
+        if(denseIndex == INDEX_NONE)
+        {
+            return false;
+        }
+
+        if(pPaused)
+        {
+            pLane.mFlags[denseIndex] |= ETweenStoreFlags::Paused;
+        }
+        else
+        {
+            pLane.mFlags[denseIndex] &= ~ETweenStoreFlags::Paused;
+        }
+
+        return true;
+    });
+}
+
+bool FTweenStore::Take(const FTweenHandle &pHandle, FTweenVectorLane::FStoredTween &pOutTween)
+{
+    return TweenStoreKernels::Take(mVectorTweens, pHandle, pOutTween, bIsUpdating);
+}
+
+bool FTweenStore::Take(const FTweenHandle &pHandle, FTweenVector2DLane::FStoredTween &pOutTween)
+{
+    return TweenStoreKernels::Take(mVector2DTweens, pHandle, pOutTween, bIsUpdating);
+}
+
+bool FTweenStore::Take(const FTweenHandle &pHandle, FTweenRotatorLane::FStoredTween &pOutTween)
+{
+    return TweenStoreKernels::Take(mRotatorTweens, pHandle, pOutTween, bIsUpdating);
+}
+
+bool FTweenStore::Take(const FTweenHandle &pHandle, FTweenLinearColorLane::FStoredTween &pOutTween)
+{
+    return TweenStoreKernels::Take(mLinearColorTweens, pHandle, pOutTween, bIsUpdating);
+}
+
+bool FTweenStore::Take(const FTweenHandle &pHandle, FTweenFloatLane::FStoredTween &pOutTween)
+{
+    return TweenStoreKernels::Take(mFloatTweens, pHandle, pOutTween, bIsUpdating);
+}
+
+int32 FTweenStore::RemoveByObject(const UObject *pTarget, ETweenGenericType pTweensType)
+{
+    int32 removed = 0;
+
+    removed += TweenStoreKernels::RemoveByObject(mVectorTweens, pTarget, pTweensType);
+    removed += TweenStoreKernels::RemoveByObject(mVector2DTweens, pTarget, pTweensType);
+    removed += TweenStoreKernels::RemoveByObject(mRotatorTweens, pTarget, pTweensType);
+    removed += TweenStoreKernels::RemoveByObject(mLinearColorTweens, pTarget, pTweensType);
+    removed += TweenStoreKernels::RemoveByObject(mFloatTweens, pTarget, pTweensType);
+
+    if(!bIsUpdating)
+    {
+        mVectorTweens.RemovePendingDeletion();
+        mVector2DTweens.RemovePendingDeletion();
+        mRotatorTweens.RemovePendingDeletion();
+        mLinearColorTweens.RemovePendingDeletion();
+        mFloatTweens.RemovePendingDeletion();
+    }
+
+    return removed;
+}
+
+bool FTweenStore::IsObjectTweening(const UObject *pTarget, ETweenGenericType pTweensType, FTweenHandle &pOutHandle) const
+{
+    return TweenStoreKernels::FindByObject(mVectorTweens, pTarget, pTweensType, pOutHandle) ||
+           TweenStoreKernels::FindByObject(mVector2DTweens, pTarget, pTweensType, pOutHandle) ||
+           TweenStoreKernels::FindByObject(mRotatorTweens, pTarget, pTweensType, pOutHandle) ||
+           TweenStoreKernels::FindByObject(mLinearColorTweens, pTarget, pTweensType, pOutHandle) ||
+           TweenStoreKernels::FindByObject(mFloatTweens, pTarget, pTweensType, pOutHandle);
+}
+
+/*
+ **************************************************************************
+ * Update
+ **************************************************************************
+ */
+
+void FTweenStore::Update(float pDeltaTime, bool pIsGamePaused)
+{
+    bIsUpdating = true;
+
+    TweenStoreKernels::UpdateLane(mVectorTweens, pDeltaTime, pIsGamePaused, mScratch);
+    TweenStoreKernels::UpdateLane(mVector2DTweens, pDeltaTime, pIsGamePaused, mScratch);
+    TweenStoreKernels::UpdateLane(mRotatorTweens, pDeltaTime, pIsGamePaused, mScratch);
+    TweenStoreKernels::UpdateLane(mLinearColorTweens, pDeltaTime, pIsGamePaused, mScratch);
+    TweenStoreKernels::UpdateLane(mFloatTweens, pDeltaTime, pIsGamePaused, mScratch);
+
+    bIsUpdating = false;
+
+    // Ended Tweens are only dropped now that no one is walking the lanes anymore
+    mVectorTweens.RemovePendingDeletion();
+    mVector2DTweens.RemovePendingDeletion();
+    mRotatorTweens.RemovePendingDeletion();
+    mLinearColorTweens.RemovePendingDeletion();
+    mFloatTweens.RemovePendingDeletion();
+}
+
+void FTweenStore::Reset()
+{
+    // Dense indices can't move while the lanes are being walked: the Tweens are dropped at the end of the update
+    if(bIsUpdating)
+    {
+        TweenStoreKernels::MarkAllPendingDeletion(mVectorTweens);
+        TweenStoreKernels::MarkAllPendingDeletion(mVector2DTweens);
+        TweenStoreKernels::MarkAllPendingDeletion(mRotatorTweens);
+        TweenStoreKernels::MarkAllPendingDeletion(mLinearColorTweens);
+        TweenStoreKernels::MarkAllPendingDeletion(mFloatTweens);
+        return;
+    }
+
+    mVectorTweens.Reset();
+    mVector2DTweens.Reset();
+    mRotatorTweens.Reset();
+    mLinearColorTweens.Reset();
+    mFloatTweens.Reset();
+}
+
+int32 FTweenStore::Num() const
+{
+    return mVectorTweens.Num() + mVector2DTweens.Num() + mRotatorTweens.Num() + mLinearColorTweens.Num() + mFloatTweens.Num();
+}
@@ -0,0 +1,82 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TweenStore/TweenStore.h"
+#include "Tweens/TweenFloat.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ **************************************************************************
+ * Automation tests of the FTweenStore update against the UBaseTween one.
+ * Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests TweenMaker.Store;Quit"
+ **************************************************************************
+ */
+
+
+/**
+ * Plays the same delayed "Custom" float Tween from the store and as a UTweenFloat, with time scales other than 1.
+ * The delay runs on the unscaled time for both, so they must start on the same frame and then keep the same value.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenStoreDelayTest, "TweenMaker.Store.DelayTimeScale",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenStoreDelayTest::RunTest(const FString &Parameters)
+{
+    const float duration = 1.0f;
+    const float delay = 0.5f;
+    const float deltaTime = 0.1f;
+    const int32 numFrames = 20;
+    const float tolerance = 1e-4f;
+
+    for(float timeScale : { 2.0f, 0.5f })
+    {
+        // Custom Tweens never touch their target, it only has to be valid
+        UTweenFloat *tween = NewObject<UTweenFloat>();
+        tween->InitBase(nullptr, 0, tween, ETweenTargetType::Custom, ETweenEaseType::Linear, duration, delay, timeScale, false);
+        tween->Init(0.0f, 1.0f, ETweenFloatType::Custom, NAME_None, nullptr);
+
+        FTweenStore store;
+        const FTweenHandle handle = store.AddFloat(tween, ETweenTargetType::Custom, ETweenFloatType::Custom, 0.0f, 1.0f,
+                                                   FTweenStoreParams(duration, ETweenEaseType::Linear, 1, ETweenLoopType::Yoyo, delay, timeScale, false));
+
+        int32 storeStartFrame = INDEX_NONE;
+        int32 tweenStartFrame = INDEX_NONE;
+        float maxError = 0.0f;
+
+        for(int32 frame = 0; frame < numFrames; ++frame)
+        {
+            store.Update(deltaTime, false);
+            const bool bHasEnded = tween->UpdateTween(deltaTime, 1.0f);
+
+            const FTweenFloatLane &lane = store.GetFloatLane();
+            const int32 index = lane.Find(handle);
+
+            if(storeStartFrame == INDEX_NONE && (index == INDEX_NONE || lane.mElapsedTime[index] > 0.0f))
+            {
+                storeStartFrame = frame;
+            }
+
+            if(tweenStartFrame == INDEX_NONE && (bHasEnded || tween->GetTweenElapsedTime() > 0.0f))
+            {
+                tweenStartFrame = frame;
+            }
+
+            if(index != INDEX_NONE && !bHasEnded)
+            {
+                maxError = FMath::Max(maxError, FMath::Abs(lane.mCurrentValue[index] - tween->GetCurrentValue()));
+            }
+        }
+
+        TestTrue(FString::Printf(TEXT("Time scale %.1f: the Tweens started"), timeScale), tweenStartFrame != INDEX_NONE);
+        TestEqual(FString::Printf(TEXT("Time scale %.1f: start frame"), timeScale), storeStartFrame, tweenStartFrame);
+        TestTrue(FString::Printf(TEXT("Time scale %.1f: max error %.2e within %.0e"), timeScale, maxError, tolerance), maxError <= tolerance);
+
+        tween->MarkPendingKill();
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,283 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenTransformBatch.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Utils/TweenStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Apply Transforms"), STAT_TweenApplyTransforms, STATGROUP_TweenMaker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transform Writes"), STAT_TweenTransformWrites, STATGROUP_TweenMaker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transform Updates"), STAT_TweenTransformUpdates, STATGROUP_TweenMaker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transform Updates Saved"), STAT_TweenTransformUpdatesSaved, STATGROUP_TweenMaker);
+
+FTweenTransformBatch* FTweenTransformBatch::ActiveBatch = nullptr;
+
+
+void FTweenTransformBatch::Open()
+{
+    check(IsInGameThread());
+    ensureMsgf(ActiveBatch == nullptr, TEXT("FTweenTransformBatch: a batch is already open"));
+
+    ActiveBatch = this;
+}
+
+void FTweenTransformBatch::Close()
+{
+    check(IsInGameThread());
+
+    // Closed before applying, so that the Tweens started by hit/overlap events during the moves write directly
+    if(ActiveBatch == this)
+    {
+        ActiveBatch = nullptr;
+    }
+
+    if(mPending.Num() == 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_TweenApplyTransforms);
+
+    for(FPendingTransform &pending : mPending)
+    {
+        Apply(pending);
+    }
+
+    Reset();
+}
+
+void FTweenTransformBatch::Reset()
+{
+    mPending.Reset();
+    mPendingIndices.Reset();
+}
+
+/*
+ **************************************************************************
+ * Methods used by the Tweens
+ **************************************************************************
+ */
+
+void FTweenTransformBatch::SetLocation(USceneComponent *pComponent, const FVector &pLocation, ETweenTransformSpace pSpace, bool pSweep)
+{
+    if(pComponent == nullptr)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_TweenTransformWrites);
+
+    if(ActiveBatch == nullptr)
+    {
+        INC_DWORD_STAT(STAT_TweenTransformUpdates);
+
+        if(pSpace == ETweenTransformSpace::World)
+        {
+            pComponent->SetWorldLocation(pLocation, pSweep);
+        }
+        else
+        {
+            pComponent->SetRelativeLocation(pLocation, pSweep);
+        }
+        return;
+    }
+
+    FPendingTransform &pending = ActiveBatch->FindOrAdd(pComponent);
+    pending.Location = pLocation;
+    pending.LocationSpace = pSpace;
+    pending.bHasLocation = true;
+    pending.bSweep |= pSweep;
+}
+
+void FTweenTransformBatch::SetRotation(USceneComponent *pComponent, const FRotator &pRotation, ETweenTransformSpace pSpace)
+{
+    if(pComponent == nullptr)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_TweenTransformWrites);
+
+    if(ActiveBatch == nullptr)
+    {
+        INC_DWORD_STAT(STAT_TweenTransformUpdates);
+
+        if(pSpace == ETweenTransformSpace::World)
+        {
+            pComponent->SetWorldRotation(pRotation);
+        }
+        else
+        {
+            pComponent->SetRelativeRotation(pRotation);
+        }
+        return;
+    }
+
+    FPendingTransform &pending = ActiveBatch->FindOrAdd(pComponent);
+    pending.Rotation = pRotation;
+    pending.RotationSpace = pSpace;
+    pending.bHasRotation = true;
+}
+
+void FTweenTransformBatch::SetScale(USceneComponent *pComponent, const FVector &pScale, ETweenTransformSpace pSpace)
+{
+    if(pComponent == nullptr)
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_TweenTransformWrites);
+
+    if(ActiveBatch == nullptr)
+    {
+        INC_DWORD_STAT(STAT_TweenTransformUpdates);
+
+        if(pSpace == ETweenTransformSpace::World)
+        {
+            pComponent->SetWorldScale3D(pScale);
+        }
+        else
+        {
+            pComponent->SetRelativeScale3D(pScale);
+        }
+        return;
+    }
+
+    FPendingTransform &pending = ActiveBatch->FindOrAdd(pComponent);
+    pending.Scale = pScale;
+    pending.ScaleSpace = pSpace;
+    pending.bHasScale = true;
+}
+
+void FTweenTransformBatch::FlushPending(UObject *pTarget)
+{
+    if(ActiveBatch == nullptr)
+    {
+        return;
+    }
+
+    USceneComponent *component = GetTargetComponent(pTarget);
+    const int32 *index = component != nullptr ? ActiveBatch->mPendingIndices.Find(component) : nullptr;
+
+    if(index != nullptr)
+    {
+        // The entry is kept, so that the next writes to the same component reuse it
+        Apply(ActiveBatch->mPending[*index]);
+    }
+}
+
+USceneComponent* FTweenTransformBatch::GetTargetComponent(UObject *pTarget)
+{
+    if(AActor *actor = Cast<AActor>(pTarget))
+    {
+        return actor->GetRootComponent();
+    }
+
+    return Cast<USceneComponent>(pTarget);
+}
+
+/*
+ **************************************************************************
+ * Private methods
+ **************************************************************************
+ */
+
+FTweenTransformBatch::FPendingTransform& FTweenTransformBatch::FindOrAdd(USceneComponent *pComponent)
+{
+    INC_DWORD_STAT(STAT_TweenTransformUpdatesSaved);
+
+    int32 &index = mPendingIndices.FindOrAdd(pComponent, INDEX_NONE);
+
+    // The address could also belong to a component destroyed earlier in the frame, whose writes are dropped
+    if(index == INDEX_NONE || mPending[index].Component.Get() != pComponent)
+    {
+        if(index == INDEX_NONE)
+        {
+            index = mPending.AddDefaulted();
+        }
+        else
+        {
+            mPending[index] = FPendingTransform();
+        }
+
+        mPending[index].Component = pComponent;
+    }
+
+    return mPending[index];
+}
+
+bool FTweenTransformBatch::Apply(FPendingTransform &pPending)
+{
+    USceneComponent *component = pPending.Component.Get();
+    const bool bHasWrites = pPending.bHasLocation || pPending.bHasRotation || pPending.bHasScale;
+
+    if(component != nullptr && !component->IsPendingKill() && bHasWrites)
+    {
+        // Every write was counted as saved; the one update done here is not
+        DEC_DWORD_STAT(STAT_TweenTransformUpdatesSaved);
+        INC_DWORD_STAT(STAT_TweenTransformUpdates);
+
+        // Children, overlaps and the render state are updated once, when the scope ends
+        FScopedMovementUpdate scopedUpdate(component, EScopedUpdate::DeferredUpdates);
+
+        const bool bIsWorldLocation = pPending.LocationSpace == ETweenTransformSpace::World;
+
+        // Rotations never sweep, so the two are only set together when the location doesn't either
+        if(pPending.bHasLocation && pPending.bHasRotation && pPending.LocationSpace == pPending.RotationSpace && !pPending.bSweep)
+        {
+            if(bIsWorldLocation)
+            {
+                component->SetWorldLocationAndRotation(pPending.Location, pPending.Rotation);
+            }
+            else
+            {
+                component->SetRelativeLocationAndRotation(pPending.Location, pPending.Rotation);
+            }
+        }
+        else
+        {
+            if(pPending.bHasLocation)
+            {
+                if(bIsWorldLocation)
+                {
+                    component->SetWorldLocation(pPending.Location, pPending.bSweep);
+                }
+                else
+                {
+                    component->SetRelativeLocation(pPending.Location, pPending.bSweep);
+                }
+            }
+
+            if(pPending.bHasRotation)
+            {
+                if(pPending.RotationSpace == ETweenTransformSpace::World)
+                {
+                    component->SetWorldRotation(pPending.Rotation);
+                }
+                else
+                {
+                    component->SetRelativeRotation(pPending.Rotation);
+                }
+            }
+        }
+
+        if(pPending.bHasScale)
+        {
+            if(pPending.ScaleSpace == ETweenTransformSpace::World)
+            {
+                component->SetWorldScale3D(pPending.Scale);
+            }
+            else
+            {
+                component->SetRelativeScale3D(pPending.Scale);
+            }
+        }
+    }
+
+    pPending.bHasLocation = false;
+    pPending.bHasRotation = false;
+    pPending.bHasScale = false;
+    pPending.bSweep = false;
+
+    return component != nullptr && bHasWrites;
+}
@@ -0,0 +1,76 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Components/SceneComponent.h"
+#include "TweenManagerComponent.h"
+#include "TweenTransformBatch.h"
+#include "Tweens/TweenVector.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ **************************************************************************
+ * Automation tests of the transform writes batched by the Tweens.
+ * Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests TweenMaker.Transform;Quit"
+ **************************************************************************
+ */
+
+
+/**
+ * Moves a SceneComponent with a MoveTo Tween while a FTweenTransformBatch is open, as UTweenWorldSubsystem::Tick does.
+ * The update and end listeners read the location of the target, which must already be the value of the Tween.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenTransformListenerTest, "TweenMaker.Transform.UpdateListener",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenTransformListenerTest::RunTest(const FString &Parameters)
+{
+    const float deltaTime = 0.1f;
+    const int32 numFrames = 12;
+    const float tolerance = 1e-3f;
+
+    USceneComponent *component = NewObject<USceneComponent>();
+
+    UTweenVector *tween = NewObject<UTweenVector>();
+    tween->InitBase(nullptr, 0, component, ETweenTargetType::SceneComponent, ETweenEaseType::Linear, 1.0f, 0.0f, 1.0f, false);
+    tween->Init(FVector(0, 0, 0), FVector(100, 50, 0), ETweenVectorType::MoveTo, false, false, nullptr);
+
+    int32 numUpdateEvents = 0;
+    int32 numEndEvents = 0;
+    float maxUpdateError = 0.0f;
+    float endError = -1.0f;
+
+    tween->OnTweenUpdateDelegate.BindLambda([&](UTweenVector *pTween)
+    {
+        numUpdateEvents++;
+        maxUpdateError = FMath::Max(maxUpdateError, FVector::Dist(component->GetComponentLocation(), pTween->GetCurrentValue()));
+    });
+
+    tween->OnTweenEndDelegate.BindLambda([&](UTweenVector *pTween)
+    {
+        numEndEvents++;
+        endError = FVector::Dist(component->GetComponentLocation(), pTween->GetCurrentValue());
+    });
+
+    FTweenTransformBatch batch;
+
+    for(int32 frame = 0; frame < numFrames && numEndEvents == 0; ++frame)
+    {
+        batch.Open();
+        tween->UpdateTween(deltaTime, 1.0f);
+        batch.Close();
+    }
+
+    TestTrue(TEXT("The update event was broadcast"), numUpdateEvents > 0);
+    TestEqual(TEXT("The end event was broadcast once"), numEndEvents, 1);
+    TestTrue(FString::Printf(TEXT("Update events: max distance %.2e to the Tween value"), maxUpdateError), maxUpdateError <= tolerance);
+    TestTrue(FString::Printf(TEXT("End event: distance %.2e to the Tween value"), endError), endError >= 0.0f && endError <= tolerance);
+
+    tween->MarkPendingKill();
+    component->MarkPendingKill();
+
+    return true;
+}
+
+#endif
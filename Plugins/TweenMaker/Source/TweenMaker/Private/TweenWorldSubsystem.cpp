@@ -0,0 +1,162 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenWorldSubsystem.h"
+#include "Runtime/Engine/Classes/Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "TweenManagerComponent.h"
+
+
+void FTweenWorldSubsystemTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if(Target != nullptr && !Target->IsPendingKill())
+    {
+        Target->Tick(DeltaTime);
+    }
+}
+
+FString FTweenWorldSubsystemTickFunction::DiagnosticMessage()
+{
+    return TEXT("FTweenWorldSubsystemTickFunction");
+}
+
+
+void UTweenWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Same settings the UTweenManagerComponents used when they were ticking on their own
+    mTickFunction.bCanEverTick = true;
+    mTickFunction.bStartWithTickEnabled = true;
+    mTickFunction.bTickEvenWhenPaused = true;
+    mTickFunction.TickGroup = TG_DuringPhysics;
+    mTickFunction.Target = this;
+}
+
+void UTweenWorldSubsystem::Deinitialize()
+{
+    if(mTickFunction.IsTickFunctionRegistered())
+    {
+        mTickFunction.UnRegisterTickFunction();
+    }
+
+    mTickFunction.Target = nullptr;
+    mTweenManagers.Reset();
+    mTransformBatch.Reset();
+    mEasingBatch.Reset();
+
+    Super::Deinitialize();
+}
+
+void UTweenWorldSubsystem::SetTickGroup(TEnumAsByte<ETickingGroup> pTickGroup)
+{
+    // The tick group is read every time the tick function is queued, so there is no need to register it again
+    mTickFunction.TickGroup = pTickGroup;
+}
+
+TEnumAsByte<ETickingGroup> UTweenWorldSubsystem::GetTickGroup() const
+{
+    return mTickFunction.TickGroup;
+}
+
+void UTweenWorldSubsystem::RegisterTweenManager(UTweenManagerComponent *pTweenManager)
+{
+    if(pTweenManager == nullptr)
+    {
+        return;
+    }
+
+    mTweenManagers.AddUnique(pTweenManager);
+
+    // The persistent level is not there yet when the subsystem is initialized, so the tick function is registered lazily
+    if(!mTickFunction.IsTickFunctionRegistered())
+    {
+        UWorld *world = GetWorld();
+
+        if(world != nullptr && world->PersistentLevel != nullptr)
+        {
+            mTickFunction.RegisterTickFunction(world->PersistentLevel);
+        }
+    }
+
+    mTickFunction.SetTickFunctionEnable(true);
+}
+
+void UTweenWorldSubsystem::UnregisterTweenManager(UTweenManagerComponent *pTweenManager)
+{
+    int32 index = mTweenManagers.Find(pTweenManager);
+
+    if(index == INDEX_NONE)
+    {
+        return;
+    }
+
+    // A Tween callback may destroy the Actor owning a TweenManager in the middle of the update,
+    // so in that case the entry is only nulled and the array is compacted at the end of the Tick
+    if(bIsTicking)
+    {
+        mTweenManagers[index] = nullptr;
+    }
+    else
+    {
+        mTweenManagers.RemoveAtSwap(index);
+
+        if(mTweenManagers.Num() == 0 && mTickFunction.IsTickFunctionRegistered())
+        {
+            mTickFunction.SetTickFunctionEnable(false);
+        }
+    }
+}
+
+void UTweenWorldSubsystem::Tick(float pDeltaTime)
+{
+    const UWorld *world = GetWorld();
+    const bool bIsGamePaused = world != nullptr && world->IsPaused();
+
+    bIsTicking = true;
+    mTransformBatch.Open();
+    mEasingBatch.Open();
+
+    // TweenManagers registered during the update (e.g. spawned by a Tween callback) will be updated starting from the next frame
+    const int32 numTweenManagers = mTweenManagers.Num();
+
+    for(int32 i = 0; i < numTweenManagers; ++i)
+    {
+        UTweenManagerComponent *tweenManager = mTweenManagers[i];
+
+        if(tweenManager == nullptr || tweenManager->IsPendingKill() || !tweenManager->IsActive())
+        {
+            continue;
+        }
+
+        // The component tick used to be scaled by the owner's time dilation, so that is kept
+        const AActor *owner = tweenManager->GetOwner();
+        const float deltaTime = owner != nullptr ? pDeltaTime * owner->CustomTimeDilation : pDeltaTime;
+
+        tweenManager->UpdateTweens(deltaTime, bIsGamePaused);
+    }
+
+    // The deferred Tweens are eased first, since their values go into the transform batch
+    mEasingBatch.Close();
+
+    // The moves, rotations and scales of the frame are applied here, once per target
+    mTransformBatch.Close();
+    bIsTicking = false;
+
+    mTweenManagers.RemoveAllSwap([](const UTweenManagerComponent *pTweenManager)
+    {
+        return pTweenManager == nullptr || pTweenManager->IsPendingKill();
+    });
+
+    if(mTweenManagers.Num() == 0)
+    {
+        mTickFunction.SetTickFunctionEnable(false);
+    }
+}
+
+UTweenWorldSubsystem* UTweenWorldSubsystem::Get(const UObject *pWorldContextObject)
+{
+    const UWorld *world = pWorldContextObject != nullptr ? pWorldContextObject->GetWorld() : nullptr;
+
+    return world != nullptr ? world->GetSubsystem<UTweenWorldSubsystem>() : nullptr;
+}
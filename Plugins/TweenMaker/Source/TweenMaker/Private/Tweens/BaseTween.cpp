@@ -9,6 +9,9 @@
 #include "TweenFactory/Standard/TweenLinearColorStandardFactory.h"
 #include "TweenFactory/Standard/TweenFloatStandardFactory.h"
 #include "TweenManagerComponent.h"
+#include "TweenEasingBatch.h"
+#include "TweenTransformBatch.h"
+#include "Utils/EaseEquations.h"
 #include "Curves/CurveFloat.h"
 
 
@@ -18,6 +21,7 @@ UBaseTween::UBaseTween(const FObjectInitializer& ObjectInitializer)
     mTweenName = NAME_None;
     mTweenDuration = 0.0f;
     mElapsedTime = 0.0f;
+    mOvershootTime = 0.0f;
     mTargetObject = nullptr;
     mTargetType = ETweenTargetType::Custom;
     mEaseType = ETweenEaseType::Linear;
@@ -29,6 +33,10 @@ UBaseTween::UBaseTween(const FObjectInitializer& ObjectInitializer)
     mTweenGenericType = ETweenGenericType::Any;
 	mCurveFloat = nullptr;
 	bTweenWhileGameIsPaused = false;
+    mUpdateEventFrameInterval = 1;
+    mUpdateEventMinProgressChange = 0.0f;
+    mUpdatesSinceUpdateEvent = 0;
+    mProgressAtUpdateEvent = -1.0f;
 
     bShouldInvertTweenFromStart = false;
     bIsTweenDone = false;
@@ -72,6 +80,7 @@ void UBaseTween::InitBase(UTweenContainer *pTweenContainer, int32 pSequenceIndex
 	bTweenWhileGameIsPaused = pTweenWhileGameIsPaused;
 
     mElapsedTime = 0.0f;
+    mOvershootTime = 0.0f;
     mDelayElapsedTime = 0.0f;
 
     bShouldInvertTweenFromStart = false;
@@ -84,7 +93,17 @@ void UBaseTween::InitBase(UTweenContainer *pTweenContainer, int32 pSequenceIndex
 }
 
 
-bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
+void UBaseTween::RestoreProgress(float pElapsedTime)
+{
+    mElapsedTime = pElapsedTime;
+    mDelayElapsedTime = mDelay;
+
+    bHasCalledPreDelay = true;
+    bHasPreparedTween = true;
+}
+
+
+bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale, bool pCanDeferEasing)
 {
     // I execute the update if this tween is NOT going to be deleted soon
     bool hasEnded = bIsPendingDeletion;
@@ -132,15 +151,46 @@ bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
             }
         }
 
+        // Updating the elapsed time, while considering the time scale, and checking if the Tween should end
+        mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
+        hasEnded = mElapsedTime >= mTweenDuration;
+
+        // If nobody needs the value right away, it's eased at the end of the frame along with the other Tweens
+        // using the same ease type (see FTweenEasingBatch)
+        if(!hasEnded && pCanDeferEasing && mCurveFloat == nullptr && !IsOnTweenUpdateBound() &&
+           FTweenEasingBatch::Defer(this, mEaseType, mElapsedTime, mTweenDuration))
+        {
+            return false;
+        }
+
+        // The Tweens deferred on the same target were updated before this one, so they must write it first
+        FTweenEasingBatch::FlushTarget(mTargetObject.Get());
+
 		// Handling the actual update
-        hasEnded = Update(pDeltaTime, pTimeScale);
+        ComputeValue(hasEnded ? 1.0f : ComputeEasingAlpha(), hasEnded);
+        ApplyValue();
 		
+        const bool bShouldBroadcastUpdate = ShouldBroadcastOnTweenUpdate(hasEnded);
+
+        // The listeners may read the transform of the target, so the write batched above must be applied before they're called
+        if(bShouldBroadcastUpdate || hasEnded)
+        {
+            FTweenTransformBatch::FlushPending(mTargetObject.Get());
+        }
+
 		// Always broadcast the "update" event, even if the Tween is ending. This way the user 
 		// can receive "one last" update event before ending
-		BroadcastOnTweenUpdate();
+		if(bShouldBroadcastUpdate)
+		{
+			BroadcastOnTweenUpdate();
+		}
 
         if (hasEnded)
         {
+            // Kept for the UTweenContainer, which gives it to whatever comes next (the next sequence or loop)
+            const float timeScale = pTimeScale * mTimeScaleAbsolute;
+            mOvershootTime = timeScale > 0.0f ? FMath::Clamp((mElapsedTime - mTweenDuration) / timeScale, 0.0f, pDeltaTime) : 0.0f;
+
             BroadcastOnTweenEnd();
             bIsTweenDone = true;
         }
@@ -149,13 +199,63 @@ bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
     return hasEnded;
 }
 
-void UBaseTween::PreDestroy()
+bool UBaseTween::CanFinishDeferredUpdate(float pElapsedTime) const
 {
-    // Only fire the event if there is valid name (since for now the delegate only does something if that happens)
-    if (mTweenName != NAME_None)
+    // The Tween was deleted, restarted or moved by a callback after being deferred: the value isn't the one of this frame anymore
+    return !bIsPendingDeletion && mElapsedTime == pElapsedTime && mTargetObject.IsValid();
+}
+
+void UBaseTween::ComputeDeferredValue(float pAlpha)
+{
+    ComputeValue(pAlpha, false);
+}
+
+void UBaseTween::ApplyDeferredValue()
+{
+    ApplyValue();
+}
+
+float UBaseTween::ComputeEasingAlpha() const
+{
+    if(mCurveFloat)
+    {
+        return EaseEquations::ComputeCustomFloatEasing(mCurveFloat, mElapsedTime, 0.0f, 1.0f, mTweenDuration);
+    }
+
+    return EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, 0.0f, 1.0f, mTweenDuration);
+}
+
+bool UBaseTween::ShouldBroadcastOnTweenUpdate(bool pHasEnded)
+{
+    // Nobody listens: the event is not even built
+    if(!IsOnTweenUpdateBound())
+    {
+        return false;
+    }
+
+    ++mUpdatesSinceUpdateEvent;
+
+    const float progress = mTweenDuration > 0.0f ? mElapsedTime / mTweenDuration : 1.0f;
+    const bool bIsFirstEvent = mProgressAtUpdateEvent < 0.0f;
+
+    // The absolute value also covers the Tweens going backward (inverted or yoyo-ing)
+    const bool bIsRateMet = mUpdatesSinceUpdateEvent >= mUpdateEventFrameInterval &&
+                            FMath::Abs(progress - mProgressAtUpdateEvent) >= mUpdateEventMinProgressChange;
+
+    if(pHasEnded || bIsFirstEvent || bIsRateMet)
     {
-        OnTweenDestroyed.Broadcast(this);
+        mUpdatesSinceUpdateEvent = 0;
+        mProgressAtUpdateEvent = progress;
+        return true;
     }
+
+    return false;
+}
+
+void UBaseTween::PreDestroy()
+{
+    // Always fired, since the TweenManagerComponent releases the reference of the Tween when it's destroyed
+    OnTweenDestroyed.Broadcast(this);
 }
 
 /*
@@ -248,6 +348,12 @@ void UBaseTween::SetCustomEasisng(UCurveFloat *Curve)
 	mCurveFloat = Curve;
 }
 
+void UBaseTween::SetUpdateEventRate(int32 FrameInterval, float MinProgressChange)
+{
+    mUpdateEventFrameInterval = FMath::Max(1, FrameInterval);
+    mUpdateEventMinProgressChange = FMath::Clamp(MinProgressChange, 0.0f, 1.0f);
+}
+
 /*
  **************************************************************************
  * "Append Tween" methods
@@ -7,6 +7,7 @@ FParallelTween::FParallelTween()
     mNumLoops = 1;
     mLoopType = ETweenLoopType::Yoyo;
     mLoopCounter = 0;
+    mLeftoverTime = 0.0f;
     ParallelTweens.Reset();
 }
 
@@ -16,18 +17,25 @@ FParallelTween::FParallelTween(UBaseTween *pTween)
     mNumLoops = pTween->GetNumLoops();
     mLoopType = pTween->GetLoopType();
     mLoopCounter = 0;
+    mLeftoverTime = 0.0f;
 
     ParallelTweens.Add(pTween);
 }
 
-bool FParallelTween::UpdateParallelTweens(float pDeltaTime, float pTimeScale)
+bool FParallelTween::UpdateParallelTweens(float pDeltaTime, float pTimeScale, TArray<UBaseTween*> *pOutUpdatedTweens, bool pCanDeferEasing)
 {
+    const bool bCanDeferEasing = pCanDeferEasing && pOutUpdatedTweens == nullptr;
+
     // Saving the number of Tweens during the update. The UTweenContainer might check after the Update if the value has changed
     mTweensNumAtUpdate = ParallelTweens.Num();
 
     // The slowest Tween will "take the lead". The Tweens will be done when the slowest one will finish
     bool areTweensDone = true;
 
+    // Time left after the last Tween to end in this update ended, if any did. Tweens ended in previous updates don't count
+    bool hasAnyTweenEnded = false;
+    float leftoverTime = pDeltaTime;
+
     // Iterating backwards, in case I need to remove some Tweens
     for(int i = ParallelTweens.Num() - 1; i >= 0; --i)
     {
@@ -50,11 +58,27 @@ bool FParallelTween::UpdateParallelTweens(float pDeltaTime, float pTimeScale)
 
         // If the Tween is not paused, I'll update it and check if it's completed
         if(!tween->IsTweenPaused())
-            isTweenDone = tween->UpdateTween(pDeltaTime, pTimeScale);
+        {
+            isTweenDone = tween->UpdateTween(pDeltaTime, pTimeScale, bCanDeferEasing);
+
+            // Deleted Tweens also report they're done, but they didn't reach their end
+            if(isTweenDone && tween->IsTweenDone())
+            {
+                hasAnyTweenEnded = true;
+                leftoverTime = FMath::Min(leftoverTime, tween->GetOvershootTime());
+            }
+
+            if(pOutUpdatedTweens != nullptr)
+            {
+                pOutUpdatedTweens->Add(tween);
+            }
+        }
 
         areTweensDone = areTweensDone && isTweenDone;
     }
 
+    mLeftoverTime = areTweensDone && hasAnyTweenEnded ? leftoverTime : 0.0f;
+
     // If ALL Tweens are done, I need either to loop them all or to tell the owning UTweenContainer that they're done
     if(areTweensDone)
     {
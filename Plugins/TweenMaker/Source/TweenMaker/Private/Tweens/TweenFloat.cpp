@@ -10,6 +10,8 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Components/SplineComponent.h"
 #include "Components/Widget.h"
+#include "TweenTransformBatch.h"
+#include "Utils/SplineArcLengthTable.h"
 
 UTweenFloat::UTweenFloat(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -84,36 +86,29 @@ void UTweenFloat::InitFollowSpline(USplineComponent *pSpline, bool pApplyRotatio
 	mNextPointIndex = FMath::Clamp(mNextPointIndex, 0, mSpline->GetNumberOfSplinePoints());
 }
 
-bool UTweenFloat::Update(float pDeltaTime, float pTimeScale)
+void UTweenFloat::RestoreStoredValues(float pFrom, float pTo, float pBaseOffset)
 {
-    Super::Update(pDeltaTime, pTimeScale);
-
-    bool hasEnded = false;
-
-    // Updating the elapsed time, while considering the time scale
-    mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
-
-    // Checking if the Tween should end
-    hasEnded = mElapsedTime >= mTweenDuration;
+    mFrom = pFrom;
+    mTo = pTo;
+    mPreviousValue = pFrom;
+}
 
+void UTweenFloat::ComputeValue(float pAlpha, bool pHasEnded)
+{
     // If the Tween is ending, I'll set the current value to the desired value
-    if(hasEnded)
+    if(pHasEnded)
     {
         mCurrentValue = mTo;
     }
-    // Otherwise I'll compute the new value with the chosen easing function
+    // Otherwise I'll compute the new value from the eased progress
     else
     {
-		if(mCurveFloat)
-		{
-			mCurrentValue = EaseEquations::ComputeCustomFloatEasing(mCurveFloat, mElapsedTime, mFrom, mTo, mTweenDuration);
-		}
-		else
-		{
-			mCurrentValue = EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, mFrom, mTo, mTweenDuration);
-		}
+        mCurrentValue = mFrom + (mTo - mFrom) * pAlpha;
     }
+}
 
+void UTweenFloat::ApplyValue()
+{
     // Depending on the type of tween target, I'll call the appropriate method for handling the new value
     switch(mTargetType)
     {
@@ -148,8 +143,6 @@ bool UTweenFloat::Update(float pDeltaTime, float pTimeScale)
     }
 
     mPreviousValue = mCurrentValue;
-
-    return hasEnded;
 }
 
 /*
@@ -174,49 +167,8 @@ void UTweenFloat::UpdateForMaterial(UMaterialInstanceDynamic *pTarget)
 
 void UTweenFloat::UpdateForActor(AActor *pTarget)
 {
-    switch(mTweenType)
-    {
-        case ETweenFloatType::RotateAroundPoint:
-        {
-            // Computing the delta angle
-            float angle = mCurrentValue - mPreviousValue;
-
-            // Rotating the offset vector by the angle delta. This basically rotates the vector around pivot point. The offset vector
-            // starts at the direction from the pivot point to the initial location of the target,
-            // and it rotates while still pointing towards the pivot point
-            mOffsetVector = mOffsetVector.RotateAngleAxis(angle, mAxis);
-
-            // Applying the offset vector to the target. Since the offset vector rotates around the origin,
-            // I add the rotation point to position the actor in the correct place
-            pTarget->SetActorRelativeLocation(mPivotPoint + mOffsetVector * mRadius, bHasBoundedFunctions);
-
-            break;
-        }
-        case ETweenFloatType::FollowSpline:
-        {
-            if(mSpline != nullptr)
-            {
-                FVector newLocation = mSpline->GetLocationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                pTarget->SetActorLocation(newLocation, bHasBoundedFunctions);
-
-                if(bSplineApplyRotation)
-                {
-                    FRotator newRotation = mSpline->GetRotationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                    pTarget->SetActorRotation(newRotation);
-                }
-
-                if(bSplineApplyScale)
-                {
-                    FVector newScale = mSpline->GetScaleAtTime(mCurrentValue, ESplineCoordinateSpace::World);
-                    pTarget->SetActorScale3D(newScale);
-                }
-
-                CheckSplinePointReached(newLocation);
-            }
-
-            break;
-        }
-    }
+    // Actors are moved through their root component, as SetActorLocation & co. do
+    UpdateForSceneComponent(pTarget->GetRootComponent());
 }
 
 void UTweenFloat::UpdateForSceneComponent(USceneComponent *pTarget)
@@ -235,7 +187,7 @@ void UTweenFloat::UpdateForSceneComponent(USceneComponent *pTarget)
 
             // Applying the offset vector to the target. Since the offset vector rotates around the origin,
             // I add the rotation point to position the actor in the correct place
-            pTarget->SetRelativeLocation(mPivotPoint + mOffsetVector * mRadius, bHasBoundedFunctions);
+            FTweenTransformBatch::SetLocation(pTarget, mPivotPoint + mOffsetVector * mRadius, ETweenTransformSpace::Relative, bHasBoundedFunctions);
 
             break;
         }
@@ -243,22 +195,21 @@ void UTweenFloat::UpdateForSceneComponent(USceneComponent *pTarget)
         {
             if(mSpline != nullptr)
             {
-                FVector newLocation = mSpline->GetLocationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                pTarget->SetWorldLocation(newLocation, bHasBoundedFunctions);
+                // A single lookup in the table of the spline, shared with the other Tweens following it
+                const FSplineTableSample sample = FSplineArcLengthTables::SampleAtTime(mSpline, mCurrentValue, bUseConstantSpeed);
+                FTweenTransformBatch::SetLocation(pTarget, sample.Location, ETweenTransformSpace::World, bHasBoundedFunctions);
 
                 if(bSplineApplyRotation)
                 {
-                    FRotator newRotation = mSpline->GetRotationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                    pTarget->SetWorldRotation(newRotation);
+                    FTweenTransformBatch::SetRotation(pTarget, sample.Rotation.Rotator(), ETweenTransformSpace::World);
                 }
 
                 if(bSplineApplyScale)
                 {
-                    FVector newScale = mSpline->GetScaleAtTime(mCurrentValue, ESplineCoordinateSpace::World);
-                    pTarget->SetWorldScale3D(newScale);
+                    FTweenTransformBatch::SetScale(pTarget, sample.Scale, ETweenTransformSpace::World);
                 }
 
-                CheckSplinePointReached(newLocation);
+                CheckSplinePointReached(sample.InputKey);
             }
 
             break;
@@ -284,7 +235,7 @@ void UTweenFloat::UpdateForWidget(UWidget *pTarget)
     }
 }
 
-void UTweenFloat::CheckSplinePointReached(const FVector& WorldPosition)
+void UTweenFloat::CheckSplinePointReached(float pInputKey)
 {
     bool isSomethingBound = OnTweenSplinePointReached.IsBound() || OnTweenSplinePointReachedDelegate.IsBound();
 
@@ -293,11 +244,11 @@ void UTweenFloat::CheckSplinePointReached(const FVector& WorldPosition)
         int numPoints = mSpline->GetNumberOfSplinePoints();
         bool found = false;
 
-		// Find the input key at this position. From what I understand, I can consider "input keys" as normalized point indices. For example,
+		// The input key is where we are on the spline. From what I understand, I can consider "input keys" as normalized point indices. For example,
 		// If I'm going from point 2 to point 3 and I'm currently in the middle, the resulting input index will be 2.5. If I'm at 3/4 towards 
 		// point 3, the input key will be 2.75 and so on.
 		// So, to determine the closest point index, I take the current input key and round it
-		float closestInputKey = mSpline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		float closestInputKey = pInputKey;
 		int point = FMath::RoundToInt(closestInputKey);
 
 		// Several cases to consider, depending on whether the Tween is going backward and whether it's inverted.
@@ -344,6 +295,9 @@ void UTweenFloat::PrepareTween()
 {
     Super::PrepareTween();
 
+    // The starting values are read from the target, so the writes still pending on it must be applied first
+    FTweenTransformBatch::FlushPending(mTargetObject);
+
     switch(mTweenType)
     {
         case ETweenFloatType::MaterialScalarTo:
@@ -766,6 +720,16 @@ void UTweenFloat::BroadcastOnTweenUpdate()
     }
 }
 
+bool UTweenFloat::IsOnTweenUpdateBound() const
+{
+    if(TweenLatentProxy != nullptr)
+    {
+        return TweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
 void UTweenFloat::BroadcastOnTweenEnd()
 {
     Super::BroadcastOnTweenEnd();
@@ -42,40 +42,33 @@ void UTweenLinearColor::Init(const FName &pParameterName, const FLinearColor &pF
     CurrentValueVector = FVector(0, 0, 0);
 }
 
-// Comments on the code are in the class UTweenFloat because they're pretty similar
-bool UTweenLinearColor::Update(float pDeltaTime, float pTimeScale)
+void UTweenLinearColor::RestoreStoredValues(const FLinearColor &pFrom, const FLinearColor &pTo, const FLinearColor &pBaseOffset)
 {
-    Super::Update(pDeltaTime, pTimeScale);
-
-    bool hasEnded = false;
-
-    mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
+    From = pFrom;
+    To = pTo;
 
-    hasEnded = mElapsedTime >= mTweenDuration;
+    FromVector = FVector(From.R, From.G, From.B);
+    ToVector = FVector(To.R, To.G, To.B);
+}
 
-    if(hasEnded)
+// Comments on the code are in the class UTweenFloat because they're pretty similar
+void UTweenLinearColor::ComputeValue(float pAlpha, bool pHasEnded)
+{
+    if(pHasEnded)
     {
         CurrentValue = To;
     }
     else
     {
         // Computing the values for the RGB part and the alpha separately
-		float alpha = 0.0f;
+        CurrentValueVector = FromVector + (ToVector - FromVector) * pAlpha;
 
-		if(mCurveFloat)
-		{
-			EaseEquations::ComputeCustomVectorEasing(mCurveFloat, mElapsedTime, FromVector, ToVector, mTweenDuration, CurrentValueVector);
-			alpha = EaseEquations::ComputeCustomFloatEasing(mCurveFloat, mElapsedTime, From.A, To.A, mTweenDuration);
-		}
-		else
-		{
-			EaseEquations::ComputeVectorEasing(mEaseType, mElapsedTime, FromVector, ToVector, mTweenDuration, CurrentValueVector);
-			alpha = EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, From.A, To.A, mTweenDuration);
-		}
-
-        CurrentValue = FLinearColor(CurrentValueVector.X, CurrentValueVector.Y, CurrentValueVector.Z, alpha);
+        CurrentValue = FLinearColor(CurrentValueVector.X, CurrentValueVector.Y, CurrentValueVector.Z, From.A + (To.A - From.A) * pAlpha);
     }
+}
 
+void UTweenLinearColor::ApplyValue()
+{
     switch(mTargetType)
     {
         case ETweenTargetType::Material:
@@ -85,8 +78,6 @@ bool UTweenLinearColor::Update(float pDeltaTime, float pTimeScale)
             break;
         }
     }
-
-    return hasEnded;
 }
 
 void UTweenLinearColor::UpdateForMaterial(UMaterialInstanceDynamic *pTarget)
@@ -222,6 +213,16 @@ void UTweenLinearColor::BroadcastOnTweenUpdate()
     }
 }
 
+bool UTweenLinearColor::IsOnTweenUpdateBound() const
+{
+    if(TweenLatentProxy != nullptr)
+    {
+        return TweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
 void UTweenLinearColor::BroadcastOnTweenEnd()
 {
     Super::BroadcastOnTweenEnd();
@@ -7,6 +7,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Utils/EaseEquations.h"
+#include "TweenTransformBatch.h"
 
 UTweenRotator::UTweenRotator(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -46,51 +47,40 @@ void UTweenRotator::Init(const FRotator &pFrom, const FRotator &pTo, ETweenRotat
     mBaseOffset = FQuat::Identity;
 }
 
-// Comments on the code are in the class UTweenFloat because they're pretty similar
-bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
+void UTweenRotator::RestoreStoredValues(const FRotator &pFrom, const FRotator &pTo, const FRotator &pBaseOffset)
 {
-    Super::Update(pDeltaTime, pTimeScale);
-
-    bool hasEnded = false;
-
-    mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
-
-    hasEnded = mElapsedTime >= mTweenDuration;
+    mFrom = pFrom.Quaternion();
+    mTo = pTo.Quaternion();
+    mFromRotator = pFrom;
+    mToRotator = pTo;
+    mBaseOffset = pBaseOffset.Quaternion();
+}
 
-    if(hasEnded)
+// Comments on the code are in the class UTweenFloat because they're pretty similar
+void UTweenRotator::ComputeValue(float pAlpha, bool pHasEnded)
+{
+    if(pHasEnded)
     {
         mCurrentValue = mTo;
     }
-    else
+    else if(mTweenType == ETweenRotatorType::RotateBy)
     {
-        // To rotate I first compute the float for the spherical interpolation
-		float alpha = 0;
+        float pitch = FMath::Lerp(mFromRotator.Pitch, mToRotator.Pitch, pAlpha);
+        float yaw = FMath::Lerp(mFromRotator.Yaw, mToRotator.Yaw, pAlpha);
+        float roll = FMath::Lerp(mFromRotator.Roll, mToRotator.Roll, pAlpha);
 
-		if(mCurveFloat)
-		{
-			alpha = EaseEquations::ComputeCustomFloatEasing(mCurveFloat, mElapsedTime, 0, 1.0f, mTweenDuration);
-		}
-		else
-		{
-			alpha = EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, 0, 1.0f, mTweenDuration);
-		}
-
-        if(mTweenType == ETweenRotatorType::RotateBy)
-        {
-            float pitch = FMath::Lerp(mFromRotator.Pitch, mToRotator.Pitch, alpha);
-            float yaw = FMath::Lerp(mFromRotator.Yaw, mToRotator.Yaw, alpha);
-            float roll = FMath::Lerp(mFromRotator.Roll, mToRotator.Roll, alpha);
-
-            FRotator rot = FRotator(pitch, yaw, roll);
-            mCurrentValue = rot.Quaternion();
-        }
-        else
-        {
-            mCurrentValue = FQuat::Slerp(mFrom, mTo, alpha);
-        }
+        FRotator rot = FRotator(pitch, yaw, roll);
+        mCurrentValue = rot.Quaternion();
     }
+    else
+    {
+        // The eased progress is used for the spherical interpolation
+        mCurrentValue = FQuat::Slerp(mFrom, mTo, pAlpha);
+    }
+}
 
-
+void UTweenRotator::ApplyValue()
+{
     switch(mTargetType)
     {
         case ETweenTargetType::Actor:
@@ -106,8 +96,6 @@ bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
             break;
         }
     }
-
-    return hasEnded;
 }
 
 /*
@@ -118,34 +106,24 @@ bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
 
 void UTweenRotator::UpdateForActor(AActor *pTarget)
 {
-    switch(mTweenType)
-    {
-        case ETweenRotatorType::RotateTo:
-        {
-            pTarget->SetActorRotation(mCurrentValue.Rotator());
-            break;
-        }
-        case ETweenRotatorType::RotateBy:
-        {
-            pTarget->SetActorRelativeRotation(UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), mCurrentValue.Rotator()));
-            break;
-        }
-    }
+    // Actors are rotated through their root component, as SetActorRotation & co. do
+    UpdateForSceneComponent(pTarget->GetRootComponent());
 }
 
 
 void UTweenRotator::UpdateForSceneComponent(USceneComponent *pTarget)
 {
+    // The values are collected in the transform batch and applied once per target at the end of the update
     switch(mTweenType)
     {
         case ETweenRotatorType::RotateTo:
         {
-            pTarget->SetWorldRotation(mCurrentValue.Rotator());
+            FTweenTransformBatch::SetRotation(pTarget, mCurrentValue.Rotator(), ETweenTransformSpace::World);
             break;
         }
         case ETweenRotatorType::RotateBy:
         {
-            pTarget->SetRelativeRotation(UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), mCurrentValue.Rotator()));
+            FTweenTransformBatch::SetRotation(pTarget, UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), mCurrentValue.Rotator()), ETweenTransformSpace::Relative);
             break;
         }
     }
@@ -162,6 +140,9 @@ void UTweenRotator::PrepareTween()
 {
     Super::PrepareTween();
 
+    // The starting values are read from the target, so the writes still pending on it must be applied first
+    FTweenTransformBatch::FlushPending(mTargetObject);
+
     switch(mTweenType)
     {
         case ETweenRotatorType::RotateTo:
@@ -531,6 +512,16 @@ void UTweenRotator::BroadcastOnTweenUpdate()
     }
 }
 
+bool UTweenRotator::IsOnTweenUpdateBound() const
+{
+    if(mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
 void UTweenRotator::BroadcastOnTweenEnd()
 {
     Super::BroadcastOnTweenEnd();
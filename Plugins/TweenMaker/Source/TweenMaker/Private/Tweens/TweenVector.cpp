@@ -7,6 +7,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "Utils/EaseEquations.h"
 #include "Curves/CurveFloat.h"
+#include "TweenTransformBatch.h"
 
 UTweenVector::UTweenVector(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -42,33 +43,28 @@ void UTweenVector::Init(const FVector &pFrom, const FVector &pTo, ETweenVectorTy
 }
 
 
-// Comments on the code are in the class UTweenFloat because they're pretty similar
-bool UTweenVector::Update(float pDeltaTime, float pTimeScale)
+void UTweenVector::RestoreStoredValues(const FVector &pFrom, const FVector &pTo, const FVector &pBaseOffset)
 {
-    Super::Update(pDeltaTime, pTimeScale);
-
-    bool hasEnded = false;
-
-    mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
-
-    hasEnded = mElapsedTime >= mTweenDuration;
+    mFrom = pFrom;
+    mTo = pTo;
+    mBaseOffset = pBaseOffset;
+}
 
-    if(hasEnded)
+// Comments on the code are in the class UTweenFloat because they're pretty similar
+void UTweenVector::ComputeValue(float pAlpha, bool pHasEnded)
+{
+    if(pHasEnded)
     {
         mCurrentValue = mTo;
     }
     else
     {
-		if(mCurveFloat)
-		{
-			EaseEquations::ComputeCustomVectorEasing(mCurveFloat, mElapsedTime, mFrom, mTo, mTweenDuration, mCurrentValue);
-		}
-		else
-		{
-			EaseEquations::ComputeVectorEasing(mEaseType, mElapsedTime, mFrom, mTo, mTweenDuration, mCurrentValue);
-		}
+        mCurrentValue = mFrom + (mTo - mFrom) * pAlpha;
     }
+}
 
+void UTweenVector::ApplyValue()
+{
     switch(mTargetType)
     {
         case ETweenTargetType::Actor:
@@ -84,8 +80,6 @@ bool UTweenVector::Update(float pDeltaTime, float pTimeScale)
             break;
         }
     }
-
-    return hasEnded;
 }
 
 /*
@@ -97,61 +91,35 @@ bool UTweenVector::Update(float pDeltaTime, float pTimeScale)
 
 void UTweenVector::UpdateForActor(AActor *pTarget)
 {
-    switch(mTweenType)
-    {
-        case ETweenVectorType::MoveTo:
-        {
-            pTarget->SetActorLocation(mCurrentValue, bHasBoundedFunctions);
-            break;
-        }
-        case ETweenVectorType::MoveBy:
-        {
-             pTarget->SetActorRelativeLocation(mCurrentValue + mBaseOffset, bHasBoundedFunctions);
-            break;
-        }
-        case ETweenVectorType::ScaleTo:
-        {
-            pTarget->SetActorScale3D(mCurrentValue);
-            break;
-        }
-        case ETweenVectorType::ScaleBy:
-        {
-            pTarget->SetActorRelativeScale3D(mCurrentValue + mBaseOffset);
-            break;
-        }
-        // Does nothing
-        case ETweenVectorType::Custom:
-        {
-            break;
-        }
-    }
-
-
+    // Actors are moved through their root component, as SetActorLocation & co. do
+    UpdateForSceneComponent(pTarget->GetRootComponent());
 }
 
 
 void UTweenVector::UpdateForSceneComponent(USceneComponent *pTarget)
 {
+    // The values are collected in the transform batch and applied once per target at the end of the update;
+    // the move only sweeps if there is some hit/overlap event to fire
     switch(mTweenType)
     {
         case ETweenVectorType::MoveTo:
         {
-            pTarget->SetWorldLocation(mCurrentValue);
+            FTweenTransformBatch::SetLocation(pTarget, mCurrentValue, ETweenTransformSpace::World, bHasBoundedFunctions);
             break;
         }
         case ETweenVectorType::MoveBy:
         {
-            pTarget->SetRelativeLocation(mCurrentValue + mBaseOffset/*, true*/);
+            FTweenTransformBatch::SetLocation(pTarget, mCurrentValue + mBaseOffset, ETweenTransformSpace::Relative, bHasBoundedFunctions);
             break;
         }
         case ETweenVectorType::ScaleTo:
         {
-            pTarget->SetWorldScale3D(mCurrentValue);
+            FTweenTransformBatch::SetScale(pTarget, mCurrentValue, ETweenTransformSpace::World);
             break;
         }
         case ETweenVectorType::ScaleBy:
         {
-            pTarget->SetRelativeScale3D(mCurrentValue + mBaseOffset);
+            FTweenTransformBatch::SetScale(pTarget, mCurrentValue + mBaseOffset, ETweenTransformSpace::Relative);
             break;
         }
         // Does nothing
@@ -173,6 +141,9 @@ void UTweenVector::PrepareTween()
 {
     Super::PrepareTween();
 
+    // The starting values are read from the target, so the writes still pending on it must be applied first
+    FTweenTransformBatch::FlushPending(mTargetObject);
+
     switch(mTweenType)
     {
         case ETweenVectorType::MoveTo:
@@ -591,6 +562,16 @@ void UTweenVector::BroadcastOnTweenUpdate()
     }
 }
 
+bool UTweenVector::IsOnTweenUpdateBound() const
+{
+    if(mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
 void UTweenVector::BroadcastOnTweenEnd()
 {
     Super::BroadcastOnTweenEnd();
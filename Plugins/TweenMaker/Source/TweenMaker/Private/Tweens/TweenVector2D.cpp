@@ -33,33 +33,28 @@ void UTweenVector2D::Init(const FVector2D &pFrom, const FVector2D &pTo, ETweenVe
     mBaseOffset = FVector2D(0, 0);
 }
 
-// Comments on the code are in the class UTweenFloat because they're pretty similar
-bool UTweenVector2D::Update(float pDeltaTime, float pTimeScale)
+void UTweenVector2D::RestoreStoredValues(const FVector2D &pFrom, const FVector2D &pTo, const FVector2D &pBaseOffset)
 {
-    Super::Update(pDeltaTime, pTimeScale);
-
-    bool hasEnded = false;
-
-    mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
-
-    hasEnded = mElapsedTime >= mTweenDuration;
+    mFrom = pFrom;
+    mTo = pTo;
+    mBaseOffset = pBaseOffset;
+}
 
-    if(hasEnded)
+// Comments on the code are in the class UTweenFloat because they're pretty similar
+void UTweenVector2D::ComputeValue(float pAlpha, bool pHasEnded)
+{
+    if(pHasEnded)
     {
         mCurrentValue = mTo;
     }
     else
     {
-		if(mCurveFloat)
-		{
-			EaseEquations::ComputeCustomVector2DEasing(mCurveFloat, mElapsedTime, mFrom, mTo, mTweenDuration, mCurrentValue);
-		}
-		else
-		{
-			EaseEquations::ComputeVector2DEasing(mEaseType, mElapsedTime, mFrom, mTo, mTweenDuration, mCurrentValue);
-		}
+        mCurrentValue = mFrom + (mTo - mFrom) * pAlpha;
     }
+}
 
+void UTweenVector2D::ApplyValue()
+{
     switch(mTargetType)
     {
         case ETweenTargetType::UMG:
@@ -73,8 +68,6 @@ bool UTweenVector2D::Update(float pDeltaTime, float pTimeScale)
             break;
         }
     }
-
-    return hasEnded;
 }
 
 /*
@@ -309,6 +302,16 @@ void UTweenVector2D::BroadcastOnTweenUpdate()
     }
 }
 
+bool UTweenVector2D::IsOnTweenUpdateBound() const
+{
+    if(mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
 void UTweenVector2D::BroadcastOnTweenEnd()
 {
     Super::BroadcastOnTweenEnd();
@@ -2,6 +2,7 @@
 
 #include "Utils/EaseEquations.h"
 #include "Utils/Utility.h"
+#include "Utils/EaseLookupTable.h"
 #include "Curves/CurveFloat.h"
 
 EaseEquations::EaseEquations()
@@ -17,6 +18,12 @@ float EaseEquations::ComputeFloatEasing(ETweenEaseType pEaseType, float pCurrent
     float result = 0.0f;
     float valueSpan = pEndingValue - pStartingValue;
 
+    // Elastic, Bounce and Back may be read from a baked table instead (see the "TweenMaker.Ease.LUTBuiltInEquations" console variable)
+    if(const FEaseLookupTable *easeTable = FEaseLookupTables::FindEaseTable(pEaseType))
+    {
+        return pStartingValue + valueSpan * easeTable->Evaluate(pCurrentTime / pDuration);
+    }
+
     switch(pEaseType)
     {
     case ETweenEaseType::Linear:
@@ -234,13 +241,8 @@ float EaseEquations::ComputeCustomFloatEasing(UCurveFloat* pCurveFloat, float pC
 {
 	float result = 0.0f;
 
-	float minTime;
-	float maxTime;
-	pCurveFloat->GetTimeRange(minTime, maxTime);
-
-	// Convert the current time into a the corresponding curve value
-	float curveTime = Utility::MapToRange(pCurrentTime, 0, pDuration, minTime, maxTime);
-	float curveVal = pCurveFloat->GetFloatValue(curveTime);
+	// The curve is read from its baked table, shared by all Tweens using it
+	float curveVal = ComputeCustomEasingAlpha(pCurveFloat, pCurrentTime, pDuration);
 
 	float valueSpan = pEndingValue - pStartingValue;
 
@@ -249,592 +251,362 @@ float EaseEquations::ComputeCustomFloatEasing(UCurveFloat* pCurveFloat, float pC
 	return result;
 }
 
+float EaseEquations::ComputeCustomEasingAlpha(UCurveFloat *pCurveFloat, float pCurrentTime, float pDuration)
+{
+	// A zero duration maps to the beginning of the curve, as Utility::MapToRange does
+	const float normalizedTime = pDuration != 0.0f ? pCurrentTime / pDuration : 0.0f;
+
+	return FEaseLookupTables::EvaluateCurve(pCurveFloat, normalizedTime);
+}
+
 
 void EaseEquations::ComputeVectorEasing(ETweenEaseType pEaseType, float pCurrentTime, const FVector &pStartingValue,
                                 const FVector &pEndingValue, float pDuration, FVector &OutNewValue)
 {
-    FVector valueSpan = pEndingValue - pStartingValue;
+    // Every equation is linear in the starting value and in the span, so the ease is computed once (one switch, one divide)
+    // and shared by all the components
+    const float alpha = ComputeFloatEasing(pEaseType, pCurrentTime, 0.0f, 1.0f, pDuration);
 
-    switch(pEaseType)
+    OutNewValue = pStartingValue + (pEndingValue - pStartingValue) * alpha;
+}
+
+void EaseEquations::ComputeCustomVectorEasing(UCurveFloat* pCurveFloat, float pCurrentTime, const FVector &pStartingValue,
+											  const FVector &pEndingValue, float pDuration, FVector &OutNewValue)
+{
+	// The curve is read from its baked table, shared by all Tweens using it
+	float curveVal = ComputeCustomEasingAlpha(pCurveFloat, pCurrentTime, pDuration);
+
+	FVector valueSpan = pEndingValue - pStartingValue;
+
+	OutNewValue.X = pStartingValue.X + valueSpan.X * curveVal;
+	OutNewValue.Y = pStartingValue.Y + valueSpan.Y * curveVal;
+	OutNewValue.Z = pStartingValue.Z + valueSpan.Z * curveVal;
+}
+
+
+void EaseEquations::ComputeVector2DEasing(ETweenEaseType pEaseType, float pCurrentTime, const FVector2D &pStartingValue,
+                                const FVector2D &pEndingValue, float pDuration, FVector2D &OutNewValue)
+{
+    // Same as for 3D vectors: a single ease for both components
+    const float alpha = ComputeFloatEasing(pEaseType, pCurrentTime, 0.0f, 1.0f, pDuration);
+
+    OutNewValue = pStartingValue + (pEndingValue - pStartingValue) * alpha;
+}
+
+void EaseEquations::ComputeCustomVector2DEasing(UCurveFloat *pCurveFloat, float pCurrentTime, const FVector2D &pStartingValue,
+												const FVector2D &pEndingValue, float pDuration, FVector2D &OutNewValue)
+{
+	// The curve is read from its baked table, shared by all Tweens using it
+	float curveVal = ComputeCustomEasingAlpha(pCurveFloat, pCurrentTime, pDuration);
+
+	FVector2D valueSpan = pEndingValue - pStartingValue;
+
+	OutNewValue.X = pStartingValue.X + valueSpan.X * curveVal;
+	OutNewValue.Y = pStartingValue.Y + valueSpan.Y * curveVal;
+}
+
+/*
+ **************************************************************************
+ * Batch easing
+ **************************************************************************
+ */
+
+namespace EaseBatch
+{
+    /** How the "In" equation of a family is turned into its other variants, all on normalized time (0 to 1) */
+    enum class EMode : uint8
     {
-        case ETweenEaseType::Linear:
-        {
-            OutNewValue.X = EaseLinear(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseLinear(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseLinear(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInQuad:
-        {
-            OutNewValue.X = EaseInQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInQuad(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutQuad:
-        {
-            OutNewValue.X = EaseOutQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutQuad(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutQuad:
-        {
-            OutNewValue.X = EaseInOutQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutQuad(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInQuad:
-        {
-            OutNewValue.X = EaseOutInQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInQuad(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInCubic:
-        {
-            OutNewValue.X = EaseInCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInCubic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutCubic:
-        {
-            OutNewValue.X = EaseOutCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutCubic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutCubic:
-        {
-            OutNewValue.X = EaseInOutCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutCubic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInCubic:
-        {
-            OutNewValue.X = EaseOutInCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInCubic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInQuart:
-        {
-            OutNewValue.X = EaseInQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInQuart(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutQuart:
-        {
-            OutNewValue.X = EaseOutQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutQuart(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutQuart:
-        {
-            OutNewValue.X = EaseInOutQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutQuart(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInQuart:
-        {
-            OutNewValue.X = EaseOutInQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInQuart(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInQuint:
-        {
-            OutNewValue.X = EaseInQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInQuint(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutQuint:
-        {
-            OutNewValue.X = EaseOutQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutQuint(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutQuint:
-        {
-            OutNewValue.X = EaseInOutQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutQuint(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInQuint:
-        {
-            OutNewValue.X = EaseOutInQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInQuint(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInSine:
-        {
-            OutNewValue.X = EaseInSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInSine(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutSine:
-        {
-            OutNewValue.X = EaseOutSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutSine(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutSine:
-        {
-            OutNewValue.X = EaseInOutSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutSine(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInSine:
-        {
-            OutNewValue.X = EaseOutInSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInSine(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInExpo:
-        {
-            OutNewValue.X = EaseInExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInExpo(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutExpo:
-        {
-            OutNewValue.X = EaseOutExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutExpo(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutExpo:
-        {
-            OutNewValue.X = EaseInOutExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutExpo(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInExpo:
-        {
-            OutNewValue.X = EaseOutInExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInExpo(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInCirc:
-        {
-            OutNewValue.X = EaseInCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInCirc(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutCirc:
-        {
-            OutNewValue.X = EaseOutCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutCirc(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutCirc:
-        {
-            OutNewValue.X = EaseInOutCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutCirc(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInCirc:
-        {
-            OutNewValue.X = EaseOutInCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInCirc(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInElastic:
-        {
-            OutNewValue.X = EaseInElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInElastic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutElastic:
-        {
-            OutNewValue.X = EaseOutElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutElastic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutElastic:
-        {
-            OutNewValue.X = EaseInOutElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutElastic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInElastic:
-        {
-            OutNewValue.X = EaseOutInElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInElastic(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInBack:
-        {
-            OutNewValue.X = EaseInBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInBack(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutBack:
+        In,
+        Out,
+        InOut,
+        OutIn
+    };
+
+    /** x^N: the "In" equation of the Linear, Quad, Cubic, Quart and Quint families */
+    template<int32 N>
+    struct FPowerIn
+    {
+        FORCEINLINE VectorRegister operator()(const VectorRegister &x) const
         {
-            OutNewValue.X = EaseOutBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutBack(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
+            VectorRegister result = x;
+
+            for(int32 i = 1; i < N; ++i)
+            {
+                result = VectorMultiply(result, x);
+            }
+
+            return result;
         }
-        case ETweenEaseType::EaseInOutBack:
+    };
+
+    /** x^2 * ((s + 1) * x - s): the "In" equation of the Back family */
+    struct FBackIn
+    {
+        explicit FBackIn(float pOvershoot)
+            : S(VectorSetFloat1(pOvershoot))
+            , SPlusOne(VectorSetFloat1(pOvershoot + 1.0f))
         {
-            OutNewValue.X = EaseInOutBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutBack(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
         }
-        case ETweenEaseType::EaseOutInBack:
+
+        FORCEINLINE VectorRegister operator()(const VectorRegister &x) const
         {
-            OutNewValue.X = EaseOutInBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInBack(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
+            return VectorMultiply(VectorMultiply(x, x), VectorSubtract(VectorMultiply(SPlusOne, x), S));
         }
-        case ETweenEaseType::EaseInBounce:
+
+        VectorRegister S;
+        VectorRegister SPlusOne;
+    };
+
+    /**
+     * Out(x) = 1 - In(1 - x)
+     * InOut(x) = 0.5 * In(2x) in the first half, 1 - 0.5 * In(2 - 2x) in the second one
+     * OutIn(x) = 0.5 * Out(2x) in the first half, 0.5 + 0.5 * In(2x - 1) in the second one
+     */
+    template<EMode Mode, typename TIn>
+    FORCEINLINE VectorRegister EaseNormalized(const TIn &pIn, const VectorRegister &x)
+    {
+        const VectorRegister one = VectorSetFloat1(1.0f);
+        const VectorRegister two = VectorSetFloat1(2.0f);
+        const VectorRegister half = VectorSetFloat1(0.5f);
+
+        switch(Mode)
         {
-            OutNewValue.X = EaseInBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInBounce(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
+            case EMode::In:
+            {
+                return pIn(x);
+            }
+            case EMode::Out:
+            {
+                return VectorSubtract(one, pIn(VectorSubtract(one, x)));
+            }
+            case EMode::InOut:
+            {
+                const VectorRegister doubled = VectorMultiply(two, x);
+                const VectorRegister firstHalf = VectorMultiply(half, pIn(doubled));
+                const VectorRegister secondHalf = VectorSubtract(one, VectorMultiply(half, pIn(VectorSubtract(two, doubled))));
+
+                return VectorSelect(VectorCompareGE(x, half), secondHalf, firstHalf);
+            }
+            case EMode::OutIn:
+            {
+                const VectorRegister doubled = VectorMultiply(two, x);
+                const VectorRegister firstHalf = VectorSubtract(half, VectorMultiply(half, pIn(VectorSubtract(one, doubled))));
+                const VectorRegister secondHalf = VectorMultiplyAdd(half, pIn(VectorSubtract(doubled, one)), half);
+
+                return VectorSelect(VectorCompareGE(x, half), secondHalf, firstHalf);
+            }
         }
-        case ETweenEaseType::EaseOutBounce:
+
+        return x;
+    }
+
+    template<EMode Mode, typename TIn>
+    void Run(const TIn &pIn, int32 pNum, const float *pCurrentTimes, const float *pDurations, float *OutAlphas)
+    {
+        int32 i = 0;
+
+        for(; i + 4 <= pNum; i += 4)
         {
-            OutNewValue.X = EaseOutBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutBounce(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
+            const VectorRegister x = VectorDivide(VectorLoad(pCurrentTimes + i), VectorLoad(pDurations + i));
+            VectorStore(EaseNormalized<Mode>(pIn, x), OutAlphas + i);
         }
-        case ETweenEaseType::EaseInOutBounce:
+
+        // The last Tweens (up to 3) go through a padded register
+        const int32 remaining = pNum - i;
+
+        if(remaining > 0)
         {
-            OutNewValue.X = EaseInOutBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseInOutBounce(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
+            float times[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float durations[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            float alphas[4];
+
+            FMemory::Memcpy(times, pCurrentTimes + i, remaining * sizeof(float));
+            FMemory::Memcpy(durations, pDurations + i, remaining * sizeof(float));
+
+            const VectorRegister x = VectorDivide(VectorLoad(times), VectorLoad(durations));
+            VectorStore(EaseNormalized<Mode>(pIn, x), alphas);
+
+            FMemory::Memcpy(OutAlphas + i, alphas, remaining * sizeof(float));
         }
-        case ETweenEaseType::EaseOutInBounce:
+    }
+
+    template<typename TIn>
+    void RunFamily(EMode pMode, const TIn &pIn, int32 pNum, const float *pCurrentTimes, const float *pDurations, float *OutAlphas)
+    {
+        switch(pMode)
         {
-            OutNewValue.X = EaseOutInBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            OutNewValue.Z = EaseOutInBounce(pCurrentTime, pStartingValue.Z, valueSpan.Z, pDuration);
-            break;
+            case EMode::In: Run<EMode::In>(pIn, pNum, pCurrentTimes, pDurations, OutAlphas); break;
+            case EMode::Out: Run<EMode::Out>(pIn, pNum, pCurrentTimes, pDurations, OutAlphas); break;
+            case EMode::InOut: Run<EMode::InOut>(pIn, pNum, pCurrentTimes, pDurations, OutAlphas); break;
+            case EMode::OutIn: Run<EMode::OutIn>(pIn, pNum, pCurrentTimes, pDurations, OutAlphas); break;
         }
     }
+
+    /** The ease types are declared family by family, always in the In, Out, InOut, OutIn order (Linear excluded) */
+    EMode GetMode(ETweenEaseType pEaseType)
+    {
+        return pEaseType == ETweenEaseType::Linear ? EMode::In : (EMode)(((int32)pEaseType - 1) % 4);
+    }
 }
 
-void EaseEquations::ComputeCustomVectorEasing(UCurveFloat* pCurveFloat, float pCurrentTime, const FVector &pStartingValue,
-											  const FVector &pEndingValue, float pDuration, FVector &OutNewValue)
+void EaseEquations::ComputeEasingAlphaBatch(ETweenEaseType pEaseType, int32 pNum, const float *pCurrentTimes, const float *pDurations, float *OutAlphas)
 {
-	float minTime;
-	float maxTime;
-	pCurveFloat->GetTimeRange(minTime, maxTime);
-
-	float curveTime = Utility::MapToRange(pCurrentTime, 0, pDuration, minTime, maxTime);
-	float curveVal = pCurveFloat->GetFloatValue(curveTime);
+    using namespace EaseBatch;
 
-	FVector valueSpan = pEndingValue - pStartingValue;
-
-	OutNewValue.X = pStartingValue.X + valueSpan.X * curveVal;
-	OutNewValue.Y = pStartingValue.Y + valueSpan.Y * curveVal;
-	OutNewValue.Z = pStartingValue.Z + valueSpan.Z * curveVal;
-}
+    if(pNum <= 0)
+    {
+        return;
+    }
 
-
-void EaseEquations::ComputeVector2DEasing(ETweenEaseType pEaseType, float pCurrentTime, const FVector2D &pStartingValue,
-                                const FVector2D &pEndingValue, float pDuration, FVector2D &OutNewValue)
-{
-    FVector2D valueSpan = pEndingValue - pStartingValue;
+    const EMode mode = GetMode(pEaseType);
 
     switch(pEaseType)
     {
         case ETweenEaseType::Linear:
         {
-            OutNewValue.X = EaseLinear(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseLinear(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FPowerIn<1>(), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
         case ETweenEaseType::EaseInQuad:
-        {
-            OutNewValue.X = EaseInQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutQuad:
-        {
-            OutNewValue.X = EaseOutQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseInOutQuad:
-        {
-            OutNewValue.X = EaseInOutQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutInQuad:
         {
-            OutNewValue.X = EaseOutInQuad(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInQuad(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FPowerIn<2>(), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
         case ETweenEaseType::EaseInCubic:
-        {
-            OutNewValue.X = EaseInCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutCubic:
-        {
-            OutNewValue.X = EaseOutCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseInOutCubic:
-        {
-            OutNewValue.X = EaseInOutCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutInCubic:
         {
-            OutNewValue.X = EaseOutInCubic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInCubic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FPowerIn<3>(), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
         case ETweenEaseType::EaseInQuart:
-        {
-            OutNewValue.X = EaseInQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutQuart:
-        {
-            OutNewValue.X = EaseOutQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseInOutQuart:
-        {
-            OutNewValue.X = EaseInOutQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutInQuart:
         {
-            OutNewValue.X = EaseOutInQuart(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInQuart(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FPowerIn<4>(), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
         case ETweenEaseType::EaseInQuint:
-        {
-            OutNewValue.X = EaseInQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutQuint:
-        {
-            OutNewValue.X = EaseOutQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseInOutQuint:
-        {
-            OutNewValue.X = EaseInOutQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutInQuint:
         {
-            OutNewValue.X = EaseOutInQuint(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInQuint(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInSine:
-        {
-            OutNewValue.X = EaseInSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutSine:
-        {
-            OutNewValue.X = EaseOutSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutSine:
-        {
-            OutNewValue.X = EaseInOutSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInSine:
-        {
-            OutNewValue.X = EaseOutInSine(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInSine(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInExpo:
-        {
-            OutNewValue.X = EaseInExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutExpo:
-        {
-            OutNewValue.X = EaseOutExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutExpo:
-        {
-            OutNewValue.X = EaseInOutExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInExpo:
-        {
-            OutNewValue.X = EaseOutInExpo(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInExpo(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInCirc:
-        {
-            OutNewValue.X = EaseInCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutCirc:
-        {
-            OutNewValue.X = EaseOutCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutCirc:
-        {
-            OutNewValue.X = EaseInOutCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInCirc:
-        {
-            OutNewValue.X = EaseOutInCirc(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInCirc(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInElastic:
-        {
-            OutNewValue.X = EaseInElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutElastic:
-        {
-            OutNewValue.X = EaseOutElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutElastic:
-        {
-            OutNewValue.X = EaseInOutElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseOutInElastic:
-        {
-            OutNewValue.X = EaseOutInElastic(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInElastic(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FPowerIn<5>(), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
         case ETweenEaseType::EaseInBack:
-        {
-            OutNewValue.X = EaseInBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutBack:
-        {
-            OutNewValue.X = EaseOutBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutBack:
-        {
-            OutNewValue.X = EaseInOutBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
         case ETweenEaseType::EaseOutInBack:
         {
-            OutNewValue.X = EaseOutInBack(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInBack(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInBounce:
-        {
-            OutNewValue.X = EaseInBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FBackIn(1.70158f), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
-        case ETweenEaseType::EaseOutBounce:
-        {
-            OutNewValue.X = EaseOutBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
-            break;
-        }
-        case ETweenEaseType::EaseInOutBounce:
+        // The InOut variant uses a bigger overshoot, see EaseInOutBack
+        case ETweenEaseType::EaseInOutBack:
         {
-            OutNewValue.X = EaseInOutBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseInOutBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            RunFamily(mode, FBackIn(1.70158f * 1.525f), pNum, pCurrentTimes, pDurations, OutAlphas);
             break;
         }
-        case ETweenEaseType::EaseOutInBounce:
+        // Sine, Expo, Circ, Elastic and Bounce: branches and transcendental functions, so they're computed one Tween at a time
+        // (or read from a baked table, for Elastic and Bounce)
+        default:
         {
-            OutNewValue.X = EaseOutInBounce(pCurrentTime, pStartingValue.X, valueSpan.X, pDuration);
-            OutNewValue.Y = EaseOutInBounce(pCurrentTime, pStartingValue.Y, valueSpan.Y, pDuration);
+            if(const FEaseLookupTable *easeTable = FEaseLookupTables::FindEaseTable(pEaseType))
+            {
+                for(int32 i = 0; i < pNum; ++i)
+                {
+                    OutAlphas[i] = easeTable->Evaluate(pCurrentTimes[i] / pDurations[i]);
+                }
+            }
+            else
+            {
+                const FEaseFunction easeFunction = GetEaseFunction(pEaseType);
+
+                for(int32 i = 0; i < pNum; ++i)
+                {
+                    OutAlphas[i] = easeFunction(pCurrentTimes[i], 0.0f, 1.0f, pDurations[i]);
+                }
+            }
             break;
         }
     }
 }
 
-void EaseEquations::ComputeCustomVector2DEasing(UCurveFloat *pCurveFloat, float pCurrentTime, const FVector2D &pStartingValue,
-												const FVector2D &pEndingValue, float pDuration, FVector2D &OutNewValue)
+void EaseEquations::ComputeFloatEasingBatch(ETweenEaseType pEaseType, int32 pNum, const float *pCurrentTimes, const float *pDurations,
+                                            const float *pStartingValues, const float *pEndingValues, float *OutValues)
 {
-	float minTime;
-	float maxTime;
-	pCurveFloat->GetTimeRange(minTime, maxTime);
+    ComputeEasingAlphaBatch(pEaseType, pNum, pCurrentTimes, pDurations, OutValues);
 
-	float curveTime = Utility::MapToRange(pCurrentTime, 0, pDuration, minTime, maxTime);
-	float curveVal = pCurveFloat->GetFloatValue(curveTime);
+    // Start + (End - Start) * Alpha, four values at a time
+    int32 i = 0;
 
-	FVector2D valueSpan = pEndingValue - pStartingValue;
+    for(; i + 4 <= pNum; i += 4)
+    {
+        const VectorRegister start = VectorLoad(pStartingValues + i);
+        const VectorRegister span = VectorSubtract(VectorLoad(pEndingValues + i), start);
 
-	OutNewValue.X = pStartingValue.X + valueSpan.X * curveVal;
-	OutNewValue.Y = pStartingValue.Y + valueSpan.Y * curveVal;
+        VectorStore(VectorMultiplyAdd(span, VectorLoad(OutValues + i), start), OutValues + i);
+    }
+
+    for(; i < pNum; ++i)
+    {
+        OutValues[i] = pStartingValues[i] + (pEndingValues[i] - pStartingValues[i]) * OutValues[i];
+    }
+}
+
+EaseEquations::FEaseFunction EaseEquations::GetEaseFunction(ETweenEaseType pEaseType)
+{
+    switch(pEaseType)
+    {
+        case ETweenEaseType::Linear: return &EaseLinear;
+        case ETweenEaseType::EaseInQuad: return &EaseInQuad;
+        case ETweenEaseType::EaseOutQuad: return &EaseOutQuad;
+        case ETweenEaseType::EaseInOutQuad: return &EaseInOutQuad;
+        case ETweenEaseType::EaseOutInQuad: return &EaseOutInQuad;
+        case ETweenEaseType::EaseInCubic: return &EaseInCubic;
+        case ETweenEaseType::EaseOutCubic: return &EaseOutCubic;
+        case ETweenEaseType::EaseInOutCubic: return &EaseInOutCubic;
+        case ETweenEaseType::EaseOutInCubic: return &EaseOutInCubic;
+        case ETweenEaseType::EaseInQuart: return &EaseInQuart;
+        case ETweenEaseType::EaseOutQuart: return &EaseOutQuart;
+        case ETweenEaseType::EaseInOutQuart: return &EaseInOutQuart;
+        case ETweenEaseType::EaseOutInQuart: return &EaseOutInQuart;
+        case ETweenEaseType::EaseInQuint: return &EaseInQuint;
+        case ETweenEaseType::EaseOutQuint: return &EaseOutQuint;
+        case ETweenEaseType::EaseInOutQuint: return &EaseInOutQuint;
+        case ETweenEaseType::EaseOutInQuint: return &EaseOutInQuint;
+        case ETweenEaseType::EaseInSine: return &EaseInSine;
+        case ETweenEaseType::EaseOutSine: return &EaseOutSine;
+        case ETweenEaseType::EaseInOutSine: return &EaseInOutSine;
+        case ETweenEaseType::EaseOutInSine: return &EaseOutInSine;
+        case ETweenEaseType::EaseInExpo: return &EaseInExpo;
+        case ETweenEaseType::EaseOutExpo: return &EaseOutExpo;
+        case ETweenEaseType::EaseInOutExpo: return &EaseInOutExpo;
+        case ETweenEaseType::EaseOutInExpo: return &EaseOutInExpo;
+        case ETweenEaseType::EaseInCirc: return &EaseInCirc;
+        case ETweenEaseType::EaseOutCirc: return &EaseOutCirc;
+        case ETweenEaseType::EaseInOutCirc: return &EaseInOutCirc;
+        case ETweenEaseType::EaseOutInCirc: return &EaseOutInCirc;
+        case ETweenEaseType::EaseInElastic: return &EaseInElastic;
+        case ETweenEaseType::EaseOutElastic: return &EaseOutElastic;
+        case ETweenEaseType::EaseInOutElastic: return &EaseInOutElastic;
+        case ETweenEaseType::EaseOutInElastic: return &EaseOutInElastic;
+        case ETweenEaseType::EaseInBack: return &EaseInBack;
+        case ETweenEaseType::EaseOutBack: return &EaseOutBack;
+        case ETweenEaseType::EaseInOutBack: return &EaseInOutBack;
+        case ETweenEaseType::EaseOutInBack: return &EaseOutInBack;
+        case ETweenEaseType::EaseInBounce: return &EaseInBounce;
+        case ETweenEaseType::EaseOutBounce: return &EaseOutBounce;
+        case ETweenEaseType::EaseInOutBounce: return &EaseInOutBounce;
+        case ETweenEaseType::EaseOutInBounce: return &EaseOutInBounce;
+    }
+
+    return &EaseLinear;
 }
 
 float EaseEquations::EaseLinear(float t, float b, float c, float d)
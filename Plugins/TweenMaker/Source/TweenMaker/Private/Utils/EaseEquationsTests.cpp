@@ -0,0 +1,511 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "Utils/EaseEquations.h"
+#include "Utils/EaseLookupTable.h"
+#include "Curves/CurveFloat.h"
+#include "Tweens/TweenFloat.h"
+#include "Tweens/TweenVector.h"
+#include "Components/SceneComponent.h"
+#include "TweenManagerComponent.h"
+#include "TweenEasingBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ **************************************************************************
+ * Automation tests checking the batch easing and the baked tables against the scalar equations, and the deferred easing of the Tweens.
+ * Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests TweenMaker.Ease;Quit"
+ **************************************************************************
+ */
+
+namespace EaseEquationsTests
+{
+    const int32 NumEaseTypes = (int32)ETweenEaseType::EaseOutInBounce + 1;
+
+    /** Largest error allowed between the batch and the scalar equations, relative to the span of the Tween */
+    const float Tolerance = 1e-4f;
+
+    FString GetEaseTypeName(ETweenEaseType pEaseType)
+    {
+        const UEnum *easeEnum = StaticEnum<ETweenEaseType>();
+
+        return easeEnum != nullptr ? easeEnum->GetNameStringByValue((int64)pEaseType) : FString::FromInt((int32)pEaseType);
+    }
+
+    float GetRelativeError(float pValue, float pExpected, float pFrom, float pTo)
+    {
+        return FMath::Abs(pValue - pExpected) / FMath::Max(1.0f, FMath::Abs(pTo - pFrom));
+    }
+
+    /** Creates a "Custom" TweenFloat, not owned by any TweenContainer */
+    UTweenFloat* CreateCustomTween(ETweenEaseType pEaseType, float pFrom, float pTo, float pDuration)
+    {
+        // Custom Tweens never touch their target, it only has to be valid
+        UTweenFloat *tween = NewObject<UTweenFloat>();
+        tween->InitBase(nullptr, 0, tween, ETweenTargetType::Custom, pEaseType, pDuration, 0.0f, 1.0f, false);
+        tween->Init(pFrom, pTo, ETweenFloatType::Custom, NAME_None, nullptr);
+
+        return tween;
+    }
+}
+
+
+/**
+ * For each ease type, evaluates the same random Tweens (plus the exact start, half and end of each one) with the batch
+ * and with ComputeFloatEasing, and compares the results.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseBatchTest, "TweenMaker.Ease.Batch",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenEaseBatchTest::RunTest(const FString &Parameters)
+{
+    using namespace EaseEquationsTests;
+
+    const int32 numSamples = 4096;
+
+    FRandomStream random(1234);
+
+    TArray<float> times, durations, from, to, values;
+    times.SetNumUninitialized(numSamples);
+    durations.SetNumUninitialized(numSamples);
+    from.SetNumUninitialized(numSamples);
+    to.SetNumUninitialized(numSamples);
+    values.SetNumUninitialized(numSamples);
+
+    for(int32 i = 0; i < numSamples; ++i)
+    {
+        durations[i] = random.FRandRange(0.05f, 10.0f);
+        from[i] = random.FRandRange(-1000.0f, 1000.0f);
+        to[i] = random.FRandRange(-1000.0f, 1000.0f);
+
+        switch(i % 4)
+        {
+            case 0: times[i] = 0.0f; break;
+            case 1: times[i] = durations[i] * 0.5f; break;
+            case 2: times[i] = durations[i]; break;
+            default: times[i] = random.FRandRange(0.0f, durations[i]); break;
+        }
+    }
+
+    for(int32 type = 0; type < NumEaseTypes; ++type)
+    {
+        const ETweenEaseType easeType = (ETweenEaseType)type;
+
+        EaseEquations::ComputeFloatEasingBatch(easeType, numSamples, times.GetData(), durations.GetData(), from.GetData(), to.GetData(), values.GetData());
+
+        float maxError = 0.0f;
+        int32 worstSample = 0;
+
+        for(int32 i = 0; i < numSamples; ++i)
+        {
+            const float expected = EaseEquations::ComputeFloatEasing(easeType, times[i], from[i], to[i], durations[i]);
+            const float error = GetRelativeError(values[i], expected, from[i], to[i]);
+
+            if(error > maxError)
+            {
+                maxError = error;
+                worstSample = i;
+            }
+        }
+
+        TestTrue(FString::Printf(TEXT("%s: max relative error %.2e (t = %.4f, d = %.4f) within %.0e"), *GetEaseTypeName(easeType),
+                                 maxError, times[worstSample], durations[worstSample], Tolerance), maxError <= Tolerance);
+    }
+
+    return true;
+}
+
+
+/**
+ * Updates two "Custom" TweenFloats per ease type for a few frames: one eased right away, one deferred to a FTweenEasingBatch.
+ * The deferred one must keep its value until the batch is closed, and then match the other one.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseDeferredTest, "TweenMaker.Ease.DeferredTweens",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenEaseDeferredTest::RunTest(const FString &Parameters)
+{
+    using namespace EaseEquationsTests;
+
+    const float from = -250.0f;
+    const float to = 750.0f;
+    const float duration = 1.5f;
+    const float deltaTime = 1.0f / 7.0f;
+    const int32 numFrames = 10;
+
+    FTweenEasingBatch batch;
+
+    for(int32 type = 0; type < NumEaseTypes; ++type)
+    {
+        const ETweenEaseType easeType = (ETweenEaseType)type;
+
+        UTweenFloat *tweens[2];
+
+        for(UTweenFloat *&tween : tweens)
+        {
+            tween = CreateCustomTween(easeType, from, to, duration);
+        }
+
+        UTweenFloat *immediateTween = tweens[0];
+        UTweenFloat *deferredTween = tweens[1];
+
+        float maxError = 0.0f;
+        bool bWasDeferred = true;
+
+        for(int32 frame = 0; frame < numFrames; ++frame)
+        {
+            immediateTween->UpdateTween(deltaTime, 1.0f);
+
+            const float valueBefore = deferredTween->GetCurrentValue();
+
+            batch.Open();
+            deferredTween->UpdateTween(deltaTime, 1.0f, true);
+            bWasDeferred = bWasDeferred && deferredTween->GetCurrentValue() == valueBefore;
+            batch.Close();
+
+            maxError = FMath::Max(maxError, GetRelativeError(deferredTween->GetCurrentValue(), immediateTween->GetCurrentValue(), from, to));
+        }
+
+        TestTrue(FString::Printf(TEXT("%s: the value is only applied when the batch is closed"), *GetEaseTypeName(easeType)), bWasDeferred);
+        TestTrue(FString::Printf(TEXT("%s: max relative error %.2e within %.0e"), *GetEaseTypeName(easeType), maxError, Tolerance),
+                 maxError <= Tolerance);
+
+        for(UTweenFloat *tween : tweens)
+        {
+            tween->MarkPendingKill();
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * Updates the same deferred Tweens (all ease types, random durations) with the FTweenEasingBatch computing on the worker threads
+ * and on the game thread only. The chunks are the same, so the values must be identical.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseParallelTest, "TweenMaker.Ease.ParallelDeferredTweens",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenEaseParallelTest::RunTest(const FString &Parameters)
+{
+    using namespace EaseEquationsTests;
+
+    IConsoleVariable *parallelUpdate = IConsoleManager::Get().FindConsoleVariable(TEXT("TweenMaker.ParallelUpdate"));
+    IConsoleVariable *parallelMinTweens = IConsoleManager::Get().FindConsoleVariable(TEXT("TweenMaker.ParallelMinTweens"));
+
+    if(!TestNotNull(TEXT("TweenMaker.ParallelUpdate exists"), parallelUpdate) ||
+       !TestNotNull(TEXT("TweenMaker.ParallelMinTweens exists"), parallelMinTweens))
+    {
+        return false;
+    }
+
+    const int32 previousParallelUpdate = parallelUpdate->GetInt();
+    const int32 previousParallelMinTweens = parallelMinTweens->GetInt();
+
+    // A few chunks, so that some of them span more than one ease type
+    const int32 numTweens = 5000;
+    const float deltaTime = 1.0f / 30.0f;
+    const int32 numFrames = 5;
+
+    FRandomStream random(1234);
+    FTweenEasingBatch batch;
+
+    TArray<UTweenFloat*> tweens[2];
+
+    for(int32 i = 0; i < numTweens; ++i)
+    {
+        const ETweenEaseType easeType = (ETweenEaseType)random.RandRange(0, NumEaseTypes - 1);
+        const float from = random.FRandRange(-1000.0f, 1000.0f);
+        const float to = random.FRandRange(-1000.0f, 1000.0f);
+        const float duration = random.FRandRange(0.5f, 3.0f);
+
+        for(TArray<UTweenFloat*> &run : tweens)
+        {
+            run.Add(CreateCustomTween(easeType, from, to, duration));
+        }
+    }
+
+    parallelMinTweens->Set(0, ECVF_SetByCode);
+
+    for(int32 runIndex = 0; runIndex < 2; ++runIndex)
+    {
+        parallelUpdate->Set(runIndex == 0 ? 1 : 0, ECVF_SetByCode);
+
+        for(int32 frame = 0; frame < numFrames; ++frame)
+        {
+            batch.Open();
+
+            for(UTweenFloat *tween : tweens[runIndex])
+            {
+                tween->UpdateTween(deltaTime, 1.0f, true);
+            }
+
+            batch.Close();
+        }
+    }
+
+    parallelUpdate->Set(previousParallelUpdate, ECVF_SetByCode);
+    parallelMinTweens->Set(previousParallelMinTweens, ECVF_SetByCode);
+
+    int32 numMismatches = 0;
+
+    for(int32 i = 0; i < numTweens; ++i)
+    {
+        numMismatches += tweens[0][i]->GetCurrentValue() != tweens[1][i]->GetCurrentValue() ? 1 : 0;
+    }
+
+    TestEqual(TEXT("Tweens whose value differs between the parallel and the game thread easing"), numMismatches, 0);
+
+    for(TArray<UTweenFloat*> &run : tweens)
+    {
+        for(UTweenFloat *tween : run)
+        {
+            tween->MarkPendingKill();
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * Moves a SceneComponent with two Tweens updated one after the other while a FTweenEasingBatch is open: the first one is deferred,
+ * the second one has an update listener, so it's eased right away. The second one must still be the last to write the target.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseDeferredOrderTest, "TweenMaker.Ease.DeferredOrder",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenEaseDeferredOrderTest::RunTest(const FString &Parameters)
+{
+    const float deltaTime = 0.1f;
+    const int32 numFrames = 5;
+    const float tolerance = 1e-3f;
+
+    USceneComponent *component = NewObject<USceneComponent>();
+
+    UTweenVector *tweens[2];
+
+    for(UTweenVector *&tween : tweens)
+    {
+        tween = NewObject<UTweenVector>();
+        tween->InitBase(nullptr, 0, component, ETweenTargetType::SceneComponent, ETweenEaseType::EaseInOutQuad, 1.0f, 0.0f, 1.0f, false);
+    }
+
+    UTweenVector *deferredTween = tweens[0];
+    UTweenVector *immediateTween = tweens[1];
+    deferredTween->Init(FVector(0, 0, 0), FVector(100, 0, 0), ETweenVectorType::MoveTo, false, false, nullptr);
+    immediateTween->Init(FVector(0, 0, 0), FVector(0, 100, 0), ETweenVectorType::MoveTo, false, false, nullptr);
+    immediateTween->OnTweenUpdateDelegate.BindLambda([](UTweenVector *) {});
+
+    FTweenEasingBatch batch;
+    float maxError = 0.0f;
+
+    for(int32 frame = 0; frame < numFrames; ++frame)
+    {
+        batch.Open();
+        deferredTween->UpdateTween(deltaTime, 1.0f, true);
+        immediateTween->UpdateTween(deltaTime, 1.0f, true);
+        batch.Close();
+
+        maxError = FMath::Max(maxError, FVector::Dist(component->GetComponentLocation(), immediateTween->GetCurrentValue()));
+    }
+
+    TestTrue(TEXT("The deferred Tween was applied"), deferredTween->GetCurrentValue().X > 0.0f);
+    TestTrue(FString::Printf(TEXT("The last Tween updated wrote the target last: max distance %.2e"), maxError), maxError <= tolerance);
+
+    for(UTweenVector *tween : tweens)
+    {
+        tween->MarkPendingKill();
+    }
+    component->MarkPendingKill();
+
+    return true;
+}
+
+/**
+ * Times the easing of N FVector Tweens with a single ease type, as it was done per Tween (ComputeFloatEasing on each component)
+ * and with the batch (one alpha per Tween, then a lerp), and checks that both give the same values.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseBatchBenchTest, "TweenMaker.Ease.BatchBench",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::StressFilter)
+
+bool FTweenEaseBatchBenchTest::RunTest(const FString &Parameters)
+{
+    using namespace EaseEquationsTests;
+
+    const int32 counts[] = { 10000, 100000 };
+    const ETweenEaseType easeTypes[] = { ETweenEaseType::Linear, ETweenEaseType::EaseInOutQuad, ETweenEaseType::EaseOutCubic,
+                                         ETweenEaseType::EaseOutBack, ETweenEaseType::EaseInOutSine, ETweenEaseType::EaseOutBounce };
+    const int32 numIterations = 20;
+
+    FRandomStream random(1234);
+
+    for(int32 count : counts)
+    {
+        TArray<float> times, durations, alphas;
+        TArray<FVector> from, to, scalarValues, batchValues;
+        times.SetNumUninitialized(count);
+        durations.SetNumUninitialized(count);
+        alphas.SetNumUninitialized(count);
+        from.SetNumUninitialized(count);
+        to.SetNumUninitialized(count);
+        scalarValues.SetNumUninitialized(count);
+        batchValues.SetNumUninitialized(count);
+
+        for(int32 i = 0; i < count; ++i)
+        {
+            durations[i] = random.FRandRange(0.5f, 3.0f);
+            times[i] = random.FRandRange(0.0f, durations[i]);
+            from[i] = random.GetUnitVector() * 500.0f;
+            to[i] = random.GetUnitVector() * 500.0f;
+        }
+
+        for(ETweenEaseType easeType : easeTypes)
+        {
+            double scalarSeconds = 0.0;
+            double batchSeconds = 0.0;
+
+            for(int32 iteration = 0; iteration < numIterations; ++iteration)
+            {
+                double start = FPlatformTime::Seconds();
+
+                for(int32 i = 0; i < count; ++i)
+                {
+                    scalarValues[i].X = EaseEquations::ComputeFloatEasing(easeType, times[i], from[i].X, to[i].X, durations[i]);
+                    scalarValues[i].Y = EaseEquations::ComputeFloatEasing(easeType, times[i], from[i].Y, to[i].Y, durations[i]);
+                    scalarValues[i].Z = EaseEquations::ComputeFloatEasing(easeType, times[i], from[i].Z, to[i].Z, durations[i]);
+                }
+
+                scalarSeconds += FPlatformTime::Seconds() - start;
+                start = FPlatformTime::Seconds();
+
+                EaseEquations::ComputeEasingAlphaBatch(easeType, count, times.GetData(), durations.GetData(), alphas.GetData());
+
+                for(int32 i = 0; i < count; ++i)
+                {
+                    batchValues[i] = from[i] + (to[i] - from[i]) * alphas[i];
+                }
+
+                batchSeconds += FPlatformTime::Seconds() - start;
+            }
+
+            float maxError = 0.0f;
+
+            for(int32 i = 0; i < count; ++i)
+            {
+                for(int32 axis = 0; axis < 3; ++axis)
+                {
+                    maxError = FMath::Max(maxError, GetRelativeError(batchValues[i][axis], scalarValues[i][axis], from[i][axis], to[i][axis]));
+                }
+            }
+
+            const double scalarMicroseconds = scalarSeconds * 1000000.0 / numIterations;
+            const double batchMicroseconds = batchSeconds * 1000000.0 / numIterations;
+
+            AddInfo(FString::Printf(TEXT("%7i Tweens %-18s per component %9.1f us, batch %9.1f us (x%.2f)"),
+                                    count, *GetEaseTypeName(easeType), scalarMicroseconds, batchMicroseconds,
+                                    batchMicroseconds > 0.0 ? scalarMicroseconds / batchMicroseconds : 0.0));
+
+            TestTrue(FString::Printf(TEXT("%i Tweens %s: max relative error %.2e within %.0e"), count, *GetEaseTypeName(easeType),
+                                     maxError, Tolerance), maxError <= Tolerance);
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * Bakes every bakeable ease type and a few curves with the current error bound ("TweenMaker.Ease.LUTMaxError"),
+ * then checks the tables against their functions at dense samples: the bound must hold everywhere, not only where the baking measured it.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseLookupTablesTest, "TweenMaker.Ease.LookupTables",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTweenEaseLookupTablesTest::RunTest(const FString &Parameters)
+{
+    using namespace EaseEquationsTests;
+
+    // Far more than the tables have, so the samples fall everywhere inside their steps
+    const int32 numSamples = 200000;
+    const float maxError = FEaseLookupTables::GetMaxError();
+
+    auto checkTable = [&](const FString &pName, const FEaseLookupTable &pTable, TFunctionRef<float(float)> pFunction)
+    {
+        float error = 0.0f;
+        float worstTime = 0.0f;
+
+        for(int32 i = 0; i <= numSamples; ++i)
+        {
+            const float normalizedTime = (float)i / numSamples;
+            const float sampleError = FMath::Abs(pTable.Evaluate(normalizedTime) - pFunction(normalizedTime));
+
+            if(sampleError > error)
+            {
+                error = sampleError;
+                worstTime = normalizedTime;
+            }
+        }
+
+        TestTrue(FString::Printf(TEXT("%s (%i samples): error %.2e at %f within %.2e"), *pName, pTable.GetResolution(), error, worstTime, maxError),
+                 error <= maxError);
+    };
+
+    for(int32 type = 0; type < NumEaseTypes; ++type)
+    {
+        const ETweenEaseType easeType = (ETweenEaseType)type;
+
+        if(FEaseLookupTables::IsBakeableEaseType(easeType))
+        {
+            FEaseLookupTable table;
+            FEaseLookupTables::BakeEaseType(table, easeType, maxError);
+
+            const EaseEquations::FEaseFunction easeFunction = EaseEquations::GetEaseFunction(easeType);
+
+            checkTable(GetEaseTypeName(easeType), table, [easeFunction](float pNormalizedTime)
+            {
+                return easeFunction(pNormalizedTime, 0.0f, 1.0f, 1.0f);
+            });
+        }
+    }
+
+    // A cubic curve overshooting in both directions, with a time range that isn't [0, 1]
+    UCurveFloat *cubicCurve = NewObject<UCurveFloat>();
+    cubicCurve->FloatCurve.SetKeyInterpMode(cubicCurve->FloatCurve.AddKey(0.0f, 0.0f), RCIM_Cubic);
+    cubicCurve->FloatCurve.SetKeyInterpMode(cubicCurve->FloatCurve.AddKey(0.6f, 1.2f), RCIM_Cubic);
+    cubicCurve->FloatCurve.SetKeyInterpMode(cubicCurve->FloatCurve.AddKey(1.4f, 0.85f), RCIM_Cubic);
+    cubicCurve->FloatCurve.SetKeyInterpMode(cubicCurve->FloatCurve.AddKey(2.0f, 1.0f), RCIM_Cubic);
+
+    // A linear corner off the grid of any resolution, where the lerp is the furthest from the curve
+    UCurveFloat *cornerCurve = NewObject<UCurveFloat>();
+    cornerCurve->FloatCurve.SetKeyInterpMode(cornerCurve->FloatCurve.AddKey(0.0f, 0.0f), RCIM_Linear);
+    cornerCurve->FloatCurve.SetKeyInterpMode(cornerCurve->FloatCurve.AddKey(0.137f, 1.0f), RCIM_Linear);
+    cornerCurve->FloatCurve.SetKeyInterpMode(cornerCurve->FloatCurve.AddKey(1.0f, 0.4f), RCIM_Linear);
+
+    for(UCurveFloat *curveFloat : { cubicCurve, cornerCurve })
+    {
+        FEaseLookupTable table;
+        FEaseLookupTables::BakeCurve(table, curveFloat, maxError);
+
+        float minTime;
+        float maxTime;
+        curveFloat->GetTimeRange(minTime, maxTime);
+
+        checkTable(curveFloat == cubicCurve ? TEXT("CubicCurve") : TEXT("CornerCurve"), table, [curveFloat, minTime, maxTime](float pNormalizedTime)
+        {
+            return curveFloat->GetFloatValue(FMath::Lerp(minTime, maxTime, pNormalizedTime));
+        });
+
+        curveFloat->MarkPendingKill();
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,277 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/EaseLookupTable.h"
+#include "Utils/EaseEquations.h"
+#include "Utils/Utility.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+
+static TAutoConsoleVariable<float> CVarTweenEaseLUTMaxError(
+    TEXT("TweenMaker.Ease.LUTMaxError"),
+    0.001f,
+    TEXT("Maximum error allowed in the baked easing tables, relative to the [0, 1] span of the eased progress.\n")
+    TEXT("Tables are baked again with the new bound the next time they're used."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTweenEaseLUTBuiltInEquations(
+    TEXT("TweenMaker.Ease.LUTBuiltInEquations"),
+    0,
+    TEXT("If 1, the Elastic, Bounce and Back ease equations are read from baked tables instead of being computed.\n")
+    TEXT("Custom curves are always baked."),
+    ECVF_Default);
+
+
+/*
+ **************************************************************************
+ * FEaseLookupTable
+ **************************************************************************
+ */
+
+// The three checks of a step can miss the peak of the error by almost 10% (i.e. on a cubic step)
+const float FEaseLookupTable::ErrorMargin = 1.1f;
+
+FEaseLookupTable::FEaseLookupTable()
+    : mLastIndex(0)
+    , mMeasuredError(0.0f)
+    , mMaxError(0.0f)
+{
+}
+
+void FEaseLookupTable::Bake(TFunctionRef<float(float)> pFunction, float pMaxError, TArrayView<const float> pKeyTimes)
+{
+    mMaxError = pMaxError;
+
+    for(int32 resolution = MinResolution; resolution <= MaxResolution; resolution *= 2)
+    {
+        mLastIndex = resolution - 1;
+        mSamples.SetNumUninitialized(resolution, false);
+
+        for(int32 i = 0; i < resolution; ++i)
+        {
+            mSamples[i] = pFunction((float)i / mLastIndex);
+        }
+
+        // The lerp is the least accurate between the samples, so that's where the error is measured
+        mMeasuredError = 0.0f;
+
+        for(int32 i = 0; i < mLastIndex; ++i)
+        {
+            for(float fraction : { 0.25f, 0.5f, 0.75f })
+            {
+                const float normalizedTime = (i + fraction) / mLastIndex;
+                mMeasuredError = FMath::Max(mMeasuredError, FMath::Abs(Evaluate(normalizedTime) - pFunction(normalizedTime)));
+            }
+        }
+
+        // A corner between two samples is where the lerp is the furthest from the function, wherever it falls in the step
+        for(float keyTime : pKeyTimes)
+        {
+            const float normalizedTime = FMath::Clamp(keyTime, 0.0f, 1.0f);
+            mMeasuredError = FMath::Max(mMeasuredError, FMath::Abs(Evaluate(normalizedTime) - pFunction(normalizedTime)));
+        }
+
+        mMeasuredError *= ErrorMargin;
+
+        // Discontinuous functions (i.e. curves with constant keys) never get there: they stop at the maximum resolution
+        if(mMeasuredError <= pMaxError)
+        {
+            break;
+        }
+    }
+}
+
+
+/*
+ **************************************************************************
+ * FEaseLookupTables
+ **************************************************************************
+ */
+
+TMap<TWeakObjectPtr<const UCurveFloat>, FEaseLookupTable> FEaseLookupTables::CurveTables;
+TArray<FEaseLookupTable> FEaseLookupTables::EaseTables;
+FDelegateHandle FEaseLookupTables::OnObjectModifiedHandle;
+FDelegateHandle FEaseLookupTables::OnObjectPropertyChangedHandle;
+
+void FEaseLookupTables::Initialize()
+{
+#if WITH_EDITOR
+    // Editing a curve asset calls Modify before changing the keys, and the details panel broadcasts the property change after:
+    // either way the table is dropped before any Tween can read it again
+    OnObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&FEaseLookupTables::OnObjectChanged);
+    OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject *pObject, FPropertyChangedEvent &)
+    {
+        OnObjectChanged(pObject);
+    });
+#endif
+}
+
+void FEaseLookupTables::Shutdown()
+{
+#if WITH_EDITOR
+    FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+#endif
+
+    InvalidateAll();
+}
+
+float FEaseLookupTables::EvaluateCurve(UCurveFloat *pCurveFloat, float pNormalizedTime)
+{
+    return FindOrBakeCurve(pCurveFloat).Evaluate(pNormalizedTime);
+}
+
+const FEaseLookupTable& FEaseLookupTables::FindOrBakeCurve(UCurveFloat *pCurveFloat)
+{
+    const float maxError = GetMaxError();
+    FEaseLookupTable &table = CurveTables.FindOrAdd(pCurveFloat);
+
+    if(!table.IsBaked() || table.GetMaxError() != maxError)
+    {
+        BakeCurve(table, pCurveFloat, maxError);
+
+        // Curves that are gone can't be found anymore, so this is a good moment to forget about their tables
+        for(auto iterator = CurveTables.CreateIterator(); iterator; ++iterator)
+        {
+            if(iterator.Key().IsStale())
+            {
+                iterator.RemoveCurrent();
+            }
+        }
+    }
+
+    // Removing stale entries may have moved the table around
+    return CurveTables.FindChecked(pCurveFloat);
+}
+
+void FEaseLookupTables::InvalidateCurve(const UCurveFloat *pCurveFloat)
+{
+    CurveTables.Remove(pCurveFloat);
+}
+
+void FEaseLookupTables::InvalidateAll()
+{
+    CurveTables.Reset();
+    EaseTables.Reset();
+}
+
+bool FEaseLookupTables::IsBakeableEaseType(ETweenEaseType pEaseType)
+{
+    switch(pEaseType)
+    {
+        case ETweenEaseType::EaseInElastic:
+        case ETweenEaseType::EaseOutElastic:
+        case ETweenEaseType::EaseInOutElastic:
+        case ETweenEaseType::EaseOutInElastic:
+        case ETweenEaseType::EaseInBack:
+        case ETweenEaseType::EaseOutBack:
+        case ETweenEaseType::EaseInOutBack:
+        case ETweenEaseType::EaseOutInBack:
+        case ETweenEaseType::EaseInBounce:
+        case ETweenEaseType::EaseOutBounce:
+        case ETweenEaseType::EaseInOutBounce:
+        case ETweenEaseType::EaseOutInBounce:
+        {
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+void FEaseLookupTables::BakeEaseType(FEaseLookupTable &OutTable, ETweenEaseType pEaseType, float pMaxError)
+{
+    // The bounces of EaseOutBounce meet at these times, the other Bounce equations are made of mirrored and halved EaseOutBounce
+    const float bounceCorners[] = { 1.0f / 2.75f, 2.0f / 2.75f, 2.5f / 2.75f };
+
+    // The InOut and OutIn equations join two halves, which may not be smooth where they meet
+    TArray<float, TInlineAllocator<8>> keyTimes;
+    keyTimes.Add(0.5f);
+
+    for(float corner : bounceCorners)
+    {
+        switch(pEaseType)
+        {
+            case ETweenEaseType::EaseInBounce: keyTimes.Add(1.0f - corner); break;
+            case ETweenEaseType::EaseOutBounce: keyTimes.Add(corner); break;
+            case ETweenEaseType::EaseInOutBounce: keyTimes.Add((1.0f - corner) * 0.5f); keyTimes.Add(0.5f + corner * 0.5f); break;
+            case ETweenEaseType::EaseOutInBounce: keyTimes.Add(corner * 0.5f); keyTimes.Add(1.0f - corner * 0.5f); break;
+            default: break;
+        }
+    }
+
+    const EaseEquations::FEaseFunction easeFunction = EaseEquations::GetEaseFunction(pEaseType);
+
+    OutTable.Bake([easeFunction](float pNormalizedTime)
+    {
+        return easeFunction(pNormalizedTime, 0.0f, 1.0f, 1.0f);
+    }, pMaxError, keyTimes);
+}
+
+void FEaseLookupTables::BakeCurve(FEaseLookupTable &OutTable, const UCurveFloat *pCurveFloat, float pMaxError)
+{
+    float minTime;
+    float maxTime;
+    pCurveFloat->GetTimeRange(minTime, maxTime);
+
+    const float timeRange = FMath::Max(maxTime - minTime, KINDA_SMALL_NUMBER);
+    TArray<float> keyTimes;
+
+    for(auto iterator = pCurveFloat->FloatCurve.GetKeyIterator(); iterator; ++iterator)
+    {
+        keyTimes.Add((iterator->Time - minTime) / timeRange);
+    }
+
+    OutTable.Bake([pCurveFloat, minTime, maxTime](float pNormalizedTime)
+    {
+        return pCurveFloat->GetFloatValue(FMath::Lerp(minTime, maxTime, pNormalizedTime));
+    }, pMaxError, keyTimes);
+}
+
+const FEaseLookupTable* FEaseLookupTables::FindEaseTable(ETweenEaseType pEaseType)
+{
+    if(CVarTweenEaseLUTBuiltInEquations.GetValueOnAnyThread() == 0 || !IsBakeableEaseType(pEaseType))
+    {
+        return nullptr;
+    }
+
+    const float maxError = GetMaxError();
+    const int32 numEaseTypes = (int32)ETweenEaseType::EaseOutInBounce + 1;
+
+    if(EaseTables.Num() != numEaseTypes || EaseTables[(int32)pEaseType].GetMaxError() != maxError)
+    {
+        // Baking only happens on the game thread; until then, the caller computes the equation
+        if(!IsInGameThread())
+        {
+            return nullptr;
+        }
+
+        EaseTables.SetNum(numEaseTypes);
+
+        for(int32 type = 0; type < numEaseTypes; ++type)
+        {
+            if(IsBakeableEaseType((ETweenEaseType)type))
+            {
+                BakeEaseType(EaseTables[type], (ETweenEaseType)type, maxError);
+            }
+        }
+    }
+
+    return &EaseTables[(int32)pEaseType];
+}
+
+float FEaseLookupTables::GetMaxError()
+{
+    return FMath::Max(CVarTweenEaseLUTMaxError.GetValueOnAnyThread(), KINDA_SMALL_NUMBER);
+}
+
+void FEaseLookupTables::OnObjectChanged(UObject *pObject)
+{
+    if(const UCurveFloat *curveFloat = Cast<UCurveFloat>(pObject))
+    {
+        InvalidateCurve(curveFloat);
+    }
+}
@@ -0,0 +1,206 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/SplineArcLengthTable.h"
+#include "Components/SplineComponent.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+#include "CoreGlobals.h"
+
+
+static TAutoConsoleVariable<int32> CVarTweenSplineSamplesPerSegment(
+    TEXT("TweenMaker.Spline.SamplesPerSegment"),
+    64,
+    TEXT("Number of samples per segment (between two spline points) of the tables used by the FollowSpline Tweens.\n")
+    TEXT("Tables are baked again with the new value the next time their spline changes."),
+    ECVF_Default);
+
+/** Upper bound on the samples of a table, whatever the number of segments */
+static const int32 MaxSplineTableResolution = 16384;
+
+
+/*
+ **************************************************************************
+ * FSplineArcLengthTable
+ **************************************************************************
+ */
+
+FSplineArcLengthTable::FSplineArcLengthTable()
+    : mSplineVersion(0)
+    , mNumPoints(0)
+    , mSplineLength(0.0f)
+    , bClosedLoop(false)
+    , mValidatedFrame(0)
+{
+}
+
+void FSplineArcLengthTable::Bake(const USplineComponent *pSpline, int32 pSamplesPerSegment)
+{
+    mSplineVersion = pSpline->SplineCurves.Version;
+    mNumPoints = pSpline->GetNumberOfSplinePoints();
+    mSplineLength = pSpline->GetSplineLength();
+    bClosedLoop = pSpline->IsClosedLoop();
+
+    const int32 numSegments = bClosedLoop ? mNumPoints : mNumPoints - 1;
+
+    // A spline with no length has a single point to return
+    const int32 resolution = numSegments > 0 && mSplineLength > 0.0f
+                           ? FMath::Clamp(numSegments * FMath::Max(1, pSamplesPerSegment) + 1, 2, MaxSplineTableResolution)
+                           : 1;
+
+    mInputKeys.SetNumUninitialized(resolution, false);
+    mLocations.SetNumUninitialized(resolution, false);
+    mRotations.SetNumUninitialized(resolution, false);
+    mScales.SetNumUninitialized(resolution, false);
+
+    for(int32 i = 0; i < resolution; ++i)
+    {
+        const float distance = resolution > 1 ? mSplineLength * i / (resolution - 1) : 0.0f;
+        const float inputKey = pSpline->SplineCurves.ReparamTable.Eval(distance, 0.0f);
+
+        mInputKeys[i] = inputKey;
+        mLocations[i] = pSpline->GetLocationAtSplineInputKey(inputKey, ESplineCoordinateSpace::Local);
+        mRotations[i] = pSpline->GetQuaternionAtSplineInputKey(inputKey, ESplineCoordinateSpace::Local);
+        mScales[i] = pSpline->GetScaleAtSplineInputKey(inputKey);
+    }
+}
+
+bool FSplineArcLengthTable::IsOutdated(const USplineComponent *pSpline) const
+{
+    // The version changes whenever the spline is updated; the rest is there in case the curves were set without updating it
+    return mSplineVersion != pSpline->SplineCurves.Version || mNumPoints != pSpline->GetNumberOfSplinePoints() ||
+           mSplineLength != pSpline->GetSplineLength() || bClosedLoop != pSpline->IsClosedLoop();
+}
+
+FSplineTableSample FSplineArcLengthTable::SampleAtDistanceRatio(float pDistanceRatio) const
+{
+    const int32 lastIndex = mInputKeys.Num() - 1;
+
+    if(lastIndex <= 0)
+    {
+        return Lerp(0, 0.0f);
+    }
+
+    // The samples are evenly spaced along the spline, so the index is found directly
+    const float position = FMath::Clamp(pDistanceRatio, 0.0f, 1.0f) * lastIndex;
+    const int32 index = FMath::Min((int32)position, lastIndex - 1);
+
+    return Lerp(index, position - index);
+}
+
+FSplineTableSample FSplineArcLengthTable::SampleAtInputKey(float pInputKey) const
+{
+    const int32 lastIndex = mInputKeys.Num() - 1;
+
+    if(lastIndex <= 0)
+    {
+        return Lerp(0, 0.0f);
+    }
+
+    // The input keys grow along the spline: the first sample past the key ends the interval the key is in
+    const int32 upperIndex = FMath::Clamp(Algo::UpperBound(mInputKeys, pInputKey), 1, lastIndex);
+    const int32 index = upperIndex - 1;
+
+    const float keySpan = mInputKeys[upperIndex] - mInputKeys[index];
+    const float alpha = keySpan > 0.0f ? FMath::Clamp((pInputKey - mInputKeys[index]) / keySpan, 0.0f, 1.0f) : 0.0f;
+
+    return Lerp(index, alpha);
+}
+
+FSplineTableSample FSplineArcLengthTable::Lerp(int32 pIndex, float pAlpha) const
+{
+    const int32 nextIndex = FMath::Min(pIndex + 1, mInputKeys.Num() - 1);
+
+    FSplineTableSample sample;
+    sample.InputKey = FMath::Lerp(mInputKeys[pIndex], mInputKeys[nextIndex], pAlpha);
+    sample.Location = FMath::Lerp(mLocations[pIndex], mLocations[nextIndex], pAlpha);
+    sample.Rotation = FQuat::FastLerp(mRotations[pIndex], mRotations[nextIndex], pAlpha).GetNormalized();
+    sample.Scale = FMath::Lerp(mScales[pIndex], mScales[nextIndex], pAlpha);
+
+    return sample;
+}
+
+
+/*
+ **************************************************************************
+ * FSplineArcLengthTables
+ **************************************************************************
+ */
+
+TMap<TWeakObjectPtr<const USplineComponent>, FSplineArcLengthTable> FSplineArcLengthTables::Tables;
+
+FSplineTableSample FSplineArcLengthTables::SampleAtTime(const USplineComponent *pSpline, float pTime, bool pUseConstantSpeed)
+{
+    const FSplineArcLengthTable &table = FindOrBake(pSpline);
+    const float duration = pSpline->Duration;
+    FSplineTableSample sample;
+
+    // Same mapping from time to spline as USplineComponent::GetLocationAtTime
+    if(duration == 0.0f)
+    {
+        sample = table.SampleAtDistanceRatio(0.0f);
+    }
+    else if(pUseConstantSpeed)
+    {
+        sample = table.SampleAtDistanceRatio(pTime / duration);
+    }
+    else
+    {
+        const int32 numPoints = pSpline->GetNumberOfSplinePoints();
+        const int32 numSegments = pSpline->IsClosedLoop() ? numPoints : numPoints - 1;
+
+        sample = table.SampleAtInputKey(pTime * numSegments / duration);
+    }
+
+    // The table is in the local space of the spline, so that moving the spline doesn't require baking it again
+    const FTransform &splineTransform = pSpline->GetComponentTransform();
+    sample.Location = splineTransform.TransformPosition(sample.Location);
+    sample.Rotation = splineTransform.GetRotation() * sample.Rotation;
+
+    return sample;
+}
+
+const FSplineArcLengthTable& FSplineArcLengthTables::FindOrBake(const USplineComponent *pSpline)
+{
+    check(IsInGameThread());
+
+    FSplineArcLengthTable *table = Tables.Find(pSpline);
+
+    // Many Tweens can follow the same spline, so it's only checked for changes once per frame
+    if(table != nullptr && table->mValidatedFrame == GFrameCounter)
+    {
+        return *table;
+    }
+
+    if(table == nullptr)
+    {
+        // Splines that are gone can't be found anymore, so this is a good moment to forget about their tables
+        for(auto iterator = Tables.CreateIterator(); iterator; ++iterator)
+        {
+            if(iterator.Key().IsStale())
+            {
+                iterator.RemoveCurrent();
+            }
+        }
+
+        table = &Tables.Add(pSpline);
+    }
+
+    if(!table->IsBaked() || table->IsOutdated(pSpline))
+    {
+        table->Bake(pSpline, CVarTweenSplineSamplesPerSegment.GetValueOnGameThread());
+    }
+
+    table->mValidatedFrame = GFrameCounter;
+
+    return *table;
+}
+
+void FSplineArcLengthTables::Invalidate(const USplineComponent *pSpline)
+{
+    Tables.Remove(pSpline);
+}
+
+void FSplineArcLengthTables::InvalidateAll()
+{
+    Tables.Reset();
+}
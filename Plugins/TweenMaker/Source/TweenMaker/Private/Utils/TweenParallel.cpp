@@ -0,0 +1,24 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenParallel.h"
+#include "HAL/IConsoleManager.h"
+
+
+static TAutoConsoleVariable<int32> CVarTweenParallelUpdate(
+    TEXT("TweenMaker.ParallelUpdate"),
+    1,
+    TEXT("If 1, the stored Tweens advance their time, ease and loop on the worker threads, and the Tweens of the TweenContainers compute their\n")
+    TEXT("eased values there; the values are still applied on the game thread. 0 computes everything on the game thread. Both give the same results."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTweenParallelMinTweens(
+    TEXT("TweenMaker.ParallelMinTweens"),
+    4096,
+    TEXT("Minimum number of Tweens in a pass for it to run on the worker threads. Below that, the tasks cost more than they save."),
+    ECVF_Default);
+
+
+bool TweenParallel::ShouldRunInParallel(int32 pNum)
+{
+    return CVarTweenParallelUpdate.GetValueOnGameThread() != 0 && pNum >= CVarTweenParallelMinTweens.GetValueOnGameThread();
+}
@@ -10,6 +10,7 @@
 
 class UTweenManagerComponent;
 class UBaseTween;
+class FTweenReferenceTable;
 
 /*
  **************************************************************************
@@ -18,6 +19,7 @@ class UBaseTween;
  */
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenContainerEnd, UTweenContainer*, TweenContainer);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FBP_OnTweenContainerUpdate, UTweenContainer*, TweenContainer, const TArray<UBaseTween*>&, UpdatedTweens);
 
 /*
  **************************************************************************
@@ -26,6 +28,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenContainerEnd, UTweenConta
  */
 
 DECLARE_DELEGATE_OneParam(FOnTweenContainerEnd, UTweenContainer*);
+DECLARE_DELEGATE_TwoParams(FOnTweenContainerUpdate, UTweenContainer*, const TArray<UBaseTween*>&);
 
 /**
  * The UTweenContainer class is responsable for managing sequences of parallel Tweens. All Tweens that are created are internally
@@ -154,6 +157,29 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (KeyWords = "Tween Container Has Ended"), Category = "Tween|Utils")
 	bool HasEnded();
 
+    /**
+     * Lets the TweenContainer update its Tweens less often when their targets matter less: every frame if a target is near
+     * a local player, every ReducedRateInterval frames if the targets are farther but were rendered recently, and not at all if
+     * none of them was. Tweens that move, rotate or scale their target are never suspended (they may be what brings it into
+     * view): they're updated every ReducedRateInterval frames at least. The time skipped is not lost: it's given to the Tweens
+     * when they're updated again, so the sequences end and loop when they would have.
+     *
+     * Only Actor and SceneComponent targets are rated; a TweenContainer with other targets (widgets, materials, ...) is always
+     * updated every frame. Disabled by default.
+     *
+     * @param Enable Whether to rate the targets at all.
+     * @param NearDistance Distance from a local player under which the Tweens are always updated every frame.
+     * @param ReducedRateInterval How many frames pass between two updates when the targets are far.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords = "Tween Container Significance LOD Rate"), Category = "Tween|Utils")
+    void SetSignificance(bool Enable, float NearDistance = 3000.0f, int32 ReducedRateInterval = 4);
+
+    /**
+     * Returns how often the Tweens of this TweenContainer are currently updated (always Full if SetSignificance wasn't enabled).
+     */
+    UFUNCTION(BlueprintPure, meta = (KeyWords = "Tween Container Significance LOD Rate"), Category = "Tween|Utils")
+    ETweenSignificance GetSignificance();
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -218,6 +244,13 @@ public:
     UPROPERTY(BlueprintAssignable, meta = (DisplayName = "On Tween Container End"))
     FBP_OnTweenContainerEnd OnTweenContainerEnd;
 
+    /**
+     * Delegate called once per frame with all Tweens of this container that were updated in that frame. Binding it instead of
+     * the 'On Tween Update' event of each Tween fires one event per container rather than one per Tween. Use only in Blueprints.
+     */
+    UPROPERTY(BlueprintAssignable, meta = (DisplayName = "On Tween Container Update"))
+    FBP_OnTweenContainerUpdate OnTweenContainerUpdate;
+
     /*
      **************************************************************************
      * C++ delegates
@@ -227,6 +260,9 @@ public:
     /** Delegate called when ALL Tweens managed by this container are done and it's about to be destroyed (don't reuse the container). Use only in C++. */
     FOnTweenContainerEnd OnTweenContainerEndDelegate;
 
+    /** Delegate called once per frame with all Tweens of this container that were updated in that frame. Use only in C++. */
+    FOnTweenContainerUpdate OnTweenContainerUpdateDelegate;
+
 
 public:
 
@@ -1805,6 +1841,30 @@ private:
 	/** True if at least one Tween handled by this container should tween while the game is paused */
 	bool bShouldTweenWhileGamePaused;
 
+    /** Tweens updated during the current update, only filled if the container update event is bound. Reused across updates */
+    TArray<UBaseTween*> mUpdatedTweens;
+
+    /** True if the update rate follows the significance of the targets (see SetSignificance) */
+    bool bUseSignificance;
+
+    /** Distance from a local player under which the Tweens are updated every frame */
+    float mSignificanceNearDistance;
+
+    /** Frames between two updates in the Reduced tier */
+    int32 mReducedRateInterval;
+
+    /** Current significance tier */
+    ETweenSignificance mSignificance;
+
+    /** Frames left before the significance is evaluated again */
+    int32 mFramesUntilSignificanceEvaluation;
+
+    /** Frames since the Tweens were last updated */
+    int32 mFramesSinceUpdate;
+
+    /** Time passed since the Tweens were last updated, given to them at the next update */
+    float mSkippedTime;
+
 private:
 
     /*
@@ -1815,12 +1875,31 @@ private:
 
     /**
      * @brief RemoveTweensReferences is used by the owning TweenManagerComponent to remove the references of ALL Tweens
-     *        owned by this TweenContainer from the Map that keeps track of the currently active Tweens.
+     *        owned by this TweenContainer from the table that keeps track of the currently active Tweens.
      *        This method is called when the TweenContainer is being deleted.
      *
-     * @param pTweensReferenceMap The map from which to remove the references.
+     * @param pTweenReferences The table from which to remove the references.
+     */
+    void RemoveTweensReferences(FTweenReferenceTable &pTweenReferences);
+
+    /**
+     * @brief UpdateSequences updates the current sequence of parallel Tweens, moving to the next one (or looping) when it's done.
+     *
+     * @param pDeltaTime The time to advance the Tweens by.
+     * @param pCanDeferEasing If true, the Tweens may be eased at the end of the frame (see UBaseTween::UpdateTween).
+     * @param OutLeftoverTime (output) The part of pDeltaTime left after the current sequence ended or looped, to update
+     *        the sequence that comes next with. 0 if it didn't end.
+     *
+     * @return True if ALL Tweens are done (also considering the loops); false otherwise.
+     */
+    bool UpdateSequences(float pDeltaTime, bool pCanDeferEasing, float &OutLeftoverTime);
+
+    /**
+     * @brief EvaluateSignificance rates the targets of the current sequence against the local players.
+     *
+     * @return The highest tier among the targets.
      */
-    void RemoveTweensReferences(TMultiMap<TPair<TWeakObjectPtr<UObject>, ETweenGenericType>, TWeakObjectPtr<UBaseTween> > &pTweensReferenceMap);
+    ETweenSignificance EvaluateSignificance() const;
 
     /**
      * @brief InvertTweens inverts ALL Tweens owned by this TweenContainer.
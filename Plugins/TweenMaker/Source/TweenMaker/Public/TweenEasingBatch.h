@@ -0,0 +1,77 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Utils/TweenEnums.h"
+
+class UBaseTween;
+
+
+/**
+ * @brief The FTweenEasingBatch class collects the Tweens updated by the UTweenContainers during an update and eases them all
+ *        together when the update is over, instead of one at a time.
+ *
+ *        While the batch is open, a Tween that doesn't end in this frame, uses an ease type (not a curve) and has nobody
+ *        listening to its update event only advances its time and registers here. Close sorts the Tweens by ease type,
+ *        computes the eased progress of each type with a single EaseEquations::ComputeEasingAlphaBatch call and the value
+ *        of each Tween, in parallel chunks for large batches (see TweenParallel::ForEachChunk). Then, on the game thread,
+ *        the values are applied in the order the Tweens were updated.
+ *
+ *        Tweens updated while no batch is open are eased right away. Only the game thread writes into the batch.
+ *
+ *        The last Tween updated writes its target last, as without the batch: before a Tween eased right away (i.e. one with
+ *        a curve or an update listener) writes its target, it calls FlushTarget, which applies the Tweens deferred on that target.
+ */
+class TWEENMAKER_API FTweenEasingBatch
+{
+public:
+    /**
+     * @brief Open makes this the batch the Tweens register into, until Close is called. Batches can't be nested.
+     */
+    void Open();
+
+    /**
+     * @brief Close stops collecting the Tweens, eases them and applies their values.
+     */
+    void Close();
+
+    /** Drops all registered Tweens without applying their values */
+    void Reset();
+
+    /**
+     * @brief Defer registers a Tween in the open batch, if any.
+     *
+     * @param pElapsedTime the elapsed time the Tween must be eased at
+     *
+     * @return True if the Tween was registered (its value will be applied by Close), false if no batch is open.
+     */
+    static bool Defer(UBaseTween *pTween, ETweenEaseType pEaseType, float pElapsedTime, float pDuration);
+
+    /**
+     * @brief FlushTarget eases and applies right away the Tweens deferred in the open batch on the given target, if any,
+     *        so that a Tween updated after them doesn't get its value overwritten when the batch is closed.
+     */
+    static void FlushTarget(const UObject *pTarget);
+
+private:
+    /** Registered Tweens, in the order they were updated, along with the inputs of their ease */
+    TArray<TWeakObjectPtr<UBaseTween>> mTweens;
+    TArray<ETweenEaseType> mEaseTypes;
+    TArray<float> mElapsedTimes;
+    TArray<float> mDurations;
+
+    /** Targets of the registered Tweens, so that FlushTarget only looks for Tweens when there are some on its target */
+    TSet<const UObject*> mTargets;
+
+    /** Position of each Tween once sorted by ease type (INDEX_NONE if it's left out), along with the gathered Tweens, inputs and outputs of the batches */
+    TArray<int32> mSortedPositions;
+    TArray<UBaseTween*> mSortedTweens;
+    TArray<float> mSortedTimes;
+    TArray<float> mSortedDurations;
+    TArray<float> mAlphas;
+
+    /** The batch currently open, if any */
+    static FTweenEasingBatch *ActiveBatch;
+};
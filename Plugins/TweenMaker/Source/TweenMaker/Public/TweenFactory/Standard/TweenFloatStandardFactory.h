@@ -1070,6 +1070,111 @@ public:
 
 
 
+    /*
+     **************************************************************************
+     * "Play" methods (the Tween lives in the TweenStore and is referred by a handle)
+     **************************************************************************
+     */
+
+    /**
+      * Plays a Tween that modifies a "float" material parameter from the starting value to the ending value.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target material.
+      * @param ParameterName The name of the material's parameter to tween.
+      * @param From The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Material Float From To", KeyWords="Tween Material Float From To Play Handle", AdvancedDisplay=7), Category = "Tween|StandardTween|Material")
+    static FTweenHandle BP_PlayTweenMaterialFloatFromTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UMaterialInstanceDynamic *TweenTarget,
+                                                        FName ParameterName, float From, float To,
+                                                        float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                        int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                        float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that modifies a "float" material parameter from its current value (at the start of the Tween) to the ending value.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target material.
+      * @param ParameterName The name of the material's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Material Float To", KeyWords="Tween Material Float To Play Handle", AdvancedDisplay=6), Category = "Tween|StandardTween|Material")
+    static FTweenHandle BP_PlayTweenMaterialFloatTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UMaterialInstanceDynamic *TweenTarget,
+                                                    FName ParameterName, float To,
+                                                    float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                    int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                    float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that makes a UMG widget rotate to the given angle.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target Widget.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Widget Angle To", KeyWords="Tween Widget Angle To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Angle")
+    static FTweenHandle BP_PlayTweenWidgetAngleTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                  float To,
+                                                  float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                  int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                  float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that makes a UMG widget's opacity reach the given value.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target Widget.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Widget Opacity To", KeyWords="Tween Widget Opacity To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Opacity")
+    static FTweenHandle BP_PlayTweenWidgetOpacityTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                    float To,
+                                                    float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                    int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                    float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
 private:
 
     /*
@@ -1127,4 +1232,8 @@ private:
                                                     bool pDeleteTweenOnHit, bool pDeleteTweenOnOverlap,
                                                     float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused, int32 pSequenceIndex);
 
+    static FTweenHandle StoreTweenFloat(UTweenManagerComponent *pTweenManagerComponent, ETweenFloatType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                        float pFrom, float pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType,
+                                        float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused, FName pParameterName);
+
 };
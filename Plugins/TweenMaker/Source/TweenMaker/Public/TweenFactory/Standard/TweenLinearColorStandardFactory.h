@@ -208,6 +208,63 @@ public:
                                                              float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false, int32 SequenceIndex = -1);
 
 
+    /*
+     **************************************************************************
+     * "Play" methods (the Tween lives in the TweenStore and is referred by a handle)
+     **************************************************************************
+     */
+
+    /**
+      * Plays a Tween that modifies a "Vector" material parameter from the starting value to the ending value.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target material.
+      * @param ParameterName The name of the material's parameter to tween.
+      * @param From The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Material Vector From To", KeyWords="Tween Material Vector From To Play Handle", AdvancedDisplay=7), Category = "Tween|StandardTween|Material")
+    static FTweenHandle BP_PlayTweenMaterialVectorFromTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UMaterialInstanceDynamic *TweenTarget,
+                                                         FName ParameterName, FLinearColor From, FLinearColor To,
+                                                         float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                         int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                         float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that modifies a "Vector" material parameter from its current value (at the start of the Tween) to the ending value.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target material.
+      * @param ParameterName The name of the material's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Material Vector To", KeyWords="Tween Material Vector To Play Handle", AdvancedDisplay=6), Category = "Tween|StandardTween|Material")
+    static FTweenHandle BP_PlayTweenMaterialVectorTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UMaterialInstanceDynamic *TweenTarget,
+                                                     FName ParameterName, FLinearColor To,
+                                                     float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                     int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                     float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
 private:
 
     /*
@@ -224,4 +281,8 @@ private:
                                           const FLinearColor &pTo, float pDuration, ETweenEaseType pEaseType, float pDelay,
                                           float pTimeScale, bool pTweenWhileGameIsPaused, int32 pSequenceIndex);
 
+    static FTweenHandle StoreTweenLinearColor(UTweenManagerComponent *pTweenManagerComponent, ETweenLinearColorType pTweenType, UObject *pTarget, FName pParameterName,
+                                              const FLinearColor &pFrom, const FLinearColor &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                              ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused);
+
 };
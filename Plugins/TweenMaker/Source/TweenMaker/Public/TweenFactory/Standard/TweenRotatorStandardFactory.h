@@ -383,6 +383,108 @@ public:
                                                              float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false, int32 SequenceIndex = -1);
 
 
+    /*
+     **************************************************************************
+     * "Play" methods (the Tween lives in the TweenStore and is referred by a handle)
+     **************************************************************************
+     */
+
+    /**
+      * Plays a Tween that rotates an Actor from its current orientation (at the start of the Tween) to the given rotation.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to rotate.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Rotate Actor To", KeyWords="Tween Rotate Actor To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|Actor|Rotate")
+    static FTweenHandle BP_PlayTweenRotateActorTo(UTweenManagerComponent *TweenManager, UPARAM(ref) AActor *TweenTarget,
+                                                  FRotator To,
+                                                  float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                  int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                  float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that rotates an Actor by the given offset with respect to its current orientation (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to rotate.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Rotate Actor By", KeyWords="Tween Rotate Actor By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|Actor|Rotate")
+    static FTweenHandle BP_PlayTweenRotateActorBy(UTweenManagerComponent *TweenManager, UPARAM(ref) AActor *TweenTarget,
+                                                  FRotator By,
+                                                  float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                  int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                  float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that rotates a SceneComponent from its current orientation (at the start of the Tween) to the given rotation.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to rotate.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Rotate Scene Component To", KeyWords="Tween Rotate Scene Component To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|SceneComponent|Rotate")
+    static FTweenHandle BP_PlayTweenRotateSceneComponentTo(UTweenManagerComponent *TweenManager, UPARAM(ref) USceneComponent *TweenTarget,
+                                                           FRotator To,
+                                                           float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                           int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                           float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that rotates a SceneComponent by the given offset with respect to its current orientation (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to rotate.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Rotate Scene Component By", KeyWords="Tween Rotate Scene Component By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|SceneComponent|Rotate")
+    static FTweenHandle BP_PlayTweenRotateSceneComponentBy(UTweenManagerComponent *TweenManager, UPARAM(ref) USceneComponent *TweenTarget,
+                                                           FRotator By,
+                                                           float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                           int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                           float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
 private:
 
     /*
@@ -401,4 +503,8 @@ private:
                                                  bool pDeleteTweenOnHit, bool pDeleteTweenOnOverlap, float pDelay,
                                           float pTimeScale, bool pTweenWhileGameIsPaused, int32 pSequenceIndex);
 
+    static FTweenHandle StoreTweenRotator(UTweenManagerComponent *pTweenManagerComponent, ETweenRotatorType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                          const FRotator &pFrom, const FRotator &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                          ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused);
+
 };
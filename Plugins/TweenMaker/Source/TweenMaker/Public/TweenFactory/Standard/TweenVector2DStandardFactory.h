@@ -533,6 +533,132 @@ public:
                                                       float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false, int32 SequenceIndex = -1);
 
 
+    /*
+     **************************************************************************
+     * "Play" methods (the Tween lives in the TweenStore and is referred by a handle)
+     **************************************************************************
+     */
+
+    /**
+      * Plays a Tween that moves a UMG widget from its current location (at the start of the Tween) to the given location.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Widget to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Move Widget To", KeyWords="Tween Move Widget To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Move")
+    static FTweenHandle BP_PlayTweenMoveWidgetTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                 FVector2D To,
+                                                 float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                 int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                 float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that moves a UMG widget by the given offset with respect to its current location (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Widget to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Move Widget By", KeyWords="Tween Move Widget By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Move")
+    static FTweenHandle BP_PlayTweenMoveWidgetBy(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                 FVector2D By,
+                                                 float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                 int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                 float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that scales a UMG widget from its current scale (at the start of the Tween) to the given size.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Widget to scale.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Scale Widget To", KeyWords="Tween Scale Widget To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Scale")
+    static FTweenHandle BP_PlayTweenScaleWidgetTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                  FVector2D To,
+                                                  float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                  int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                  float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that scales a UMG widget by the given offset with respect to its current size (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Widget to scale.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Scale Widget By", KeyWords="Tween Scale Widget By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Scale")
+    static FTweenHandle BP_PlayTweenScaleWidgetBy(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                  FVector2D By,
+                                                  float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                  int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                  float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that modifies a UMG widget's shear value from its current value (at the start of the Tween) to the given ending value.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Widget to shear.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Shear Widget To", KeyWords="Tween Shear Widget To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|UMG|Shear")
+    static FTweenHandle BP_PlayTweenShearWidgetTo(UTweenManagerComponent *TweenManager, UPARAM(ref) UWidget *TweenTarget,
+                                                  FVector2D To,
+                                                  float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                  int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                  float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
 private:
 
     /*
@@ -549,4 +675,8 @@ private:
                                                    const FVector2D &pFrom, const FVector2D &pTo, float pDuration, ETweenEaseType pEaseType, float pDelay,
                                                    float pTimeScale, bool pTweenWhileGameIsPaused, int32 pSequenceIndex);
 
+    static FTweenHandle StoreTweenVector2D(UTweenManagerComponent *pTweenManagerComponent, ETweenVector2DType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                           const FVector2D &pFrom, const FVector2D &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                           ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused);
+
 };
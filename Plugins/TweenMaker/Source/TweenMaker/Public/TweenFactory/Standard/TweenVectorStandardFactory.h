@@ -789,6 +789,204 @@ public:
                                                   FVector From, FVector To, float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
                                                   float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false, int32 SequenceIndex = -1);
 
+    /*
+     **************************************************************************
+     * "Play" methods (the Tween lives in the TweenStore and is referred by a handle)
+     **************************************************************************
+     */
+
+    /**
+      * Plays a Tween that moves an Actor from its current location (at the start of the Tween) to the given location.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Move Actor To", KeyWords="Tween Move Actor To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|Actor|Move")
+    static FTweenHandle BP_PlayTweenMoveActorTo(UTweenManagerComponent *TweenManager, UPARAM(ref) AActor *TweenTarget,
+                                                FVector To,
+                                                float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that moves an Actor by the given offset with respect to its current location (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Move Actor By", KeyWords="Tween Move Actor By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|Actor|Move")
+    static FTweenHandle BP_PlayTweenMoveActorBy(UTweenManagerComponent *TweenManager, UPARAM(ref) AActor *TweenTarget,
+                                                FVector By,
+                                                float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that scales an Actor from its current scale (at the start of the Tween) to the given size.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Scale Actor To", KeyWords="Tween Scale Actor To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|Actor|Scale")
+    static FTweenHandle BP_PlayTweenScaleActorTo(UTweenManagerComponent *TweenManager, UPARAM(ref) AActor *TweenTarget,
+                                                 FVector To,
+                                                 float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                 int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                 float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that scales an Actor by the given offset with respect to its current size (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Scale Actor By", KeyWords="Tween Scale Actor By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|Actor|Scale")
+    static FTweenHandle BP_PlayTweenScaleActorBy(UTweenManagerComponent *TweenManager, UPARAM(ref) AActor *TweenTarget,
+                                                 FVector By,
+                                                 float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                 int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                 float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that moves a SceneComponent from its current location (at the start of the Tween) to the given location.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Move Scene Component To", KeyWords="Tween Move Scene Component To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|SceneComponent|Move")
+    static FTweenHandle BP_PlayTweenMoveSceneComponentTo(UTweenManagerComponent *TweenManager, UPARAM(ref) USceneComponent *TweenTarget,
+                                                         FVector To,
+                                                         float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                         int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                         float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that moves a SceneComponent by the given offset with respect to its current location (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Move Scene Component By", KeyWords="Tween Move Scene Component By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|SceneComponent|Move")
+    static FTweenHandle BP_PlayTweenMoveSceneComponentBy(UTweenManagerComponent *TweenManager, UPARAM(ref) USceneComponent *TweenTarget,
+                                                         FVector By,
+                                                         float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                         int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                         float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that scales a SceneComponent from its current scale (at the start of the Tween) to the given size.
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Scale Scene Component To", KeyWords="Tween Scale Scene Component To Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|SceneComponent|Scale")
+    static FTweenHandle BP_PlayTweenScaleSceneComponentTo(UTweenManagerComponent *TweenManager, UPARAM(ref) USceneComponent *TweenTarget,
+                                                          FVector To,
+                                                          float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                          int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                          float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Plays a Tween that scales a SceneComponent by the given offset with respect to its current size (at the start of the Tween).
+      * The Tween is kept in the TweenStore of the TweenManager, so no Tween object is created for it: use the returned handle
+      * with the "Tween Handle" methods of the same TweenManager. Use the "Create" version if the Tween needs delegates or a sequence.
+      *
+      * @param (optional) TweenManager The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @return The handle of the Tween. It's not set if the Tween couldn't be stored.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Play Tween Scale Scene Component By", KeyWords="Tween Scale Scene Component By Play Handle", AdvancedDisplay=5), Category = "Tween|StandardTween|SceneComponent|Scale")
+    static FTweenHandle BP_PlayTweenScaleSceneComponentBy(UTweenManagerComponent *TweenManager, UPARAM(ref) USceneComponent *TweenTarget,
+                                                          FVector By,
+                                                          float Duration = 1.0f, ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                                          int32 NumLoops = 1, ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                                          float Delay = 0.0f, float TimeScale = 1.0f, bool TweenWhileGameIsPaused = false);
+
 private:
 
     /*
@@ -807,4 +1005,8 @@ private:
                                             bool DeleteTweenOnHit, bool DeleteTweenOnOverlap, float pDelay,
                                           float pTimeScale, bool pTweenWhileGameIsPaused, int32 pSequenceIndex);
 
+    static FTweenHandle StoreTweenVector(UTweenManagerComponent *pTweenManagerComponent, ETweenVectorType pTweenType, UObject *pTarget, ETweenTargetType pTargetType,
+                                         const FVector &pFrom, const FVector &pTo, float pDuration, ETweenEaseType pEaseType, int32 pNumLoops,
+                                         ETweenLoopType pLoopType, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused);
+
 };
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Utils/TweenEnums.h"
+#include "TweenStore/TweenStore.h"
+#include "TweenReferenceTable.h"
 #include "TweenManagerComponent.generated.h"
 
 class UTweenVectorLatentFactory;
@@ -129,9 +131,10 @@ DECLARE_DELEGATE_TwoParams(FOnTweenSplinePointReached, UTweenFloat*, int32);
  * The UTweenManagerComponent class is in charge of managing TweenContainers (that contain the actual Tweens).
  * It can be attached to an Actor or used globally in a level by placing a ATweenManagerActor.
  * Even if the TweenManager handles TweenContainers, each Tween that is created passes through the TweenManager first,
- * where its reference is saved in a Map for easy and fast access (mainly when deletion is involved)
+ * where its reference is saved in a table for easy and fast access (mainly when deletion is involved)
  *
  * If the TweenManager is attached to an Actor, it provides methods to create empty TweenContainers and to delete Tweens.
+ * The TweenManager doesn't tick: all TweenManagers of a world are updated together by the UTweenWorldSubsystem.
  */
 UCLASS(ClassGroup=(Tween), meta=(BlueprintSpawnableComponent))
 class TWEENMAKER_API UTweenManagerComponent : public UActorComponent
@@ -150,18 +153,20 @@ class TWEENMAKER_API UTweenManagerComponent : public UActorComponent
     friend class UTweenVector2DStandardFactory;
     friend class UTweenRotatorStandardFactory;
 
+    friend class UTweenWorldSubsystem;
+
 public:	
 	UTweenManagerComponent();
 
 protected:
-    virtual void BeginPlay() override;
-
-public:
     /**
-     * @brief TickComponent handles the update of all TweenContainers owned by this TweenManager.
+     * @brief BeginPlay registers this TweenManager with the UTweenWorldSubsystem, which updates it every frame.
      */
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+public:
 
     /*
      **************************************************************************
@@ -224,6 +229,55 @@ public:
     UFUNCTION(BlueprintCallable, meta = (DisplayName="Find Tween By Name", KeyWords="Find Tween By Name"), Category = "Tween|Utils")
     bool FindTweenByName(FName TweenName, ETweenGenericType TweenType, UBaseTween *&TweenFound);
 
+    /*
+     **************************************************************************
+     * "Tween Handle" methods
+     **************************************************************************
+     */
+
+    /**
+     * Checks if the Tween referred by the handle is still running, either in the TweenStore or as a promoted Tween.
+     *
+     * @param Handle The handle of the Tween.
+     *
+     * @return True if the Tween is still alive.
+     */
+    UFUNCTION(BlueprintPure, meta = (DisplayName="Is Tween Alive", KeyWords="Is Tween Alive Handle"), Category = "Tween|Handle")
+    bool IsTweenAlive(FTweenHandle Handle) const;
+
+    /**
+     * Deletes the Tween referred by the handle. The deletion will occur instantly.
+     *
+     * @param Handle The handle of the Tween.
+     *
+     * @return True if the Tween was alive and got deleted.
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Delete Tween By Handle", KeyWords="Delete Remove Tween Handle"), Category = "Tween|Handle")
+    bool DeleteTweenByHandle(FTweenHandle Handle);
+
+    /**
+     * Pauses or resumes the Tween referred by the handle.
+     *
+     * @param Handle The handle of the Tween.
+     * @param bPaused True to pause the Tween, false to resume it.
+     *
+     * @return True if the Tween was alive.
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Set Tween Paused By Handle", KeyWords="Pause Resume Tween Handle"), Category = "Tween|Handle")
+    bool SetTweenPausedByHandle(FTweenHandle Handle, bool bPaused);
+
+    /**
+     * Returns the Tween object referred by the handle. Tweens living in the TweenStore don't have one: the first time this is called
+     * the Tween is moved out of the store into its own TweenContainer, picking up where it was. From then on, the handle keeps
+     * returning the same Tween object.
+     *
+     * @param Handle The handle of the Tween.
+     *
+     * @return The Tween object, or null if the Tween is no longer alive.
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Get Tween Object", KeyWords="Get Tween Object Handle"), Category = "Tween|Handle")
+    UBaseTween* GetTweenObject(FTweenHandle Handle);
+
     /*
      **************************************************************************
      * C++ methods (i.e. meant to be called when using this plugin in C++)
@@ -253,6 +307,24 @@ public:
      */
     static UTweenContainer* CreateTweenContainerStatic(int32 pNumLoops = 1, ETweenLoopType pLoopType = ETweenLoopType::Yoyo, float pTimeScale = 1.0f);
 
+    /**
+     * Returns the TweenStore of this TweenManager. Tweens added to it are plain structs updated by this TweenManager:
+     * creating and finishing them doesn't allocate any UObject. Use the returned handles with the "Tween Handle" methods.
+     *
+     * @return The TweenStore.
+     */
+    FTweenStore& GetTweenStore()
+    {
+        return mTweenStore;
+    }
+
+    /**
+     * Returns the TweenStore of the ATweenManagerActor present in the level. If none is present, a warning will be issued and null is returned.
+     *
+     * @return The TweenStore, or null.
+     */
+    static FTweenStore* GetTweenStoreStatic();
+
 private:
 
     /*
@@ -263,10 +335,10 @@ private:
 
     /**
      * This method is called whenever a Tween changes name using the appropriate method. It updates
-     * the corresponding entry from the map.
+     * the name the Tween can be found by in the reference table.
      * 
-     * Initially, Tweens are not added to the map, since they have no name. 
-     * They're added only if a name is actually set.
+     * Initially, Tweens can't be found by name, since they have no name. 
+     * They can only once a name is actually set.
      * 
      * @param pTween The Tween that changed name.
      * @param pPreviousName The previous name of the Tween ("None" if there wasn't one).
@@ -277,7 +349,7 @@ private:
 
     /**
      * This method is called right before a Tween is deleted. This gives the chance to perform last clenaup 
-     * operations. In particular, it removes the corresponding name from the name map, in case it was present.
+     * operations. In particular, it releases the entry of the Tween from the reference table.
 
      * @param pTween The Tween that changed name.
      */
@@ -379,11 +451,20 @@ private:
      **************************************************************************
      */
 
+    /**
+     * @brief UpdateTweens handles the update of all TweenContainers and stored Tweens owned by this TweenManager.
+     * Called every frame by the UTweenWorldSubsystem, which checks the game pause once for all TweenManagers.
+     */
+    void UpdateTweens(float pDeltaTime, bool pIsGamePaused);
+
     /** Fully destroys a TweenContainer */
     void DestroyTweenContainer(UTweenContainer *pTweenContainer, int32 pIndex);
 
+    /** Moves a stored Tween out of the TweenStore into its own TweenContainer. Returns null if the Tween is not alive */
+    UBaseTween* PromoteStoredTween(const FTweenHandle &pHandle);
+
     // Methods that take a TweenTarget and its type and make an association
-    // between them and the corresponding Tween in the reference MultiMap
+    // between them and the corresponding Tween in the reference table
     void SaveTweenReference(UObject *pTweenTarget, ETweenVectorType pTweenType, UBaseTween *pTween);
     void SaveTweenReference(UObject *pTweenTarget, ETweenVector2DType pTweenType, UBaseTween *pTween);
     void SaveTweenReference(UObject *pTweenTarget, ETweenRotatorType pTweenType, UBaseTween *pTween);
@@ -397,18 +478,15 @@ private:
     TArray<UTweenContainer*> mTweenContainers;
 
     /**
-     * Reference MultiMap. Each Tween that is created is added to this MultiMap for easier access.
-     * Keys: pairs composed by a TweenTarget and its generic type.
-     * Values: the corresponding Tweens. Might be more than one, for example if there are several of
-     *         instances of the same Tween (with different values) appended together.
+     * Reference table. Each Tween that is created gets an entry here, so that it can be found by its target and generic type
+     * (there might be several Tweens for the same pair, for example if there are several instances of the same Tween appended
+     * together), or by its name once it has one. The entry is released when the Tween is destroyed (for any reason).
      */
-    TMultiMap<TPair<TWeakObjectPtr<UObject>, ETweenGenericType>, TWeakObjectPtr<UBaseTween>> mTweensByObjectMap;
+    FTweenReferenceTable mTweenReferences;
 
-    /**
-     * Reference MultiMap. Whenever a new name is set to a Tween, it is added to this map to keep track of each Tween with a tag,
-     * for easier access. When the Tween is destroyed (for any reason), it is removed from the map.
-     * Keys: pairs composed by a Tween name and its generic type.
-     * Values: the corresponding Tweens. Might be more than one, if the names are not unique.
-     */
-    TMultiMap<TPair<FName, ETweenGenericType>, TWeakObjectPtr<UBaseTween>> mTweensByNameMap;
+    /** Plain-struct Tweens, updated alongside the TweenContainers without any UObject involved */
+    FTweenStore mTweenStore;
+
+    /** Tweens moved out of the TweenStore because a UBaseTween was needed, keyed by the handle they were stored with */
+    TMap<FTweenHandle, TWeakObjectPtr<UBaseTween>> mPromotedTweens;
 };
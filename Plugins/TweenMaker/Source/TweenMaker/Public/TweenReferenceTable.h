@@ -0,0 +1,118 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Utils/TweenEnums.h"
+
+class UBaseTween;
+
+
+/**
+ * @brief Identifies the entry of a Tween in a FTweenReferenceTable. The generation is bumped every time the entry is released,
+ *        so a reference to a released entry never resolves to the Tween that took its place.
+ */
+struct FTweenReference
+{
+    int32 Index = INDEX_NONE;
+
+    uint32 Generation = 0;
+
+    bool IsSet() const
+    {
+        return Index != INDEX_NONE;
+    }
+};
+
+
+/**
+ * @brief The FTweenReferenceTable class keeps track of the Tweens created by a TweenManager, so that they can be found
+ *        by target and by name.
+ *
+ *        Entries live in a slot array with generations (each Tween keeps its FTweenReference), plus one list of slots per target
+ *        and one per name. Adding, removing and renaming a Tween are O(1), and looking up a target or a name only walks
+ *        the Tweens of that target or name. Entries are released as soon as their Tween is destroyed, so they don't outlive it.
+ */
+class TWEENMAKER_API FTweenReferenceTable
+{
+public:
+    /** Adds an entry for the given Tween and returns its reference */
+    FTweenReference Add(UBaseTween *pTween, UObject *pTarget, ETweenGenericType pTweenType);
+
+    /** Releases an entry. Returns false if the entry was already released */
+    bool Remove(const FTweenReference &pReference);
+
+    /** Returns the Tween of an entry, or null if the entry was released or the Tween is gone */
+    UBaseTween* Resolve(const FTweenReference &pReference) const;
+
+    /** Changes the name an entry can be found by. NAME_None removes it from the names */
+    void SetName(const FTweenReference &pReference, FName pName);
+
+    /**
+     * @brief FindByObject collects the Tweens with the given target and type.
+     *
+     * @param pTweenType the type of the Tweens to collect (Any to collect all of them)
+     * @param pRemove if true, the entries found are also released
+     */
+    void FindByObject(const UObject *pTarget, ETweenGenericType pTweenType, TArray<UBaseTween*> &pOutTweens, bool pRemove = false);
+
+    /** Returns the first Tween with the given name and type (Any to match all types), or null if there is none */
+    UBaseTween* FindByName(FName pName, ETweenGenericType pTweenType) const;
+
+    /** Number of entries in use */
+    int32 Num() const
+    {
+        return mSlots.Num() - mFreeSlots.Num();
+    }
+
+    /** Releases all entries */
+    void Reset();
+
+private:
+    struct FSlot
+    {
+        TWeakObjectPtr<UBaseTween> Tween;
+
+        /** The target, used as the key of mSlotsByTarget (raw, so that the lookups don't need to resolve it) */
+        const UObject *TargetKey = nullptr;
+
+        /** The target again, only to tell it apart from a new object that got the address of a dead one */
+        TWeakObjectPtr<UObject> Target;
+
+        FName Name = NAME_None;
+
+        ETweenGenericType TweenType = ETweenGenericType::Any;
+
+        uint32 Generation = 0;
+
+        /** Position of this slot in its lists of mSlotsByTarget and mSlotsByName, so that it can be removed from them in O(1) */
+        int32 TargetListIndex = INDEX_NONE;
+        int32 NameListIndex = INDEX_NONE;
+
+        bool bInUse = false;
+    };
+
+    /** Returns the slot of a reference, or null if the reference is stale */
+    FSlot* FindSlot(const FTweenReference &pReference);
+    const FSlot* FindSlot(const FTweenReference &pReference) const;
+
+    /** Releases a slot in use */
+    void RemoveSlot(int32 pSlotIndex);
+
+    /** Empties a slot and bumps its generation, so that its references become stale */
+    static void ClearSlot(FSlot &pSlot);
+
+    /** Removes a slot from a list of slots, with a swap, fixing the position saved in the slot that was moved */
+    template<typename TKey>
+    void RemoveFromList(TMap<TKey, TArray<int32>> &pLists, const TKey &pKey, int32 pListIndex, int32 FSlot::*pListIndexMember);
+
+    TArray<FSlot> mSlots;
+
+    /** Slots released, reused before adding new ones */
+    TArray<int32> mFreeSlots;
+
+    TMap<const UObject*, TArray<int32>> mSlotsByTarget;
+
+    TMap<FName, TArray<int32>> mSlotsByName;
+};
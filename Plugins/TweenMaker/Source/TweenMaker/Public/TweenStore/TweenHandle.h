@@ -0,0 +1,86 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TweenHandle.generated.h"
+
+
+/**
+ * @brief The storage lanes of the FTweenStore; each lane keeps the Tweens of a single value type.
+ */
+enum class ETweenStoreLane : uint8
+{
+    None,
+    Vector,
+    Vector2D,
+    Rotator,
+    LinearColor,
+    Float
+};
+
+
+/**
+ * The FTweenHandle identifies a Tween living in a FTweenStore, without the need of a UObject.
+ *
+ * The index points to a slot of the lane the Tween was stored into, while the generation is bumped every time
+ * that slot is released: a handle whose generation doesn't match the slot's one refers to a Tween that is gone,
+ * so it can be safely kept around (and compared) even after the Tween has ended.
+ */
+USTRUCT(BlueprintType)
+struct TWEENMAKER_API FTweenHandle
+{
+    GENERATED_USTRUCT_BODY()
+
+    FTweenHandle()
+        : Index(INDEX_NONE)
+        , Generation(0)
+        , Lane(0)
+    {
+    }
+
+    FTweenHandle(ETweenStoreLane pLane, int32 pIndex, uint32 pGeneration)
+        : Index(pIndex)
+        , Generation(pGeneration)
+        , Lane((uint8)pLane)
+    {
+    }
+
+    /** Returns true if the handle was ever given out by a FTweenStore. It says nothing about the Tween still being alive. */
+    bool IsSet() const
+    {
+        return Index != INDEX_NONE && Lane != (uint8)ETweenStoreLane::None;
+    }
+
+    ETweenStoreLane GetLane() const
+    {
+        return (ETweenStoreLane)Lane;
+    }
+
+    bool operator==(const FTweenHandle &pOther) const
+    {
+        return Index == pOther.Index && Generation == pOther.Generation && Lane == pOther.Lane;
+    }
+
+    bool operator!=(const FTweenHandle &pOther) const
+    {
+        return !(*this == pOther);
+    }
+
+    friend uint32 GetTypeHash(const FTweenHandle &pHandle)
+    {
+        return HashCombine(GetTypeHash(pHandle.Index), GetTypeHash(pHandle.Generation ^ ((uint32)pHandle.Lane << 24)));
+    }
+
+    /** Slot of the Tween inside its lane */
+    UPROPERTY()
+    int32 Index;
+
+    /** Generation of the slot at the time the Tween was stored */
+    UPROPERTY()
+    uint32 Generation;
+
+    /** The ETweenStoreLane the Tween lives in */
+    UPROPERTY()
+    uint8 Lane;
+};
@@ -0,0 +1,483 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/TweenEnums.h"
+#include "TweenStore/TweenHandle.h"
+
+
+/**
+ * @brief Per-Tween state bits of a FTweenStore lane.
+ */
+enum class ETweenStoreFlags : uint8
+{
+    None                    = 0,
+    Paused                  = 1 << 0,
+    Prepared                = 1 << 1,
+    TweenWhileGameIsPaused  = 1 << 2,
+    PendingDeletion         = 1 << 3
+};
+
+ENUM_CLASS_FLAGS(ETweenStoreFlags);
+
+
+/**
+ * @brief Parameters shared by every stored Tween, regardless of its value type. They mirror the ones
+ *        taken by UBaseTween::InitBase.
+ */
+struct FTweenStoreParams
+{
+    FTweenStoreParams()
+    {
+    }
+
+    FTweenStoreParams(float pDuration, ETweenEaseType pEaseType, int32 pNumLoops, ETweenLoopType pLoopType, float pDelay, float pTimeScale,
+                      bool pTweenWhileGameIsPaused)
+        : Duration(pDuration)
+        , EaseType(pEaseType)
+        , NumLoops(pNumLoops)
+        , LoopType(pLoopType)
+        , Delay(pDelay)
+        , TimeScale(pTimeScale)
+        , bTweenWhileGameIsPaused(pTweenWhileGameIsPaused)
+    {
+    }
+
+    float Duration = 1.0f;
+    ETweenEaseType EaseType = ETweenEaseType::Linear;
+    int32 NumLoops = 1;
+    ETweenLoopType LoopType = ETweenLoopType::Yoyo;
+    float Delay = 0.0f;
+    float TimeScale = 1.0f;
+    bool bTweenWhileGameIsPaused = false;
+};
+
+
+/**
+ * @brief A single stored Tween copied out of its lane. It's what a FTweenStore hands back when a Tween
+ *        needs to leave the store (i.e. when it gets promoted to a UBaseTween).
+ */
+template<typename TValue, typename TTweenType>
+struct TStoredTween
+{
+    TWeakObjectPtr<UObject> Target;
+    ETweenTargetType TargetType = ETweenTargetType::Custom;
+    TTweenType TweenType = TTweenType();
+    FName ParameterName;
+
+    /** Timing of the Tween; NumLoops holds the loops still left to run (<= 0 if infinite) */
+    FTweenStoreParams Params;
+
+    /** Elapsed time of the current loop */
+    float ElapsedTime = 0.0f;
+
+    ETweenStoreFlags Flags = ETweenStoreFlags::None;
+
+    TValue From;
+    TValue To;
+    TValue BaseOffset;
+    TValue CurrentValue;
+};
+
+
+/**
+ * The TTweenLane keeps all the Tweens of one value type in a structure-of-arrays layout: every property is a
+ * tightly packed column, indexed by a dense index, so the update walks plain arrays instead of chasing one UObject per Tween.
+ *
+ * Dense indices move around when Tweens are removed (swap-remove), so Tweens are referred to from the outside
+ * through generational slots (see FTweenHandle).
+ */
+template<typename TValue, typename TTweenType>
+class TTweenLane
+{
+public:
+    typedef TStoredTween<TValue, TTweenType> FStoredTween;
+
+    explicit TTweenLane(ETweenStoreLane pLane)
+        : mLane(pLane)
+    {
+    }
+
+    /**
+     * @brief Add stores a new Tween at the end of the lane.
+     *
+     * @return The handle referring to the new Tween.
+     */
+    FTweenHandle Add(UObject *pTarget, ETweenTargetType pTargetType, TTweenType pTweenType, FName pParameterName,
+                     const TValue &pFrom, const TValue &pTo, const FTweenStoreParams &pParams)
+    {
+        int32 slot = INDEX_NONE;
+
+        if(mFreeSlots.Num() > 0)
+        {
+            slot = mFreeSlots.Pop(false);
+        }
+        else
+        {
+            slot = mSlotToDense.Add(INDEX_NONE);
+            mSlotGeneration.Add(1);
+        }
+
+        ETweenStoreFlags flags = pParams.bTweenWhileGameIsPaused ? ETweenStoreFlags::TweenWhileGameIsPaused : ETweenStoreFlags::None;
+
+        // The value types stored in the lanes don't zero themselves when default constructed
+        TValue zeroOffset;
+        FMemory::Memzero(zeroOffset);
+
+        const int32 denseIndex = mDenseToSlot.Add(slot);
+        mSlotToDense[slot] = denseIndex;
+
+        mDelayLeft.Add(FMath::Max(pParams.Delay, 0.0f));
+        mElapsedTime.Add(0.0f);
+        mDuration.Add(pParams.Duration);
+        mTimeScale.Add(pParams.TimeScale);
+        mLoopsLeft.Add(pParams.NumLoops);
+        mLoopType.Add(pParams.LoopType);
+        mEaseType.Add(pParams.EaseType);
+        mFlags.Add(flags);
+
+        mTarget.Add(pTarget);
+        mTargetType.Add(pTargetType);
+        mTweenType.Add(pTweenType);
+        mParameterName.Add(pParameterName);
+
+        mFrom.Add(pFrom);
+        mTo.Add(pTo);
+        mBaseOffset.Add(zeroOffset);
+        mCurrentValue.Add(pFrom);
+
+        return FTweenHandle(mLane, slot, mSlotGeneration[slot]);
+    }
+
+    /** Returns the dense index of the Tween referred by the handle, or INDEX_NONE if the Tween is gone */
+    int32 Find(const FTweenHandle &pHandle) const
+    {
+        if(pHandle.GetLane() != mLane || !mSlotToDense.IsValidIndex(pHandle.Index) || mSlotGeneration[pHandle.Index] != pHandle.Generation)
+        {
+            return INDEX_NONE;
+        }
+
+        const int32 denseIndex = mSlotToDense[pHandle.Index];
+
+        if(denseIndex == INDEX_NONE || EnumHasAnyFlags(mFlags[denseIndex], ETweenStoreFlags::PendingDeletion))
+        {
+            return INDEX_NONE;
+        }
+
+        return denseIndex;
+    }
+
+    FTweenHandle GetHandle(int32 pDenseIndex) const
+    {
+        const int32 slot = mDenseToSlot[pDenseIndex];
+        return FTweenHandle(mLane, slot, mSlotGeneration[slot]);
+    }
+
+    /** Copies the Tween at the given dense index out of the lane */
+    void Copy(int32 pDenseIndex, FStoredTween &pOutTween) const
+    {
+        pOutTween.Target = mTarget[pDenseIndex];
+        pOutTween.TargetType = mTargetType[pDenseIndex];
+        pOutTween.TweenType = mTweenType[pDenseIndex];
+        pOutTween.ParameterName = mParameterName[pDenseIndex];
+
+        pOutTween.Params.Duration = mDuration[pDenseIndex];
+        pOutTween.Params.EaseType = mEaseType[pDenseIndex];
+        pOutTween.Params.NumLoops = mLoopsLeft[pDenseIndex];
+        pOutTween.Params.LoopType = mLoopType[pDenseIndex];
+        pOutTween.Params.Delay = FMath::Max(mDelayLeft[pDenseIndex], 0.0f);
+        pOutTween.Params.TimeScale = mTimeScale[pDenseIndex];
+        pOutTween.Params.bTweenWhileGameIsPaused = EnumHasAnyFlags(mFlags[pDenseIndex], ETweenStoreFlags::TweenWhileGameIsPaused);
+
+        pOutTween.ElapsedTime = mElapsedTime[pDenseIndex];
+        pOutTween.Flags = mFlags[pDenseIndex];
+
+        pOutTween.From = mFrom[pDenseIndex];
+        pOutTween.To = mTo[pDenseIndex];
+        pOutTween.BaseOffset = mBaseOffset[pDenseIndex];
+        pOutTween.CurrentValue = mCurrentValue[pDenseIndex];
+    }
+
+    /**
+     * @brief RemoveAt removes the Tween at the given dense index by swapping the last Tween in its place.
+     *        The slot is released and its generation bumped, so every handle to the removed Tween goes stale.
+     */
+    void RemoveAt(int32 pDenseIndex)
+    {
+        const int32 slot = mDenseToSlot[pDenseIndex];
+        const int32 lastIndex = mDenseToSlot.Num() - 1;
+
+        if(pDenseIndex != lastIndex)
+        {
+            mSlotToDense[mDenseToSlot[lastIndex]] = pDenseIndex;
+        }
+
+        mSlotToDense[slot] = INDEX_NONE;
+        mSlotGeneration[slot]++;
+        mFreeSlots.Add(slot);
+
+        mDenseToSlot.RemoveAtSwap(pDenseIndex, 1, false);
+
+        mDelayLeft.RemoveAtSwap(pDenseIndex, 1, false);
+        mElapsedTime.RemoveAtSwap(pDenseIndex, 1, false);
+        mDuration.RemoveAtSwap(pDenseIndex, 1, false);
+        mTimeScale.RemoveAtSwap(pDenseIndex, 1, false);
+        mLoopsLeft.RemoveAtSwap(pDenseIndex, 1, false);
+        mLoopType.RemoveAtSwap(pDenseIndex, 1, false);
+        mEaseType.RemoveAtSwap(pDenseIndex, 1, false);
+        mFlags.RemoveAtSwap(pDenseIndex, 1, false);
+
+        mTarget.RemoveAtSwap(pDenseIndex, 1, false);
+        mTargetType.RemoveAtSwap(pDenseIndex, 1, false);
+        mTweenType.RemoveAtSwap(pDenseIndex, 1, false);
+        mParameterName.RemoveAtSwap(pDenseIndex, 1, false);
+
+        mFrom.RemoveAtSwap(pDenseIndex, 1, false);
+        mTo.RemoveAtSwap(pDenseIndex, 1, false);
+        mBaseOffset.RemoveAtSwap(pDenseIndex, 1, false);
+        mCurrentValue.RemoveAtSwap(pDenseIndex, 1, false);
+    }
+
+    /** Removes every Tween marked as PendingDeletion */
+    int32 RemovePendingDeletion()
+    {
+        int32 removed = 0;
+
+        for(int32 i = mFlags.Num() - 1; i >= 0; --i)
+        {
+            if(EnumHasAnyFlags(mFlags[i], ETweenStoreFlags::PendingDeletion))
+            {
+                RemoveAt(i);
+                removed++;
+            }
+        }
+
+        return removed;
+    }
+
+    /** Removes all Tweens. Every handle given out so far goes stale */
+    void Reset()
+    {
+        for(int32 i = mDenseToSlot.Num() - 1; i >= 0; --i)
+        {
+            RemoveAt(i);
+        }
+    }
+
+    int32 Num() const
+    {
+        return mDenseToSlot.Num();
+    }
+
+    ETweenStoreLane GetLane() const
+    {
+        return mLane;
+    }
+
+public:
+
+    /*
+     **************************************************************************
+     * Columns (one entry per stored Tween, all indexed by the dense index)
+     **************************************************************************
+     */
+
+    /** Delay still left before the Tween starts. Like UBaseTween, it runs on the unscaled delta time */
+    TArray<float> mDelayLeft;
+
+    /** Elapsed time of the current loop */
+    TArray<float> mElapsedTime;
+    TArray<float> mDuration;
+    TArray<float> mTimeScale;
+
+    /** Loops still left to run, the current one included (<= 0 if infinite) */
+    TArray<int32> mLoopsLeft;
+    TArray<ETweenLoopType> mLoopType;
+    TArray<ETweenEaseType> mEaseType;
+    TArray<ETweenStoreFlags> mFlags;
+
+    TArray<TWeakObjectPtr<UObject>> mTarget;
+    TArray<ETweenTargetType> mTargetType;
+    TArray<TTweenType> mTweenType;
+
+    /** Material parameter name; only meaningful for material Tweens */
+    TArray<FName> mParameterName;
+
+    TArray<TValue> mFrom;
+    TArray<TValue> mTo;
+
+    /** Offset used for relative Tweens (i.e. MoveBy, ScaleBy) */
+    TArray<TValue> mBaseOffset;
+    TArray<TValue> mCurrentValue;
+
+private:
+    /** The lane handed out in the handles */
+    ETweenStoreLane mLane;
+
+    /** Slot owning each dense index */
+    TArray<int32> mDenseToSlot;
+
+    /** Dense index of each slot (INDEX_NONE if the slot is free) */
+    TArray<int32> mSlotToDense;
+
+    /** Current generation of each slot */
+    TArray<uint32> mSlotGeneration;
+
+    /** Slots released and ready to be reused */
+    TArray<int32> mFreeSlots;
+};
+
+
+typedef TTweenLane<FVector, ETweenVectorType> FTweenVectorLane;
+typedef TTweenLane<FVector2D, ETweenVector2DType> FTweenVector2DLane;
+typedef TTweenLane<FRotator, ETweenRotatorType> FTweenRotatorLane;
+typedef TTweenLane<FLinearColor, ETweenLinearColorType> FTweenLinearColorLane;
+typedef TTweenLane<float, ETweenFloatType> FTweenFloatLane;
+
+
+/**
+ * @brief Buffers used by FTweenStore::Update to ease the Tweens of a lane in batches, one per ease type.
+ *        They're kept between frames so that batching doesn't allocate once the store has warmed up.
+ */
+struct FTweenStoreScratch
+{
+    /** Dense indices of the Tweens updated this frame, in lane order */
+    TArray<int32> ActiveIndices;
+
+    /** Dense indices of the Tweens that still have to be eased (i.e. that didn't reach the end) */
+    TArray<int32> EasingIndices;
+
+    /** EasingIndices sorted by ease type, along with the gathered inputs and outputs of the batches */
+    TArray<int32> SortedIndices;
+    TArray<float> Times;
+    TArray<float> Durations;
+    TArray<float> Alphas;
+
+    void Reset()
+    {
+        ActiveIndices.Reset();
+        EasingIndices.Reset();
+    }
+};
+
+
+/**
+ * The FTweenStore is the data-oriented counterpart of the UTweenContainer: it keeps plain-struct Tweens, one lane per value type,
+ * and updates them without allocating or destroying any UObject.
+ *
+ * Stored Tweens cover the fire-and-forget use cases (move, scale, rotate, widget and material Tweens, single Tween with its own loops);
+ * the "Play" methods of the standard factories (i.e. UTweenVectorStandardFactory::BP_PlayTweenMoveActorTo) add them.
+ * Whatever needs a UBaseTween (delegates, sequences, hit/overlap events) gets it by promoting the stored Tween,
+ * see UTweenManagerComponent::GetTweenObject.
+ */
+class TWEENMAKER_API FTweenStore
+{
+public:
+    FTweenStore();
+
+    /*
+     **************************************************************************
+     * Adding Tweens
+     **************************************************************************
+     */
+
+    FTweenHandle AddVector(UObject *pTarget, ETweenTargetType pTargetType, ETweenVectorType pTweenType,
+                           const FVector &pFrom, const FVector &pTo, const FTweenStoreParams &pParams);
+
+    FTweenHandle AddVector2D(UObject *pTarget, ETweenTargetType pTargetType, ETweenVector2DType pTweenType,
+                             const FVector2D &pFrom, const FVector2D &pTo, const FTweenStoreParams &pParams);
+
+    FTweenHandle AddRotator(UObject *pTarget, ETweenTargetType pTargetType, ETweenRotatorType pTweenType,
+                            const FRotator &pFrom, const FRotator &pTo, const FTweenStoreParams &pParams);
+
+    FTweenHandle AddLinearColor(UObject *pTarget, FName pParameterName, ETweenLinearColorType pTweenType,
+                                const FLinearColor &pFrom, const FLinearColor &pTo, const FTweenStoreParams &pParams);
+
+    /** RotateAroundPoint and FollowSpline Tweens can't be stored: they need a UTweenFloat */
+    FTweenHandle AddFloat(UObject *pTarget, ETweenTargetType pTargetType, ETweenFloatType pTweenType,
+                          float pFrom, float pTo, const FTweenStoreParams &pParams, FName pParameterName = NAME_None);
+
+    /*
+     **************************************************************************
+     * Handle methods
+     **************************************************************************
+     */
+
+    /** Returns true if the Tween referred by the handle is still in the store */
+    bool IsAlive(const FTweenHandle &pHandle) const;
+
+    /** Removes the Tween referred by the handle; returns true if it was alive */
+    bool Remove(const FTweenHandle &pHandle);
+
+    /** Pauses or resumes the Tween referred by the handle; returns true if it was alive */
+    bool SetPaused(const FTweenHandle &pHandle, bool pPaused);
+
+    /** Removes every Tween of the given generic type that targets the given object; returns the number of Tweens removed */
+    int32 RemoveByObject(const UObject *pTarget, ETweenGenericType pTweensType);
+
+    /** Returns true if there is a running Tween of the given generic type targeting the given object */
+    bool IsObjectTweening(const UObject *pTarget, ETweenGenericType pTweensType, FTweenHandle &pOutHandle) const;
+
+    /**
+     * @brief Take copies the Tween referred by the handle out of the store and removes it.
+     *
+     * @return False if the Tween is not alive or it doesn't live in the lane matching the output type.
+     */
+    bool Take(const FTweenHandle &pHandle, FTweenVectorLane::FStoredTween &pOutTween);
+    bool Take(const FTweenHandle &pHandle, FTweenVector2DLane::FStoredTween &pOutTween);
+    bool Take(const FTweenHandle &pHandle, FTweenRotatorLane::FStoredTween &pOutTween);
+    bool Take(const FTweenHandle &pHandle, FTweenLinearColorLane::FStoredTween &pOutTween);
+    bool Take(const FTweenHandle &pHandle, FTweenFloatLane::FStoredTween &pOutTween);
+
+    /** Direct access to the lanes, i.e. to read the current values or to copy a Tween out of the store */
+    const FTweenVectorLane& GetVectorLane() const { return mVectorTweens; }
+    const FTweenVector2DLane& GetVector2DLane() const { return mVector2DTweens; }
+    const FTweenRotatorLane& GetRotatorLane() const { return mRotatorTweens; }
+    const FTweenLinearColorLane& GetLinearColorLane() const { return mLinearColorTweens; }
+    const FTweenFloatLane& GetFloatLane() const { return mFloatTweens; }
+
+    /*
+     **************************************************************************
+     * Update
+     **************************************************************************
+     */
+
+    /**
+     * @brief Update advances every stored Tween and applies the new values to their targets.
+     *        The easing of each lane is computed in batches, one per ease type (see EaseEquations::ComputeEasingAlphaBatch).
+     *        Time, easing and loops are computed on the worker threads for large lanes ("TweenMaker.ParallelUpdate"),
+     *        then the values are applied on the game thread.
+     *        Tweens ending (or whose target died) are removed at the end of the update.
+     *
+     * @param pDeltaTime Time since the last frame.
+     * @param pIsGamePaused True if the game is paused: only Tweens set to tween while paused will be updated.
+     */
+    void Update(float pDeltaTime, bool pIsGamePaused);
+
+    /** Removes all stored Tweens */
+    void Reset();
+
+    /** Total number of stored Tweens, across all lanes */
+    int32 Num() const;
+
+private:
+    /** Calls the given functor with the lane matching the given type, returning what the functor returns (or the default value if the lane is unknown) */
+    template<typename TResult, typename TFunctor>
+    TResult VisitLane(ETweenStoreLane pLane, TResult pDefault, TFunctor &&pFunctor);
+
+    template<typename TResult, typename TFunctor>
+    TResult VisitLane(ETweenStoreLane pLane, TResult pDefault, TFunctor &&pFunctor) const;
+
+    FTweenVectorLane mVectorTweens;
+    FTweenVector2DLane mVector2DTweens;
+    FTweenRotatorLane mRotatorTweens;
+    FTweenLinearColorLane mLinearColorTweens;
+    FTweenFloatLane mFloatTweens;
+
+    /** Buffers shared by the lanes while updating */
+    FTweenStoreScratch mScratch;
+
+    /** True while the lanes are being updated: removals are deferred to the end of the update, since dense indices can't move during it */
+    bool bIsUpdating;
+};
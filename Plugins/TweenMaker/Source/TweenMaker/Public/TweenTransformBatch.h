@@ -0,0 +1,110 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UObject;
+class USceneComponent;
+
+/** Space a batched transform write is expressed in */
+enum class ETweenTransformSpace : uint8
+{
+    World,
+    Relative
+};
+
+
+/**
+ * @brief The FTweenTransformBatch class collects the location, rotation and scale written by the Tweens during an update,
+ *        and applies them once per SceneComponent when the update is over.
+ *
+ *        Every SetActorLocation/SetWorldScale3D/... call updates the component transform, its children, the overlaps and the
+ *        render state; when many Tweens move the same target (e.g. a move, a rotation and a scale together) that work is done
+ *        once per Tween. With the batch open, the writes only store the last value per target, and Close applies all of
+ *        them inside a FScopedMovementUpdate, so the transform is propagated once.
+ *
+ *        Actor targets are batched on their root component. Writes done while no batch is open are applied right away.
+ *        Only the game thread writes into the batch.
+ */
+class TWEENMAKER_API FTweenTransformBatch
+{
+public:
+    /**
+     * @brief Open makes this the batch the Tweens write into, until Close is called. Batches can't be nested.
+     */
+    void Open();
+
+    /**
+     * @brief Close stops collecting the writes and applies all of them.
+     */
+    void Close();
+
+    /** Drops all pending writes without applying them */
+    void Reset();
+
+    /*
+     **************************************************************************
+     * Methods used by the Tweens. If no batch is open, the value is applied right away
+     **************************************************************************
+     */
+
+    /**
+     * @brief SetLocation sets the location of the given component.
+     *
+     * @param pSweep whether the component should sweep to the new location. Only wanted if hit/overlap delegates are bound,
+     *        since the sweep is the most expensive part of the move.
+     */
+    static void SetLocation(USceneComponent *pComponent, const FVector &pLocation, ETweenTransformSpace pSpace, bool pSweep);
+
+    static void SetRotation(USceneComponent *pComponent, const FRotator &pRotation, ETweenTransformSpace pSpace);
+
+    static void SetScale(USceneComponent *pComponent, const FVector &pScale, ETweenTransformSpace pSpace);
+
+    /**
+     * @brief FlushPending applies the pending writes of the given target (an Actor or a SceneComponent), if any.
+     *        Called before reading the transform of the target, e.g. when a Tween starts.
+     */
+    static void FlushPending(UObject *pTarget);
+
+    /** Returns the SceneComponent the transform writes for the given target go to (the root component for Actors) */
+    static USceneComponent* GetTargetComponent(UObject *pTarget);
+
+private:
+    /** The last values written for a component during the update */
+    struct FPendingTransform
+    {
+        TWeakObjectPtr<USceneComponent> Component;
+
+        FVector Location;
+        FRotator Rotation;
+        FVector Scale;
+
+        ETweenTransformSpace LocationSpace = ETweenTransformSpace::World;
+        ETweenTransformSpace RotationSpace = ETweenTransformSpace::World;
+        ETweenTransformSpace ScaleSpace = ETweenTransformSpace::World;
+
+        bool bHasLocation = false;
+        bool bHasRotation = false;
+        bool bHasScale = false;
+
+        /** Set if any of the location writes wanted a sweep */
+        bool bSweep = false;
+    };
+
+    /** Returns the pending entry of the given component, adding it if needed */
+    FPendingTransform& FindOrAdd(USceneComponent *pComponent);
+
+    /** Applies the writes of an entry. Returns true if the component was still there */
+    static bool Apply(FPendingTransform &pPending);
+
+    /** Pending entries, in the order their components were first written */
+    TArray<FPendingTransform> mPending;
+
+    /** Index in mPending of each component */
+    TMap<USceneComponent*, int32> mPendingIndices;
+
+    /** The batch currently open, if any */
+    static FTweenTransformBatch *ActiveBatch;
+};
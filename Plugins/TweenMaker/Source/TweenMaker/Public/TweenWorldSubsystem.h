@@ -0,0 +1,120 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TweenTransformBatch.h"
+#include "TweenEasingBatch.h"
+#include "TweenWorldSubsystem.generated.h"
+
+class UTweenManagerComponent;
+class UTweenWorldSubsystem;
+
+
+/**
+ * @brief The single tick function of a UTweenWorldSubsystem. It simply forwards the tick to the subsystem.
+ */
+USTRUCT()
+struct FTweenWorldSubsystemTickFunction : public FTickFunction
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** The subsystem to tick */
+    UTweenWorldSubsystem *Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+    virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTweenWorldSubsystemTickFunction> : public TStructOpsTypeTraitsBase2<FTweenWorldSubsystemTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+
+/**
+ * The UTweenWorldSubsystem is the scheduler of all the TweenManagers of a world.
+ *
+ * The UTweenManagerComponents don't tick on their own: when they begin play they register here, and a single tick function
+ * updates all of them, one after the other, in the chosen tick group. This way having hundreds of Actors that tween costs
+ * a single tick function instead of one per Actor, and the game pause is checked only once per frame.
+ *
+ * The Tweens that don't need their value right away are eased together at the end of the update (see FTweenEasingBatch),
+ * and the transforms written by the Tweens are collected in a FTweenTransformBatch and applied once per target
+ * after all TweenManagers are updated.
+ */
+UCLASS()
+class TWEENMAKER_API UTweenWorldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    virtual void Deinitialize() override;
+
+    /**
+     * Sets the tick group in which all Tweens of this world are updated. By default they are updated during physics,
+     * as the UTweenManagerComponents did when they were ticking on their own.
+     *
+     * @param TickGroup The tick group to use. It takes effect from the next frame.
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Set Tween Tick Group", KeyWords="Set Tween Tick Group Scheduler"), Category = "Tween|Utils")
+    void SetTickGroup(TEnumAsByte<ETickingGroup> TickGroup);
+
+    /** Returns the tick group in which all Tweens of this world are updated */
+    UFUNCTION(BlueprintPure, meta = (DisplayName="Get Tween Tick Group", KeyWords="Get Tween Tick Group Scheduler"), Category = "Tween|Utils")
+    TEnumAsByte<ETickingGroup> GetTickGroup() const;
+
+    /*
+     **************************************************************************
+     * Methods used internally but also from the "friend" classes
+     **************************************************************************
+     */
+
+    /**
+     * @brief Adds a TweenManager to the ones updated every frame. The tick function is registered the first time this is called.
+     */
+    void RegisterTweenManager(UTweenManagerComponent *pTweenManager);
+
+    /**
+     * @brief Removes a TweenManager from the ones updated every frame. Safe to call while the TweenManagers are being updated.
+     */
+    void UnregisterTweenManager(UTweenManagerComponent *pTweenManager);
+
+    /**
+     * @brief Tick updates all registered TweenManagers. Called by the tick function.
+     */
+    void Tick(float pDeltaTime);
+
+    /**
+     * @brief Retrieves the subsystem of the world the given Object lives in.
+     *
+     * @return The subsystem, or nullptr if the Object has no world.
+     */
+    static UTweenWorldSubsystem* Get(const UObject *pWorldContextObject);
+
+private:
+    /** TweenManagers updated every frame. Entries unregistered during the update are nulled and compacted afterwards */
+    UPROPERTY()
+    TArray<UTweenManagerComponent*> mTweenManagers;
+
+    /** The single tick function updating all TweenManagers */
+    FTweenWorldSubsystemTickFunction mTickFunction;
+
+    /** Collects the transform writes of the Tweens while the TweenManagers are being updated */
+    FTweenTransformBatch mTransformBatch;
+
+    /** Collects the Tweens whose easing is deferred while the TweenManagers are being updated */
+    FTweenEasingBatch mEasingBatch;
+
+    /** True while the TweenManagers are being updated */
+    bool bIsTicking = false;
+};
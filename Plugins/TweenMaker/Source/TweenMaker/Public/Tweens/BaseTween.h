@@ -6,6 +6,7 @@
 #include "UObject/NoExportTypes.h"
 #include "Utils/TweenEnums.h"
 #include "Utils/Utility.h"
+#include "TweenReferenceTable.h"
 #include "BaseTween.generated.h"
 
 class UMaterialInsstanceDynamic;
@@ -218,6 +219,17 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (KeyWords = "Tween Custom Easing"), Category = "Tween|Utils")
 	void SetCustomEasisng(UCurveFloat *Curve);
 
+    /**
+     * Limits how often the 'On Tween Update' event is fired, for Tweens whose listeners don't need every single update.
+     * The event is always fired on the first and on the last update of the Tween.
+     *
+     * @param FrameInterval The event is fired at most once every FrameInterval updates (1 fires it at every update).
+     * @param MinProgressChange The event is only fired once the Tween has progressed by at least this fraction [0, 1] of its
+     *        duration since the last time it was fired (0 doesn't check the progress).
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords = "Tween Update Event Throttle Rate"), Category = "Tween|Utils")
+    void SetUpdateEventRate(int32 FrameInterval = 1, float MinProgressChange = 0.0f);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -230,10 +242,34 @@ public:
      *
      * @param pDeltaTime The time passed from the last frame
      * @param pTimeScale The time scale to apply to the Tween when computing the current time
+     * @param pCanDeferEasing If true and a FTweenEasingBatch is open, the value may be eased and applied when the batch
+     *        is closed, along with the other Tweens using the same ease type. Only wanted when nothing reads the value
+     *        right after the update.
      *
      * @return True if the Tween is done, false otherwise.
      */
-    bool UpdateTween(float pDeltaTime, float pTimeScale);
+    bool UpdateTween(float pDeltaTime, float pTimeScale, bool pCanDeferEasing = false);
+
+    /**
+     * @brief Methods used by the FTweenEasingBatch to finish the update of a Tween whose easing was deferred by UpdateTween.
+     *
+     *        CanFinishDeferredUpdate returns false if the Tween changed since it was deferred (deleted, restarted, its target
+     *        destroyed...), i.e. if pElapsedTime isn't its elapsed time anymore. ComputeDeferredValue computes the value
+     *        from the eased progress and only touches the Tween itself, so it can run on any thread while the game thread waits;
+     *        ApplyDeferredValue writes it into the target, on the game thread.
+     */
+    bool CanFinishDeferredUpdate(float pElapsedTime) const;
+    void ComputeDeferredValue(float pAlpha);
+    void ApplyDeferredValue();
+
+    /**
+     * @brief GetOvershootTime returns how much of the last update went past the end of the Tween, in the time of the update
+     *        (i.e. before applying the time scales). Only meaningful right after the update that ended the Tween.
+     */
+    float GetOvershootTime() const
+    {
+        return mOvershootTime;
+    }
 
     /**
      * @brief InitBase is in charge of initializing the Tween's parameters.
@@ -242,6 +278,14 @@ public:
                   ETweenEaseType pEaseType, float pDuration, float pDelay, float pTimeScale, bool pTweenWhileGameIsPaused, int32 pNumLoops = 1,
                   ETweenLoopType pLoopType = ETweenLoopType::Yoyo);
 
+    /**
+     * @brief RestoreProgress is used when a Tween stored in a FTweenStore is promoted to a UBaseTween after it already started:
+     *        the Tween picks up from the given elapsed time, without preparing itself (nor firing the start event) again.
+     *
+     * @param pElapsedTime The elapsed time of the current loop.
+     */
+    void RestoreProgress(float pElapsedTime);
+
 
     /**
      * @brief ShouldInvertTween it's called if the Tween is created with a timescale < 0, thus it needs to be
@@ -393,16 +437,29 @@ public:
 protected:
 
     /**
-     * @brief Update updates the tween state.
-     *
-     * @param pDeltaTime The time passed from the last frame
-     * @param pTimeScale The time scale to apply to the Tween when computing the current time
+     * @brief ComputeEasingAlpha returns the eased progress of the Tween at its current elapsed time, using either the
+     *        custom curve or the ease type.
+     */
+    float ComputeEasingAlpha() const;
+
+    /**
+     * @brief ComputeValue computes the current value of the Tween from its eased progress. It must not touch the
+     *        tween target, that is done by ApplyValue.
      *
-     * @return True if the Tween is done, false otherwise.
+     * @param pAlpha The eased progress of the Tween (0 at the beginning, 1 at the end; some ease types overshoot)
+     * @param pHasEnded True if the Tween reached its end, in which case the value is the ending one
      */
-    virtual bool Update(float pDeltaTime, float pTimeScale)
+    virtual void ComputeValue(float pAlpha, bool pHasEnded)
     {
-        return false;
+
+    }
+
+    /**
+     * @brief ApplyValue writes the current value of the Tween into its target.
+     */
+    virtual void ApplyValue()
+    {
+
     }
 
     /**
@@ -429,6 +486,15 @@ protected:
 
     }
 
+    /**
+     * @brief IsOnTweenUpdateBound returns true if anything listens to the update event of the Tween. If nothing does,
+     *        BroadcastOnTweenUpdate is not called at all.
+     */
+    virtual bool IsOnTweenUpdateBound() const
+    {
+        return false;
+    }
+
     virtual void OnTweenPausedInternal()
     {
 
@@ -2028,6 +2094,9 @@ protected:
     /** Elapsed time (in seconds) */
     float mElapsedTime;
 
+    /** Part of the last update that went past the end of the Tween, in the time of the update (i.e. before the time scales) */
+    float mOvershootTime;
+
     /** Tween target object */
     TWeakObjectPtr<UObject> mTargetObject;
 
@@ -2065,6 +2134,14 @@ private:
      */
     void PreDestroy();
 
+    /**
+     * @brief ShouldBroadcastOnTweenUpdate checks if the update event has to be fired for the current update, given the
+     *        listeners and the rate set with SetUpdateEventRate.
+     *
+     * @param pHasEnded True if this is the last update of the Tween.
+     */
+    bool ShouldBroadcastOnTweenUpdate(bool pHasEnded);
+
     /** Reference to the TweenContainer that owns this Tween */
     UPROPERTY()
     UTweenContainer *mOwningTweenContainer;
@@ -2072,6 +2149,21 @@ private:
     /** The generic type this Tween belongs to */
     ETweenGenericType mTweenGenericType;
 
+    /** Entry of this Tween in the reference table of the TweenManagerComponent that created it */
+    FTweenReference mTweenReference;
+
+    /** The update event is fired at most once every mUpdateEventFrameInterval updates */
+    int32 mUpdateEventFrameInterval;
+
+    /** Minimum progress [0, 1] of the Tween between two update events */
+    float mUpdateEventMinProgressChange;
+
+    /** Updates since the update event was last fired */
+    int32 mUpdatesSinceUpdateEvent;
+
+    /** Progress of the Tween when the update event was last fired (< 0 if it never was) */
+    float mProgressAtUpdateEvent;
+
     /** Index of the sequence this Tween belongs to (among the sequences in its owning TweenContainer) */
     int32 mTweenSequenceIndex;
 
@@ -36,10 +36,22 @@ struct FParallelTween
      *
      * @param pDeltaTime Time since the last frame.
      * @param pTimeScale The timescale to apply to the Tweens when computing the elapsed time.
+     * @param pOutUpdatedTweens If not null, the Tweens that were updated are added to it.
+     * @param pCanDeferEasing If true, the Tweens may be eased at the end of the frame (see UBaseTween::UpdateTween).
+     *        Ignored if pOutUpdatedTweens is given, since whoever reads it expects the values to be already there.
      *
      * @return True if ALL Tweens are done, false otherwise.
      */
-    bool UpdateParallelTweens(float pDeltaTime, float pTimeScale);
+    bool UpdateParallelTweens(float pDeltaTime, float pTimeScale, TArray<UBaseTween*> *pOutUpdatedTweens = nullptr, bool pCanDeferEasing = false);
+
+    /**
+     * @brief GetLeftoverTime returns the part of the last update that went past the end of the parallel Tweens, i.e. the time
+     *        the next sequence (or the next loop) should be updated with. It's 0 if the Tweens didn't end in the last update.
+     */
+    float GetLeftoverTime() const
+    {
+        return mLeftoverTime;
+    }
 
     /**
      * @brief Restart is called when the parallel Tweens are done and they need to loop.
@@ -95,4 +107,7 @@ private:
 
     /** Internal helper variable, used to check if since the start of the update new tweens were added (because maybe on the parllale tweens callback triggered a new tween) */
     int32 mTweensNumAtUpdate;
+
+    /** Part of the last update left after the parallel Tweens ended (see GetLeftoverTime) */
+    float mLeftoverTime;
 };
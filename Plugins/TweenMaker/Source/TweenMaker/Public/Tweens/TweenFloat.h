@@ -59,6 +59,9 @@ public:
     void InitFollowSpline(USplineComponent *pSpline, bool pApplyRotation, bool pApplyScale, ETweenFloatType pTweenType,
                           bool pDeleteTweenOnHit, bool pDeleteTweenOnOverlap, bool pUseConstantSpeed, UTweenFloatLatentFactory *pTweenLatentProxy);
 
+    /** Restores the values computed by a FTweenStore for a Tween being promoted, see UBaseTween::RestoreProgress */
+    void RestoreStoredValues(float pFrom, float pTo, float pBaseOffset);
+
 
     ETweenFloatType GetTweenType()
     {
@@ -180,7 +183,8 @@ public:
 
 protected:
     // Begin of UBaseTween interface
-    virtual bool Update(float pDeltaTime, float pTimeScale) override;
+    virtual void ComputeValue(float pAlpha, bool pHasEnded) override;
+    virtual void ApplyValue() override;
     virtual void Restart(bool pRestartFromEnd) override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
@@ -189,6 +193,7 @@ protected:
     virtual void BroadcastOnTweenStart() override;
     virtual void BroadcastOnTweenUpdate() override;
     virtual void BroadcastOnTweenEnd() override;
+    virtual bool IsOnTweenUpdateBound() const override;
     virtual void OnTweenPausedInternal() override;
     virtual void OnTweenResumedInternal() override;
     virtual void OnTweenDeletedInternal() override;
@@ -243,7 +248,8 @@ private:
 
 private:
 
-    void CheckSplinePointReached(const FVector& WorldPosition);
+    /** Fires the "spline point reached" delegates if the given input key of the spline went past the next point */
+    void CheckSplinePointReached(float pInputKey);
 
     /*
      **************************************************************************
@@ -48,6 +48,9 @@ public:
     void Init(const FName &pParameterName, const FLinearColor &pFrom, const FLinearColor &pTo,
               ETweenLinearColorType pTweenType, UTweenLinearColorLatentFactory *pTweenLatentProxy);
 
+    /** Restores the values computed by a FTweenStore for a Tween being promoted, see UBaseTween::RestoreProgress */
+    void RestoreStoredValues(const FLinearColor &pFrom, const FLinearColor &pTo, const FLinearColor &pBaseOffset);
+
     ETweenLinearColorType GetTweenType()
     {
         return mTweenType;
@@ -90,7 +93,8 @@ public:
 
 protected:
     // Begin of UBaseTween interface
-    virtual bool Update(float pDeltaTime, float pTimeScale) override;
+    virtual void ComputeValue(float pAlpha, bool pHasEnded) override;
+    virtual void ApplyValue() override;
     virtual void Restart(bool pRestartFromEnd) override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
@@ -98,6 +102,7 @@ protected:
 	virtual void BroadcastOnTweenStart() override;
     virtual void BroadcastOnTweenUpdate() override;
     virtual void BroadcastOnTweenEnd() override;
+    virtual bool IsOnTweenUpdateBound() const override;
     virtual void OnTweenPausedInternal() override;
     virtual void OnTweenResumedInternal() override;
     virtual void OnTweenDeletedInternal() override;
@@ -46,6 +46,9 @@ public:
 
     void Init(const FVector &pFrom, const FVector &pTo, ETweenVectorType pTweenType, bool pDeleteTweenOnHit, bool pDeleteTweenOnOverlap, UTweenVectorLatentFactory *pTweenLatentProxy);
 
+    /** Restores the values computed by a FTweenStore for a Tween being promoted, see UBaseTween::RestoreProgress */
+    void RestoreStoredValues(const FVector &pFrom, const FVector &pTo, const FVector &pBaseOffset);
+
 
     ETweenVectorType GetTweenType()
     {
@@ -150,7 +153,8 @@ public:
 
 protected:
     // Begin of UBaseTween interface
-    virtual bool Update(float pDeltaTime, float pTimeScale) override;
+    virtual void ComputeValue(float pAlpha, bool pHasEnded) override;
+    virtual void ApplyValue() override;
     virtual void Restart(bool pRestartFromEnd) override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
@@ -159,6 +163,7 @@ protected:
     virtual void BroadcastOnTweenStart() override;
     virtual void BroadcastOnTweenUpdate() override;
     virtual void BroadcastOnTweenEnd() override;
+    virtual bool IsOnTweenUpdateBound() const override;
     virtual void OnTweenPausedInternal() override;
     virtual void OnTweenResumedInternal() override;
     virtual void OnTweenDeletedInternal() override;
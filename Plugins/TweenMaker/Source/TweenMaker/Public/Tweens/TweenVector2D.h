@@ -48,6 +48,9 @@ public:
 
     void Init(const FVector2D &pFrom, const FVector2D &pTo, ETweenVector2DType pTweenType, UTweenVector2DLatentFactory *pTweenLatentProxy);
 
+    /** Restores the values computed by a FTweenStore for a Tween being promoted, see UBaseTween::RestoreProgress */
+    void RestoreStoredValues(const FVector2D &pFrom, const FVector2D &pTo, const FVector2D &pBaseOffset);
+
 
     ETweenVector2DType GetTweenType()
     {
@@ -93,7 +96,8 @@ public:
 
 protected:
     // Begin of UBaseTween interface
-    virtual bool Update(float pDeltaTime, float pTimeScale) override;
+    virtual void ComputeValue(float pAlpha, bool pHasEnded) override;
+    virtual void ApplyValue() override;
     virtual void Restart(bool pRestartFromEnd) override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
@@ -101,6 +105,7 @@ protected:
 	virtual void BroadcastOnTweenStart() override;
     virtual void BroadcastOnTweenUpdate() override;
     virtual void BroadcastOnTweenEnd() override;
+    virtual bool IsOnTweenUpdateBound() const override;
     virtual void OnTweenPausedInternal() override;
     virtual void OnTweenResumedInternal() override;
     virtual void OnTweenDeletedInternal() override;
@@ -33,6 +33,7 @@ public:
 
 	/**
 	 * @brief ComputeCustomFloatEasing used the given CurveFloat to compute the easing for the given values.
+	 *        The curve is baked into a lookup table the first time it's used (see FEaseLookupTables).
 	 *
 	 * @param mCurveFloat the curve to be used for the computation
 	 * @param pCurrentTime the current time in which we have to compute the value
@@ -84,8 +85,51 @@ public:
 	static void ComputeCustomVector2DEasing(UCurveFloat *pCurveFloat, float pCurrentTime, const FVector2D &pStartingValue,
 									        const FVector2D &pEndingValue, float pDuration, FVector2D &OutNewValue);
 
+    /**
+     * @brief ComputeEasingAlphaBatch applies the same ease equation to many Tweens at once. For each Tween it computes the eased
+     *        progress, i.e. 0 at the beginning and 1 at the end (Back and Elastic equations go past those bounds),
+     *        so that the value of the Tween is Start + (End - Start) * Alpha.
+     *
+     *        Linear, polynomial (Quad to Quint) and Back equations are evaluated four Tweens at a time with vector registers
+     *        (SSE or NEON, depending on the platform). The others use the scalar equations, but the switch is done once for the whole batch.
+     *
+     * @param pEaseType the type of easing equation to apply to all Tweens
+     * @param pNum number of Tweens in the batch
+     * @param pCurrentTimes the current time of each Tween
+     * @param pDurations the total duration of each Tween
+     * @param OutAlphas (output) will contain the eased progress of each Tween. Must have room for pNum values
+     */
+    static void ComputeEasingAlphaBatch(ETweenEaseType pEaseType, int32 pNum, const float *pCurrentTimes, const float *pDurations, float *OutAlphas);
+
+    /**
+     * @brief ComputeFloatEasingBatch is the same as "ComputeFloatEasing", except that it applies the equation to many Tweens at once.
+     *        See "ComputeEasingAlphaBatch".
+     *
+     * @param pEaseType the type of easing equation to apply to all Tweens
+     * @param pNum number of Tweens in the batch
+     * @param pCurrentTimes the current time of each Tween
+     * @param pDurations the total duration of each Tween
+     * @param pStartingValues the starting value of each Tween
+     * @param pEndingValues the desired ending value of each Tween
+     * @param OutValues (output) will contain the computed value of each Tween. Must have room for pNum values
+     */
+    static void ComputeFloatEasingBatch(ETweenEaseType pEaseType, int32 pNum, const float *pCurrentTimes, const float *pDurations,
+                                        const float *pStartingValues, const float *pEndingValues, float *OutValues);
+
+    /** Signature shared by all the ease equations */
+    typedef float (*FEaseFunction)(float t, float b, float c, float d);
+
+    /**
+     * @brief GetEaseFunction returns the scalar ease equation of the given type, i.e. to call it many times without going through the switch.
+     *        The equation is always computed, even when the ease type is baked (see FEaseLookupTables).
+     */
+    static FEaseFunction GetEaseFunction(ETweenEaseType pEaseType);
+
 private:
 
+    /** Returns the eased progress of the given curve, read from its baked table */
+    static float ComputeCustomEasingAlpha(UCurveFloat *pCurveFloat, float pCurrentTime, float pDuration);
+
     /**
      * Easing equation float for a simple linear tweening, with no easing.
      *
@@ -0,0 +1,141 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Utils/TweenEnums.h"
+
+class UCurveFloat;
+
+
+/**
+ * @brief The FEaseLookupTable class keeps an easing function baked into evenly spaced samples over the normalized time [0, 1].
+ *        Evaluating it is a single lerp between the two closest samples.
+ *
+ *        The table starts with a low resolution and doubles it until the error measured between the samples is within the
+ *        requested bound (or the maximum resolution is reached). The error is measured inside every step and at the given
+ *        key times (where a curve may have a corner between two samples), then raised by a safety margin, since those
+ *        checks can still miss the exact peak of the error inside a step.
+ */
+class TWEENMAKER_API FEaseLookupTable
+{
+public:
+    /** Resolution the baking starts from */
+    static const int32 MinResolution = 64;
+
+    /** Resolution the baking stops at, even if the error bound is not met */
+    static const int32 MaxResolution = 8192;
+
+    /** Factor applied to the measured error before comparing it with the bound */
+    static const float ErrorMargin;
+
+    FEaseLookupTable();
+
+    /**
+     * @brief Bake samples the given function over [0, 1].
+     *
+     * @param pFunction the easing function, taking the normalized time and returning the eased progress
+     * @param pMaxError the maximum error allowed between the table and the function
+     * @param pKeyTimes normalized times where the function may have a corner (i.e. the keys of a curve)
+     */
+    void Bake(TFunctionRef<float(float)> pFunction, float pMaxError, TArrayView<const float> pKeyTimes = TArrayView<const float>());
+
+    /**
+     * @brief Evaluate returns the eased progress at the given normalized time, which is clamped to [0, 1].
+     */
+    FORCEINLINE float Evaluate(float pNormalizedTime) const
+    {
+        const float position = FMath::Clamp(pNormalizedTime, 0.0f, 1.0f) * mLastIndex;
+        const int32 index = FMath::Min((int32)position, mLastIndex - 1);
+
+        return FMath::Lerp(mSamples[index], mSamples[index + 1], position - index);
+    }
+
+    bool IsBaked() const { return mSamples.Num() > 1; }
+
+    /** Number of samples in the table */
+    int32 GetResolution() const { return mSamples.Num(); }
+
+    /** Largest error measured while baking, with the safety margin */
+    float GetMeasuredError() const { return mMeasuredError; }
+
+    /** Error bound the table was baked with */
+    float GetMaxError() const { return mMaxError; }
+
+private:
+    TArray<float> mSamples;
+
+    /** mSamples.Num() - 1, cached since it's used by every evaluation */
+    int32 mLastIndex;
+
+    float mMeasuredError;
+
+    float mMaxError;
+};
+
+
+/**
+ * @brief The FEaseLookupTables class owns the tables shared by all Tweens: one per custom UCurveFloat in use and, if enabled,
+ *        one per Elastic, Bounce and Back ease type.
+ *
+ *        Curve tables are baked the first time a curve is used and baked again after the curve asset changes
+ *        (in the editor this is detected automatically; at runtime, call InvalidateCurve after changing the keys of a curve).
+ *        The error bound and the use of tables for the built-in equations are set with the "TweenMaker.Ease.LUT*" console variables.
+ *
+ *        Tables are only baked and invalidated on the game thread.
+ */
+class TWEENMAKER_API FEaseLookupTables
+{
+public:
+    /** Registers the callbacks invalidating the tables when an asset changes. Called when the module starts */
+    static void Initialize();
+
+    /** Unregisters the callbacks and frees all tables. Called when the module shuts down */
+    static void Shutdown();
+
+    /**
+     * @brief EvaluateCurve returns the eased progress of the given curve at the given normalized time,
+     *        with the curve time range mapped to [0, 1]. The table of the curve is baked if needed.
+     */
+    static float EvaluateCurve(UCurveFloat *pCurveFloat, float pNormalizedTime);
+
+    /** Returns the table of the given curve, baking it if needed */
+    static const FEaseLookupTable& FindOrBakeCurve(UCurveFloat *pCurveFloat);
+
+    /** Drops the table of the given curve, so that it's baked again the next time it's used */
+    static void InvalidateCurve(const UCurveFloat *pCurveFloat);
+
+    /** Drops all tables */
+    static void InvalidateAll();
+
+    /** Returns true if the given ease type can be baked (Elastic, Bounce and Back ease types) */
+    static bool IsBakeableEaseType(ETweenEaseType pEaseType);
+
+    /** Bakes the given bakeable ease type into the given table, with its corners as key times */
+    static void BakeEaseType(FEaseLookupTable &OutTable, ETweenEaseType pEaseType, float pMaxError);
+
+    /** Bakes the given curve into the given table, with its time range mapped to [0, 1] and its keys as key times */
+    static void BakeCurve(FEaseLookupTable &OutTable, const UCurveFloat *pCurveFloat, float pMaxError);
+
+    /**
+     * @brief FindEaseTable returns the table of the given built-in ease type, or null if the ease type is not bakeable
+     *        or if the tables for the built-in equations are disabled.
+     */
+    static const FEaseLookupTable* FindEaseTable(ETweenEaseType pEaseType);
+
+    /** Maximum error allowed in the tables, relative to the [0, 1] span of the eased progress */
+    static float GetMaxError();
+
+private:
+    static void OnObjectChanged(UObject *pObject);
+
+    /** Tables of the curves, keyed by curve */
+    static TMap<TWeakObjectPtr<const UCurveFloat>, FEaseLookupTable> CurveTables;
+
+    /** Tables of the built-in equations, one per ease type (only the bakeable ones are used) */
+    static TArray<FEaseLookupTable> EaseTables;
+
+    static FDelegateHandle OnObjectModifiedHandle;
+    static FDelegateHandle OnObjectPropertyChangedHandle;
+};
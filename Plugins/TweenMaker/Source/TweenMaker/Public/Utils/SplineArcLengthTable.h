@@ -0,0 +1,111 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class USplineComponent;
+
+
+/**
+ * @brief A point of a spline, as read from a FSplineArcLengthTable.
+ */
+struct FSplineTableSample
+{
+    /** Input key of the spline at this point (e.g. 2.5 is halfway between the points 2 and 3) */
+    float InputKey;
+
+    FVector Location;
+
+    FQuat Rotation;
+
+    FVector Scale;
+};
+
+
+/**
+ * @brief The FSplineArcLengthTable class keeps a spline sampled at evenly spaced distances along its length, in the local space
+ *        of the spline. Sampling at a distance is a lerp between the two closest samples, sampling at an input key is
+ *        a binary search on the input keys of the samples plus a lerp.
+ *
+ *        It replaces the spline evaluation of GetLocationAtTime & co., whose constant speed path also goes through
+ *        the reparameterization table of the spline at every call.
+ */
+class TWEENMAKER_API FSplineArcLengthTable
+{
+public:
+    FSplineArcLengthTable();
+
+    /**
+     * @brief Bake samples the given spline.
+     *
+     * @param pSamplesPerSegment number of samples for each segment between two spline points
+     */
+    void Bake(const USplineComponent *pSpline, int32 pSamplesPerSegment);
+
+    /** Returns true if the spline changed since the table was baked */
+    bool IsOutdated(const USplineComponent *pSpline) const;
+
+    /** Returns the local space sample at the given fraction [0, 1] of the spline length */
+    FSplineTableSample SampleAtDistanceRatio(float pDistanceRatio) const;
+
+    /** Returns the local space sample at the given input key */
+    FSplineTableSample SampleAtInputKey(float pInputKey) const;
+
+    bool IsBaked() const { return mInputKeys.Num() > 0; }
+
+    /** Number of samples in the table */
+    int32 GetResolution() const { return mInputKeys.Num(); }
+
+private:
+    friend class FSplineArcLengthTables;
+
+    /** Lerps between the samples at pIndex and pIndex + 1 */
+    FSplineTableSample Lerp(int32 pIndex, float pAlpha) const;
+
+    TArray<float> mInputKeys;
+    TArray<FVector> mLocations;
+    TArray<FQuat> mRotations;
+    TArray<FVector> mScales;
+
+    /** What the spline looked like when it was baked, to find out if it changed */
+    uint32 mSplineVersion;
+    int32 mNumPoints;
+    float mSplineLength;
+    bool bClosedLoop;
+
+    /** Frame the table was last checked against its spline */
+    uint64 mValidatedFrame;
+};
+
+
+/**
+ * @brief The FSplineArcLengthTables class owns the tables of the splines followed by the Tweens, one per spline, shared by all
+ *        Tweens following it.
+ *
+ *        A table is baked the first time its spline is sampled and baked again when the spline changes
+ *        (checked at most once per frame). The number of samples is set with "TweenMaker.Spline.SamplesPerSegment".
+ *        Tables are only used on the game thread.
+ */
+class TWEENMAKER_API FSplineArcLengthTables
+{
+public:
+    /**
+     * @brief SampleAtTime returns what USplineComponent::GetLocationAtTime, GetRotationAtTime and GetScaleAtTime return
+     *        for the given time, with the location and rotation in world space.
+     */
+    static FSplineTableSample SampleAtTime(const USplineComponent *pSpline, float pTime, bool pUseConstantSpeed);
+
+    /** Returns the table of the given spline, baking it if needed */
+    static const FSplineArcLengthTable& FindOrBake(const USplineComponent *pSpline);
+
+    /** Drops the table of the given spline, so that it's baked again the next time it's used */
+    static void Invalidate(const USplineComponent *pSpline);
+
+    /** Drops all tables */
+    static void InvalidateAll();
+
+private:
+    static TMap<TWeakObjectPtr<const USplineComponent>, FSplineArcLengthTable> Tables;
+};
@@ -112,6 +112,13 @@ enum class ETweenFloatType : uint8 {
 };
 
 
+UENUM(BlueprintType)
+enum class ETweenSignificance : uint8 {
+    Full UMETA(ToolTip = "The Tweens are updated every frame."),
+    Reduced UMETA(ToolTip = "The Tweens are updated every few frames, with the time of the frames skipped."),
+    Suspended UMETA(ToolTip = "The Tweens are not updated. The time passed is given to them when they're updated again. Never used for Tweens moving, rotating or scaling their target."),
+};
+
 UENUM()
 enum class ETweenReferenceAxis : uint8 {
     XAxis,
@@ -0,0 +1,43 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * @brief Helpers shared by the parts of the plugin that split their update in a compute phase, run on the worker threads,
+ *        and an apply phase, run on the game thread (the FTweenStore and the FTweenEasingBatch).
+ *
+ *        Whether the compute phase actually goes wide is decided by the "TweenMaker.ParallelUpdate" and
+ *        "TweenMaker.ParallelMinTweens" console variables.
+ */
+namespace TweenParallel
+{
+    /** Number of Tweens handled by each task of the parallel passes */
+    constexpr int32 ChunkSize = 1024;
+
+    /** Returns true if a pass over the given number of Tweens should run on the worker threads. Game thread only. */
+    TWEENMAKER_API bool ShouldRunInParallel(int32 pNum);
+
+    /**
+     * Runs pBody(start, end) over [0, pNum) split in chunks of ChunkSize, on the worker threads if ShouldRunInParallel says so.
+     * The chunks are the same in both cases, so the results are too.
+     */
+    template<typename TBody>
+    void ForEachChunk(int32 pNum, const TBody &pBody)
+    {
+        if(pNum <= 0)
+        {
+            return;
+        }
+
+        const int32 numChunks = FMath::DivideAndRoundUp(pNum, ChunkSize);
+
+        ParallelFor(numChunks, [&pBody, pNum](int32 pChunk)
+        {
+            const int32 start = pChunk * ChunkSize;
+            pBody(start, FMath::Min(start + ChunkSize, pNum));
+        }, !ShouldRunInParallel(pNum));
+    }
+}
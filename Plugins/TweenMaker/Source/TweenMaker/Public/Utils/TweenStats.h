@@ -0,0 +1,11 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stat group of the plugin, shown with "stat TweenMaker". The single stats are declared in the .cpp files using them.
+ */
+DECLARE_STATS_GROUP(TEXT("TweenMaker"), STATGROUP_TweenMaker, STATCAT_Advanced);
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#include "Asset/UIParticleCurveTable.h"
+#include "UIParticlePrivatePCH.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarUIParticleCurveTableResolution(
+	TEXT("UIParticle.CurveTable.Resolution"),
+	64,
+	TEXT("Number of samples of the tables baked from the UIParticle emitter curves. Doubled (up to 4096) until the table is within UIParticle.CurveTable.MaxError.\n")
+	TEXT("Tables are baked when the emitter assets are loaded or edited."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarUIParticleCurveTableMaxError(
+	TEXT("UIParticle.CurveTable.MaxError"),
+	0.001f,
+	TEXT("Largest difference allowed between a curve table and its curve, as a fraction of the value range of the curve.\n")
+	TEXT("Curves that can't be baked within it are evaluated directly."),
+	ECVF_Default);
+
+#define MAX_CURVE_TABLE_RESOLUTION 4096
+
+//Points checked between two samples//
+#define CURVE_TABLE_CHECKS 3
+
+//Off the checked points, the error on a cubic step can be up to 9.4% larger than at them//
+#define CURVE_TABLE_ERROR_MARGIN 1.1f
+
+void FUIParticleCurveTable::Bake(const FRichCurve& Curve, float DefaultValue)
+{
+	Empty();
+	Curve.GetTimeRange(MinTime, MaxTime);
+	HasTimeRange = true;
+
+	if (Curve.GetNumKeys() < 2 || MaxTime <= MinTime)
+	{
+		return;
+	}
+
+	//A step can't be lerped//
+	for (auto It(Curve.GetKeyIterator()); It; ++It)
+	{
+		if (It->InterpMode == RCIM_Constant)
+		{
+			return;
+		}
+	}
+
+	float MaxError = FMath::Max(CVarUIParticleCurveTableMaxError.GetValueOnGameThread(), 0.0f);
+	int32 Resolution = FMath::Clamp(CVarUIParticleCurveTableResolution.GetValueOnGameThread(), 2, MAX_CURVE_TABLE_RESOLUTION);
+
+	float MinValue, MaxValue;
+	Curve.GetValueRange(MinValue, MaxValue);
+	float Tolerance = MaxError * (MaxValue - MinValue) + KINDA_SMALL_NUMBER;
+
+	while (true)
+	{
+		if (Sample(Curve, DefaultValue, Resolution) <= Tolerance)
+		{
+			return;
+		}
+
+		if (Resolution >= MAX_CURVE_TABLE_RESOLUTION)
+		{
+			Values.Empty();
+			return;
+		}
+		Resolution = FMath::Min(Resolution * 2, MAX_CURVE_TABLE_RESOLUTION);
+	}
+}
+
+float FUIParticleCurveTable::Sample(const FRichCurve& Curve, float DefaultValue, int32 Resolution)
+{
+	float Step = (MaxTime - MinTime) / (Resolution - 1);
+	InvStep = 1 / Step;
+
+	Values.SetNumUninitialized(Resolution);
+	for (int32 i = 0; i < Resolution; i++)
+	{
+		Values[i] = Curve.Eval(MinTime + Step * i, DefaultValue);
+	}
+
+	float Error = 0;
+	for (int32 i = 0; i < Resolution - 1; i++)
+	{
+		for (int32 Check = 1; Check <= CURVE_TABLE_CHECKS; Check++)
+		{
+			float Alpha = (float)Check / (CURVE_TABLE_CHECKS + 1);
+			float Expected = Curve.Eval(MinTime + Step * (i + Alpha), DefaultValue);
+			Error = FMath::Max(Error, FMath::Abs(FMath::Lerp(Values[i], Values[i + 1], Alpha) - Expected));
+		}
+	}
+
+	//A key between two samples can be a corner, where the error peaks wherever it is in the step//
+	for (auto It(Curve.GetKeyIterator()); It; ++It)
+	{
+		float Position = (It->Time - MinTime) * InvStep;
+		int32 Index = FMath::Clamp((int32)Position, 0, Resolution - 2);
+		Error = FMath::Max(Error, FMath::Abs(FMath::Lerp(Values[Index], Values[Index + 1], Position - Index) - Curve.Eval(It->Time, DefaultValue)));
+	}
+	return Error * CURVE_TABLE_ERROR_MARGIN;
+}
+
+void FUIParticleCurveTable::Empty()
+{
+	Values.Empty();
+	MinTime = 0;
+	MaxTime = 0;
+	InvStep = 0;
+	HasTimeRange = false;
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#include "Asset/UIParticleCurveTable.h"
+#include "UIParticlePrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests UIParticle.CurveTable;Quit"//
+
+namespace UIParticleCurveTableTests
+{
+	//Samples per second of curve time the tables are checked at, far more than the tables have//
+	const int32 DenseSamplesPerSecond = 20000;
+
+	void AddKeys(FRichCurve& Curve, const TArray<FVector2D>& Keys, ERichCurveInterpMode InterpMode)
+	{
+		for (const FVector2D& Key : Keys)
+		{
+			Curve.SetKeyInterpMode(Curve.AddKey(Key.X, Key.Y), InterpMode);
+		}
+		Curve.AutoSetTangents();
+	}
+
+	//Largest difference the tables may have with their curve, the same way FUIParticleCurveTable::Bake computes it//
+	float GetTolerance(const FRichCurve& Curve)
+	{
+		float MaxError = IConsoleManager::Get().FindConsoleVariable(TEXT("UIParticle.CurveTable.MaxError"))->GetFloat();
+		float MinValue, MaxValue;
+		Curve.GetValueRange(MinValue, MaxValue);
+		return FMath::Max(MaxError, 0.0f) * (MaxValue - MinValue) + KINDA_SMALL_NUMBER;
+	}
+
+	//Returns the largest difference between the table and the curve over the time range of the curve//
+	float GetMaxTableError(const FUIParticleCurveTable& Table, const FRichCurve& Curve, float& OutWorstTime)
+	{
+		float MinTime, MaxTime;
+		Curve.GetTimeRange(MinTime, MaxTime);
+		int32 NumSamples = FMath::CeilToInt((MaxTime - MinTime) * DenseSamplesPerSecond);
+
+		float MaxError = 0;
+		OutWorstTime = MinTime;
+		for (int32 i = 0; i <= NumSamples; i++)
+		{
+			float Time = FMath::Lerp(MinTime, MaxTime, (float)i / NumSamples);
+			float Error = FMath::Abs(Table.Eval(Curve, Time, 0) - Curve.Eval(Time, 0));
+			if (Error > MaxError)
+			{
+				MaxError = Error;
+				OutWorstTime = Time;
+			}
+		}
+		return MaxError;
+	}
+}
+
+
+/**
+ * Bakes a curve with cubic keys and one with a linear corner between two samples,
+ * and checks the tables against FRichCurve::Eval at dense samples.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUIParticleCurveTableErrorTest, "UIParticle.CurveTable.MaxError",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUIParticleCurveTableErrorTest::RunTest(const FString& Parameters)
+{
+	using namespace UIParticleCurveTableTests;
+
+	FRichCurve CubicCurve;
+	AddKeys(CubicCurve, { FVector2D(0, 0), FVector2D(0.3f, 1), FVector2D(0.7f, -0.5f), FVector2D(1, 0.2f) }, RCIM_Cubic);
+
+	//The corner is off the grid of any resolution//
+	FRichCurve CornerCurve;
+	AddKeys(CornerCurve, { FVector2D(0, 0), FVector2D(0.137f, 5), FVector2D(1, -3) }, RCIM_Linear);
+
+	const FRichCurve* Curves[] = { &CubicCurve, &CornerCurve };
+	const TCHAR* CurveNames[] = { TEXT("Cubic"), TEXT("Corner") };
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Curves); i++)
+	{
+		FUIParticleCurveTable Table;
+		Table.Bake(*Curves[i], 0);
+		if (!TestTrue(FString::Printf(TEXT("%s: baked"), CurveNames[i]), Table.IsBaked()))
+		{
+			continue;
+		}
+
+		float WorstTime;
+		float Error = GetMaxTableError(Table, *Curves[i], WorstTime);
+		float Tolerance = GetTolerance(*Curves[i]);
+		TestTrue(FString::Printf(TEXT("%s: error %f at %f within %f"), CurveNames[i], Error, WorstTime, Tolerance), Error <= Tolerance);
+	}
+
+	return true;
+}
+
+
+/**
+ * A looping curve of the particle lifetime must give the curve at the time modulo its length, over several loops.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUIParticleCurveTableLoopTest, "UIParticle.CurveTable.Loop",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUIParticleCurveTableLoopTest::RunTest(const FString& Parameters)
+{
+	using namespace UIParticleCurveTableTests;
+
+	FUIParticleFloatCurve LoopCurve;
+	LoopCurve.Reset();
+	LoopCurve.CurveType = ECurveType::ParticleLifeTime;
+	LoopCurve.Loop = true;
+	AddKeys(LoopCurve.CurveData, { FVector2D(0, 1), FVector2D(0.5f, 3), FVector2D(1.2f, -2), FVector2D(2, 1) }, RCIM_Cubic);
+	LoopCurve.Bake();
+
+	if (!TestTrue(TEXT("Baked"), LoopCurve.Table.IsBaked()))
+	{
+		return true;
+	}
+
+	const float LoopTime = 2;
+	const int32 NumLoops = 3;
+	const int32 NumSamples = (int32)(LoopTime * NumLoops * DenseSamplesPerSecond);
+	const float Tolerance = GetTolerance(LoopCurve.CurveData);
+
+	float MaxError = 0;
+	float WorstTime = 0;
+	for (int32 i = 0; i <= NumSamples; i++)
+	{
+		float Time = LoopTime * NumLoops * i / NumSamples;
+		float Error = FMath::Abs(LoopCurve.GetValue(0, Time, 0) - LoopCurve.CurveData.Eval(FMath::Fmod(Time, LoopTime), 0));
+		if (Error > MaxError)
+		{
+			MaxError = Error;
+			WorstTime = Time;
+		}
+	}
+	TestTrue(FString::Printf(TEXT("Error %f at %f within %f"), MaxError, WorstTime, Tolerance), MaxError <= Tolerance);
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,10 @@
 #include "UIParticlePrivatePCH.h"
 #include "Asset/UIParticleEmitterAsset.h"
 
+#define LOCTEXT_NAMESPACE "UIParticleEmitterAsset"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUIParticleEmitterAsset, Log, All);
+
 UUIParticleEmitterAsset::UUIParticleEmitterAsset(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
 {
@@ -38,6 +42,7 @@ UUIParticleEmitterAsset::UUIParticleEmitterAsset(const FObjectInitializer& Objec
 	RotationFollowSpeed = false;
 	UseScaleFollowSpeedVertical = false;
 	UseScaleFollowSpeedDirection = false;
+	ShareMaterialInstance = false;
 	UseSeparateSize = false;
 	DesignSize = FVector2D(200, 200);
 
@@ -105,3 +110,101 @@ UUIParticleEmitterAsset::UUIParticleEmitterAsset(const FObjectInitializer& Objec
 
 	EmitAngleByWidgetAngle = false;
 }
+
+void UUIParticleEmitterAsset::PostLoad()
+{
+	Super::PostLoad();
+	BakeCurveTables();
+}
+
+int32 UUIParticleEmitterAsset::GetLostVertexScalarParamCount() const
+{
+	if (!ShareMaterialInstance)
+	{
+		return 0;
+	}
+	return FMath::Max(ScalarParams.Num() + ScalarParamsWhenStart.Num() - MAX_VERTEX_SCALAR_PARAMS, 0);
+}
+
+#if WITH_EDITOR
+void UUIParticleEmitterAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	BakeCurveTables();
+
+	const int32 LostCount = GetLostVertexScalarParamCount();
+	if (LostCount > 0)
+	{
+		UE_LOG(LogUIParticleEmitterAsset, Warning, TEXT("%s: ShareMaterialInstance only has %d vertex slots for the scalar params, the last %d are lost"),
+			*GetPathName(), MAX_VERTEX_SCALAR_PARAMS, LostCount);
+	}
+}
+
+EDataValidationResult UUIParticleEmitterAsset::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	const int32 LostCount = GetLostVertexScalarParamCount();
+	if (LostCount > 0)
+	{
+		ValidationErrors.Add(FText::Format(LOCTEXT("LostVertexScalarParams", "ShareMaterialInstance only has {0} vertex slots for the ScalarParams and ScalarParamsWhenStart, the last {1} are lost."),
+			FText::AsNumber(MAX_VERTEX_SCALAR_PARAMS), FText::AsNumber(LostCount)));
+		Result = EDataValidationResult::Invalid;
+	}
+	return Result;
+}
+
+void UUIParticleEmitterAsset::PostEditUndo()
+{
+	Super::PostEditUndo();
+	BakeCurveTables();
+}
+#endif
+
+void UUIParticleEmitterAsset::BakeCurveTables()
+{
+	MaxParticleCount.BakeCurveTables();
+	SpawnParticlePerSecond.BakeCurveTables();
+	ParticleEmitAngle.BakeCurveTables();
+	EmitPosition.X.BakeCurveTables();
+	EmitPosition.Y.BakeCurveTables();
+
+	LifeSpan.BakeCurveTables();
+	Size.BakeCurveTables();
+	Pivot.BakeCurveTables();
+	RotationStart.BakeCurveTables();
+	RotationSpeed.BakeCurveTables();
+	Color.BakeCurveTables();
+
+	Gravity.BakeCurveTables();
+	StartSpeed.BakeCurveTables();
+	AirResistance.BakeCurveTables();
+	RadialAcceleration.BakeCurveTables();
+	TangentialAcceleration.BakeCurveTables();
+
+	Radius.BakeCurveTables();
+	DegreePerSecond.BakeCurveTables();
+
+	PositionX.BakeCurveTables();
+	PositionY.BakeCurveTables();
+
+	for (FScalarParamCurve& Param : ScalarParams)
+	{
+		Param.Value.BakeCurveTables();
+	}
+	for (FScalarParamCurve& Param : ScalarParamsWhenStart)
+	{
+		Param.Value.BakeCurveTables();
+	}
+
+	ScaleFollowSpeedDirection.BakeCurveTables();
+	ScaleFollowSpeedVertical.BakeCurveTables();
+	DirectionScale.BakeCurveTables();
+	VerticalDirectionScale.BakeCurveTables();
+
+	SineDirectionStart.BakeCurveTables();
+	SineDirectionSpeed.BakeCurveTables();
+	SineDirectionRange.BakeCurveTables();
+}
+
+#undef LOCTEXT_NAMESPACE
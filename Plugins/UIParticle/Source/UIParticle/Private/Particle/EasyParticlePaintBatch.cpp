@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#include "Particle/EasyParticlePaintBatch.h"
+#include "UIParticlePrivatePCH.h"
+#include "Particle/EasyParticleState.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+
+//Four vertices per particle, and the indices must fit in SlateIndex//
+#define MAX_BATCH_VERTICES ((int32)TNumericLimits<SlateIndex>::Max() - 3)
+
+FEasyParticlePaintBatcher::FEasyParticlePaintBatcher()
+{
+	NumBatches = 0;
+}
+
+void FEasyParticlePaintBatcher::Reset()
+{
+	for (int32 i = 0; i < NumBatches; i++)
+	{
+		Batches[i].Vertices.Reset();
+		Batches[i].Indices.Reset();
+		Batches[i].ResourceHandle = FSlateResourceHandle();
+	}
+	NumBatches = 0;
+}
+
+FEasyParticlePaintBatcher::FBatch* FEasyParticlePaintBatcher::FindOrAddBatch(const FBatchKey& Key, const FSlateBrush& Brush)
+{
+	//Joining an earlier batch would draw the particle under the ones painted since, so only the last one is extended//
+	if (NumBatches > 0)
+	{
+		FBatch& LastBatch = Batches[NumBatches - 1];
+		if (LastBatch.Key == Key && LastBatch.Vertices.Num() + 4 <= MAX_BATCH_VERTICES)
+		{
+			return &LastBatch;
+		}
+	}
+
+	FSlateResourceHandle ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(Brush);
+	if (!ResourceHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (NumBatches == Batches.Num())
+	{
+		Batches.AddDefaulted();
+	}
+	FBatch& Batch = Batches[NumBatches];
+	NumBatches++;
+
+	Batch.Key = Key;
+	Batch.ResourceHandle = ResourceHandle;
+
+	//Resources in an atlas only cover part of the texture//
+	const FSlateShaderResourceProxy* Proxy = ResourceHandle.GetResourceProxy();
+	Batch.StartUV = Proxy ? Proxy->StartUV : FVector2D(0, 0);
+	Batch.SizeUV = Proxy ? Proxy->SizeUV : FVector2D(1, 1);
+	return &Batch;
+}
+
+bool FEasyParticlePaintBatcher::AddParticle(const FEasyParticleState& Particle, int32 Layer)
+{
+	FBatchKey Key;
+	Key.Layer = Layer;
+	Key.Resource = Particle.ImageBrush.GetResourceObject();
+	Key.DrawEffect = (ESlateDrawEffect)Particle.EmitterConfig->DrawEffect;
+
+	FBatch* Batch = FindOrAddBatch(Key, Particle.ImageBrush);
+	if (Batch == nullptr)
+	{
+		return false;
+	}
+
+	//Same quad MakeBox draws for an image brush: the local rect of the geometry, through its render transform//
+	const FSlateRenderTransform& RenderTransform = Particle.PaintGeometryCache.GetAccumulatedRenderTransform();
+	const FVector2D LocalSize = Particle.PaintGeometryCache.GetLocalSize();
+	const FColor Color = Particle.PaintColorCache.ToFColor(false);
+
+	SlateIndex FirstIndex = (SlateIndex)Batch->Vertices.Num();
+	const FVector2D Corners[4] = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(0, 1), FVector2D(1, 1) };
+	for (const FVector2D& Corner : Corners)
+	{
+		FVector2D UV = Batch->StartUV + Corner * Batch->SizeUV;
+		Batch->Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, Corner * LocalSize, FVector4(UV.X, UV.Y, Particle.VertexScalarParams.X, Particle.VertexScalarParams.Y), Corner, Color));
+	}
+
+	Batch->Indices.Add(FirstIndex);
+	Batch->Indices.Add(FirstIndex + 1);
+	Batch->Indices.Add(FirstIndex + 2);
+	Batch->Indices.Add(FirstIndex + 2);
+	Batch->Indices.Add(FirstIndex + 1);
+	Batch->Indices.Add(FirstIndex + 3);
+	return true;
+}
+
+int32 FEasyParticlePaintBatcher::Submit(FSlateWindowElementList& OutDrawElements)
+{
+	int32 ElementCount = 0;
+	for (int32 i = 0; i < NumBatches; i++)
+	{
+		FBatch& Batch = Batches[i];
+		if (Batch.Vertices.Num() > 0)
+		{
+			FSlateDrawElement::MakeCustomVerts(OutDrawElements, Batch.Key.Layer, Batch.ResourceHandle, Batch.Vertices, Batch.Indices, nullptr, 0, 0, Batch.Key.DrawEffect);
+			ElementCount++;
+		}
+	}
+	Reset();
+	return ElementCount;
+}
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#include "Particle/EasyParticlePaintBatch.h"
+#include "UIParticlePrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/Texture2D.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "Input/HittestGrid.h"
+#include "Widgets/SNullWidget.h"
+#include "Widgets/SWindow.h"
+#include "Utility/UIParticleUtility.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests UIParticle.Paint;Quit"//
+
+namespace EasyParticlePaintBatchTests
+{
+	//Emitter of many particles, all on one layer with one resource and one draw effect//
+	UUIParticleEmitterAsset* CreateTextureEmitter(UTexture2D* Texture)
+	{
+		UUIParticleEmitterAsset* Asset = NewObject<UUIParticleEmitterAsset>();
+		Asset->EmitterType = EEmitterType::Gravity;
+		Asset->EmitSeconds = -1;
+		Asset->SpawnParticlePerSecond.FloatValue = 200;
+		Asset->MaxParticleCount.FloatValue = 300;
+		Asset->Gravity.Vector2DValue = FVector2D(0, 100);
+		Asset->ResourceObject = Texture;
+		Asset->BakeCurveTables();
+		return Asset;
+	}
+
+	//Same steps as SUIParticleEmitter::Tick//
+	void TickRoot(FEasyParticleRootState* Root, float DeltaTime, const FGeometry& Geometry)
+	{
+		if (Root->FirstRootTick)
+		{
+			Root->FirstTick(DeltaTime, Geometry);
+		}
+		FUIParticleFactory::Instance()->TickRoot(Root, DeltaTime, Geometry);
+		Root->TrySpawnParticle(Geometry);
+	}
+
+	int32 GetPaintedParticleCount(FEasyParticleRootState* Root)
+	{
+		int32 Count = 0;
+		for (FEasyParticleState* Particle : Root->ChildrenParticleArray[0].ChildrenParticle)
+		{
+			if (!Particle->IsInPool() && Particle->IsNeedPaint)
+			{
+				Count++;
+			}
+		}
+		return Count;
+	}
+}
+
+
+/**
+ * Paints two emitters of a few hundred particles into an element list.
+ * With the batched paint, each emitter must only add one element per run of particles sharing layer, resource and draw effect,
+ * which is one here, whatever its particle count.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyParticlePaintBatchTest, "UIParticle.Paint.BatchedElements",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEasyParticlePaintBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyParticlePaintBatchTests;
+
+	UTexture2D* Texture = LoadObject<UTexture2D>(nullptr, TEXT("/Engine/EngineResources/DefaultTexture.DefaultTexture"));
+	if (!TestNotNull(TEXT("Default texture"), Texture))
+	{
+		return true;
+	}
+
+	//The batches hold the resource handles of the renderer, without them every particle falls back to a box//
+	FSlateBrush Brush;
+	Brush.SetResourceObject(Texture);
+	if (!FSlateApplication::IsInitialized() || FSlateApplication::Get().GetRenderer() == nullptr
+		|| !FSlateApplication::Get().GetRenderer()->GetResourceHandle(Brush).IsValid())
+	{
+		AddWarning(TEXT("No Slate renderer giving resource handles, skipped"));
+		return true;
+	}
+
+	IConsoleVariable* BatchedPaint = IConsoleManager::Get().FindConsoleVariable(TEXT("UIParticle.BatchedPaint"));
+	const int32 BatchedPaintValue = BatchedPaint->GetInt();
+	BatchedPaint->Set(1, ECVF_SetByCode);
+	const bool MultiThread = UUIParticleUtility::GetMultiThread();
+	UUIParticleUtility::SetMultiThread(false);
+
+	const int32 NumEmitters = 2;
+	const FGeometry Geometry = FGeometry::MakeRoot(FVector2D(400, 400), FSlateLayoutTransform());
+	UUIParticleEmitterAsset* Asset = CreateTextureEmitter(Texture);
+
+	TArray<TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe>> Roots;
+	for (int32 i = 0; i < NumEmitters; i++)
+	{
+		//Not referenced by the factory, so the pools of the roots go away with them//
+		TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe> Root = MakeShareable(new FEasyParticleRootState());
+		Root->InitRoot(Asset, 0);
+		for (int32 Frame = 0; Frame < 60; Frame++)
+		{
+			TickRoot(Root.Get(), 1.0f / 60, Geometry);
+		}
+		Roots.Add(Root);
+	}
+
+	FHittestGrid HittestGrid;
+	const FPaintArgs PaintArgs(&SNullWidget::NullWidget.Get(), HittestGrid, FVector2D::ZeroVector, 0, 0);
+	FSlateWindowElementList ElementList(SNew(SWindow));
+
+	int32 PaintedParticleCount = 0;
+	for (const TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe>& Root : Roots)
+	{
+		FUIParticleFactory::Instance()->OnRootPaint(Root.Get(), PaintArgs, Geometry, Geometry.GetLayoutBoundingRect(), ElementList, 0, FWidgetStyle(), true);
+		PaintedParticleCount += GetPaintedParticleCount(Root.Get());
+	}
+	const int32 ElementCount = ElementList.GetUncachedDrawElements().Num();
+
+	UUIParticleUtility::SetMultiThread(MultiThread);
+	BatchedPaint->Set(BatchedPaintValue, ECVF_SetByCode);
+
+	TestTrue(FString::Printf(TEXT("%d particles painted"), PaintedParticleCount), PaintedParticleCount > 10 * NumEmitters);
+	TestTrue(FString::Printf(TEXT("%d elements for %d emitters"), ElementCount, NumEmitters), ElementCount > 0 && ElementCount <= NumEmitters);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#include "Particle/EasyParticleSimulation.h"
+#include "UIParticlePrivatePCH.h"
+
+int32 FEasyParticleSimLanes::AddLane()
+{
+	PosX.Add(0);
+	PosY.Add(0);
+	SpeedX.Add(0);
+	SpeedY.Add(0);
+	Lifetime.Add(0);
+	Rotation.Add(0);
+	SizeX.Add(0);
+	SizeY.Add(0);
+	ColorR.Add(0);
+	ColorG.Add(0);
+	ColorB.Add(0);
+	ColorA.Add(0);
+	AccelerationX.Add(0);
+	AccelerationY.Add(0);
+	AirResistance.Add(0);
+	SineOffset.Add(0);
+	DeltaTime.Add(0);
+	return PosScale.Add(1);
+}
+
+void FEasyParticleSimLanes::ClearStep(int32 Index)
+{
+	//No time and no sine offset: the integration keeps the position and the speed as they are//
+	DeltaTime[Index] = 0;
+	SineOffset[Index] = 0;
+}
+
+void EasyParticleSimulation::IntegrateParticle(FVector2D& Pos, FVector2D& Speed, const FVector2D& Acceleration, float AirResistance, float SineOffset, float DeltaTime, float PosScale)
+{
+	Speed += Acceleration * DeltaTime;
+
+	//Air resistance slows the speed down to zero, never past it//
+	Speed *= FMath::Max(1 - AirResistance * DeltaTime, 0.0f);
+
+	const float SizeSquared = Speed.SizeSquared();
+	if (SizeSquared > SMALL_NUMBER)
+	{
+		const float Offset = SineOffset * FMath::InvSqrt(SizeSquared);
+		Speed = FVector2D(Speed.X - Speed.Y * Offset, Speed.Y + Speed.X * Offset);
+	}
+
+	Pos += Speed * DeltaTime * PosScale;
+}
+
+void EasyParticleSimulation::Integrate(FEasyParticleSimLanes& Lanes, int32 StartIndex, int32 EndIndex)
+{
+	float* PosX = Lanes.PosX.GetData();
+	float* PosY = Lanes.PosY.GetData();
+	float* SpeedX = Lanes.SpeedX.GetData();
+	float* SpeedY = Lanes.SpeedY.GetData();
+	const float* AccelerationX = Lanes.AccelerationX.GetData();
+	const float* AccelerationY = Lanes.AccelerationY.GetData();
+	const float* AirResistance = Lanes.AirResistance.GetData();
+	const float* SineOffset = Lanes.SineOffset.GetData();
+	const float* DeltaTime = Lanes.DeltaTime.GetData();
+	const float* PosScale = Lanes.PosScale.GetData();
+
+	const VectorRegister Zero = VectorZero();
+	const VectorRegister One = VectorOne();
+	const VectorRegister Tolerance = VectorSetFloat1(SMALL_NUMBER);
+
+	int32 i = StartIndex;
+	for (; i + 4 <= EndIndex; i += 4)
+	{
+		const VectorRegister Dt = VectorLoad(DeltaTime + i);
+		VectorRegister VX = VectorMultiplyAdd(VectorLoad(AccelerationX + i), Dt, VectorLoad(SpeedX + i));
+		VectorRegister VY = VectorMultiplyAdd(VectorLoad(AccelerationY + i), Dt, VectorLoad(SpeedY + i));
+
+		const VectorRegister Keep = VectorMax(VectorSubtract(One, VectorMultiply(VectorLoad(AirResistance + i), Dt)), Zero);
+		VX = VectorMultiply(VX, Keep);
+		VY = VectorMultiply(VY, Keep);
+
+		//Offset along (-SpeedY, SpeedX), the speed rotated by 90 degrees and normalized//
+		//The refined reciprocal square root is the one FMath::InvSqrt computes, so a particle moves the same in a block or in the tail//
+		const VectorRegister SizeSquared = VectorMultiplyAdd(VX, VX, VectorMultiply(VY, VY));
+		const VectorRegister InvSize = VectorReciprocalSqrtAccurate(VectorMax(SizeSquared, Tolerance));
+		const VectorRegister Offset = VectorSelect(VectorCompareGT(SizeSquared, Tolerance), VectorMultiply(VectorLoad(SineOffset + i), InvSize), Zero);
+		const VectorRegister OffsetVX = VectorSubtract(VX, VectorMultiply(VY, Offset));
+		VY = VectorMultiplyAdd(VX, Offset, VY);
+		VX = OffsetVX;
+
+		const VectorRegister Step = VectorMultiply(Dt, VectorLoad(PosScale + i));
+		VectorStore(VectorMultiplyAdd(VX, Step, VectorLoad(PosX + i)), PosX + i);
+		VectorStore(VectorMultiplyAdd(VY, Step, VectorLoad(PosY + i)), PosY + i);
+		VectorStore(VX, SpeedX + i);
+		VectorStore(VY, SpeedY + i);
+	}
+
+	for (; i < EndIndex; i++)
+	{
+		FVector2D Pos(PosX[i], PosY[i]);
+		FVector2D Speed(SpeedX[i], SpeedY[i]);
+		IntegrateParticle(Pos, Speed, FVector2D(AccelerationX[i], AccelerationY[i]), AirResistance[i], SineOffset[i], DeltaTime[i], PosScale[i]);
+		PosX[i] = Pos.X;
+		PosY[i] = Pos.Y;
+		SpeedX[i] = Speed.X;
+		SpeedY[i] = Speed.Y;
+	}
+}
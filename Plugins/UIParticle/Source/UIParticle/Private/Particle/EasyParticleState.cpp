@@ -7,6 +7,8 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Rendering/DrawElements.h"
 #include "Utility/UIParticleUtility.h"
+#include "Particle/EasyParticleSimulation.h"
+#include "Particle/EasyParticlePaintBatch.h"
 
 #define MAX_PARTICLECOUNT 100000
 #define MAX_LAYER 4
@@ -23,11 +25,13 @@ void FEasyParticleState::InitWithAsset(UUIParticleEmitterAsset* DataAsset)
 			temp.ActivityInParentLifeTime = DataAsset->ChildrenEmitters[i].ActivityInParentLifeTime;
 			temp.ChildrenAsset = DataAsset->ChildrenEmitters[i].ChildrenAsset;
 			temp.IsStartEmitter = false;
+			temp.EmitterStartTime = 0;
 			temp.LastFractionalNum = 0;
 			temp.CountToSpawn = 0;
 			temp.ZOrderOffset = DataAsset->ChildrenEmitters[i].ZOrderOffset;
 			temp.FollowParentPosition = DataAsset->ChildrenEmitters[i].FollowParentPosition;
 			temp.FollowParentSpeedPercent = DataAsset->ChildrenEmitters[i].FollowParentSpeedPercent;
+			temp.SharedMaterialInstance = nullptr;
 			ChildrenParticleArray.Add(temp);
 		}
 	}
@@ -58,7 +62,7 @@ bool FEasyParticleState::IsParticleEnd()
 	{
 		return true;
 	}
-	else if (CurLifetime >= Deadtime || Deadtime <= 0)
+	else if (GetCurLifetime() >= Deadtime || Deadtime <= 0)
 	{
 		return true;
 	}
@@ -146,10 +150,20 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 	}
 
 
+	TSharedPtr<FEasyParticleEmitterConfig, ESPMode::ThreadSafe>& Config = ChildEmitterArray.Config;
+	if (!Config.IsValid() || Config->EmitterType != DataAsset->EmitterType || Config->PositionType != DataAsset->PositionType || Config->DrawEffect != DataAsset->DrawEffect
+		|| Config->FollowParentPosition != InFollowParentPosition || Config->FollowParentSpeedPercent != InFollowParentSpeedPercent)
+	{
+		Config = MakeShareable(new FEasyParticleEmitterConfig());
+		Config->EmitterType = DataAsset->EmitterType;
+		Config->PositionType = DataAsset->PositionType;
+		Config->DrawEffect = DataAsset->DrawEffect;
+		Config->FollowParentPosition = InFollowParentPosition;
+		Config->FollowParentSpeedPercent = InFollowParentSpeedPercent;
+	}
+
 	Ret->SetInPool(false);
-	Ret->EmitterType = DataAsset->EmitterType;
-	Ret->PositionType = DataAsset->PositionType;
-	Ret->DrawEffect = DataAsset->DrawEffect;
+	Ret->EmitterConfig = Config;
 
 	Ret->SizeLerpKey = FMath::FRandRange(0, 1);
 	Ret->SizeXLerpKey.Random();
@@ -225,13 +239,13 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 	const FVector2D LocalPosition = LocalSize / 2;
 	Ret->StartWidgetPositionWorld = AllottedGeometry.LocalToAbsolute(LocalPosition);
 
-	if (PositionType == EPositionType::FREE)
+	if (EmitterConfig->PositionType == EPositionType::FREE)
 	{
-		Ret->StartPositionLocal = CurPos + ((StartWidgetPositionWorld - Ret->StartWidgetPositionWorld) / AllottedGeometry.Scale) + DataAsset->EmitPosition.GetValue(0, 0, RootSpanTime, Ret->EmitPositionLerpKey)* WholeScale;
+		Ret->StartPositionLocal = GetCurPos() + ((StartWidgetPositionWorld - Ret->StartWidgetPositionWorld) / AllottedGeometry.Scale) + DataAsset->EmitPosition.GetValue(0, 0, RootSpanTime, Ret->EmitPositionLerpKey)* WholeScale;
 	}
-	else if (PositionType == EPositionType::RELATIVE)
+	else if (EmitterConfig->PositionType == EPositionType::RELATIVE)
 	{
-		Ret->StartPositionLocal = CurPos + DataAsset->EmitPosition.GetValue(0, 0, RootSpanTime, Ret->EmitPositionLerpKey)* WholeScale;
+		Ret->StartPositionLocal = GetCurPos() + DataAsset->EmitPosition.GetValue(0, 0, RootSpanTime, Ret->EmitPositionLerpKey)* WholeScale;
 	}
 
 	Ret->StartSpeed = FVector2D(1, 0).GetRotated(Ret->ParticleEmitAngle)*RandomSpeed;
@@ -242,7 +256,17 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 	if (DataAsset->ScalarParams.Num() > 0 || DataAsset->ScalarParamsWhenStart.Num() > 0)
 	{
 		UMaterialInterface * Material = Cast<UMaterialInterface>(DataAsset->ResourceObject);
-		if (Material)
+		if (Material && DataAsset->ShareMaterialInstance)
+		{
+			UMaterialInstanceDynamic*& SharedInstance = ChildEmitterArray.SharedMaterialInstance;
+			if (SharedInstance == nullptr || SharedInstance->Parent != Material)
+			{
+				SharedInstance = UMaterialInstanceDynamic::Create(Material, NULL);
+				INC_DWORD_STAT(STAT_UIParticleMaterialInstancesCreated);
+			}
+			Ret->ParticleResource = SharedInstance;
+		}
+		else if (Material)
 		{
 			bool NeedCreate = true;
 			if (Ret->ParticleResource != nullptr)
@@ -250,7 +274,8 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 				UMaterialInstanceDynamic * DynamicInstance = Cast<UMaterialInstanceDynamic>(Ret->ParticleResource);
 				if (DynamicInstance != nullptr)
 				{
-					if (DynamicInstance->Parent == Material)
+					//Never take over the instance an emitter shares//
+					if (DynamicInstance->Parent == Material && DynamicInstance != ChildEmitterArray.SharedMaterialInstance)
 					{
 						NeedCreate = false;
 					}
@@ -259,6 +284,7 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 			if (NeedCreate)
 			{
 				Ret->ParticleResource = UMaterialInstanceDynamic::Create(Material, NULL);
+				INC_DWORD_STAT(STAT_UIParticleMaterialInstancesCreated);
 			}
 		}
 		else
@@ -273,23 +299,20 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 
 	Ret->ImageBrush.SetResourceObject(Ret->ParticleResource);
 
-	if (Ret->EmitterType == EEmitterType::Gravity)
+	if (Config->EmitterType == EEmitterType::Gravity)
 	{
 		Ret->SourcePos = DataAsset->EmitPosRange.GetValue();
 	}
-	else if (EmitterType == EEmitterType::Radial)
+	else if (EmitterConfig->EmitterType == EEmitterType::Radial)
 	{
 		Ret->SourcePos = DataAsset->EmitPosRange.Min;
 		Ret->Radius = DataAsset->Radius.GetValue_Float(0, 0, RootSpanTime, Ret->RadiusPercent);
 	}
-	else if (EmitterType == EEmitterType::Curve)
+	else if (EmitterConfig->EmitterType == EEmitterType::Curve)
 	{
 		Ret->SourcePos = DataAsset->EmitPosRange.GetValue();
 	}
 
-	Ret->FollowParentPosition = InFollowParentPosition;
-	Ret->FollowParentSpeedPercent = InFollowParentSpeedPercent;
-
 	Ret->InitWithAsset(DataAsset);
 	Ret->ParentParticle = this;
 	Ret->RootParticle = RootParticle;
@@ -307,6 +330,9 @@ FEasyParticleState* FEasyParticleState::CreateParticle(const FGeometry& Allotted
 
 void FEasyParticleState::UpdateParticle(float dt, const FGeometry& AllottedGeometry)
 {
+	//Ticked again before its pool integrated it (first tick), finish the previous update first//
+	ApplyPendingIntegration();
+
 	if (!SelfAsset || !SelfAsset->IsValidLowLevel())
 	{
 		StopEmit();
@@ -317,6 +343,7 @@ void FEasyParticleState::UpdateParticle(float dt, const FGeometry& AllottedGeome
 	{
 		return;
 	}
+	float CurLifetime = GetCurLifetime();
 	if (IsRoot && CurLifetime > Deadtime)
 	{
 		CurLifetime = 0;
@@ -325,27 +352,30 @@ void FEasyParticleState::UpdateParticle(float dt, const FGeometry& AllottedGeome
 
 	ImageBrush.DrawAs = ESlateBrushDrawType::Image;
 	CurLifetime += dt;
+	SetCurLifetime(CurLifetime);
 
 	float NowPercent = CurLifetime / Deadtime;
 	CurPercent = NowPercent;
 
-	CurColor = SelfAsset->Color.GetValue_Color(CurPercent, CurLifetime, RootSpanTime, ColorLerpKey);
+	SetCurColor(SelfAsset->Color.GetValue_Color(CurPercent, CurLifetime, RootSpanTime, ColorLerpKey));
 
 	if (SelfAsset->UseSeparateSize)
 	{
 		FVector2D CurSize_Local = SelfAsset->Size.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, SizeXLerpKey)*WholeScale;
-		CurSizeX = CurSize_Local.X;
+		SetCurSizeX(CurSize_Local.X);
 		CurSize_Local = SelfAsset->Size.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, SizeYLerpKey)*WholeScale;
-		CurSizeY = CurSize_Local.Y;
+		SetCurSizeY(CurSize_Local.Y);
 	}
 	else
 	{
-		CurSizeX = SelfAsset->Size.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SizeLerpKey)*WholeScale;
-		CurSizeY = CurSizeX;
+		float CurSizeX = SelfAsset->Size.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SizeLerpKey)*WholeScale;
+		SetCurSizeX(CurSizeX);
+		SetCurSizeY(CurSizeX);
 	}
 
 	CurPivot = SelfAsset->Pivot.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, PivotLerpKey);
 
+	const EEmitterType EmitterType = EmitterConfig->EmitterType;
 	if (EmitterType == EEmitterType::Gravity)
 	{
 
@@ -353,57 +383,39 @@ void FEasyParticleState::UpdateParticle(float dt, const FGeometry& AllottedGeome
 		TangentialAcceleration = SelfAsset->TangentialAcceleration.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, TangentialAccelerationLerpKey);
 		Gravity = SelfAsset->Gravity.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, GravityLerpKey);
 
-		FVector2D RadialVector = (CurPos - SourcePos - StartPositionLocal);
+		FVector2D RadialVector = (GetCurPos() - SourcePos - StartPositionLocal);
 		RadialVector.Normalize();
 		FVector2D RadialForce = RadialVector * RadialAcceleration;
 		FVector2D TangentialVector = FVector2D(-RadialVector.Y, RadialVector.X);
 		FVector2D TangentialForce = TangentialVector * TangentialAcceleration;
 
-		CurSpeed += (Gravity*dt);
-		CurSpeed += (RadialForce*dt);
-		CurSpeed += (TangentialForce*dt);
+		FVector2D Acceleration = Gravity + RadialForce + TangentialForce;
 
 		AirResistance = SelfAsset->AirResistance.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, AirResistanceLerpKey);
-		if (AirResistance != 0)
-		{
-			FVector2D DeleteSpeed = CurSpeed * AirResistance*dt;
-			FVector2D AfterSpeed = CurSpeed - DeleteSpeed;
-
-			if (AfterSpeed.X * CurSpeed.X <= 0)
-			{
-				CurSpeed.X = 0;
-			}
-			else
-			{
-				CurSpeed.X = AfterSpeed.X;
-			}
-
-			if (AfterSpeed.Y * CurSpeed.Y <= 0)
-			{
-				CurSpeed.Y = 0;
-			}
-			else
-			{
-				CurSpeed.Y = AfterSpeed.Y;
-			}
-		}
 
-		FVector2D sinoffset = FVector2D(0, 0);
+		SineDirectionSpeed = SelfAsset->SineDirectionSpeed.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SineDirectionSpeedLerpKey);
+		//Simulation time rather than wall clock, so the motion only depends on the delta times ticked//
+		float spansecond = RootSpanTime * SineDirectionSpeed + SineDirectionStart;
+		float CurSineDirectionRange = SelfAsset->SineDirectionRange.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SineDirectionRangePercent);
+		float offset = (FMath::Sin(spansecond)*CurSineDirectionRange);
+
+		//The position and the speed are already in the lane, only the step is written//
+		SimLanes->AccelerationX[SimLaneIndex] = Acceleration.X;
+		SimLanes->AccelerationY[SimLaneIndex] = Acceleration.Y;
+		SimLanes->AirResistance[SimLaneIndex] = AirResistance;
+		SimLanes->SineOffset[SimLaneIndex] = offset;
+		SimLanes->DeltaTime[SimLaneIndex] = dt;
+		SimLanes->PosScale[SimLaneIndex] = WholeScale;
+		IsIntegrationPending = true;
+		PendingDeltaTime = dt;
+
+		if (IsRoot)
 		{
-
-			SineDirectionSpeed = SelfAsset->SineDirectionSpeed.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SineDirectionSpeedLerpKey);
-			FDateTime span = FDateTime::Now();
-			float spansecond = ((span.GetSecond() * 1000 + (float)span.GetMillisecond())* SineDirectionSpeed) / 1000.0 + SineDirectionStart;
-			float CurSineDirectionRange = SelfAsset->SineDirectionRange.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SineDirectionRangePercent);
-			float offset = (FMath::Sin(spansecond)*CurSineDirectionRange);
-			FVector2D sineoffsetdirection = CurSpeed.GetRotated(90);
-			sineoffsetdirection.Normalize();
-			sinoffset = sineoffsetdirection * offset;
-
-			CurSpeed += sinoffset;
+			//Integrated with the rest of the pool for the other particles, see FUIParticleFactory::IntegratePool//
+			EasyParticleSimulation::Integrate(*SimLanes, SimLaneIndex, SimLaneIndex + 1);
+			ApplyPendingIntegration();
 		}
-
-		CurPos += CurSpeed * dt  * WholeScale;
+		return;
 	}
 	else if (EmitterType == EEmitterType::Radial)
 	{
@@ -411,50 +423,73 @@ void FEasyParticleState::UpdateParticle(float dt, const FGeometry& AllottedGeome
 		float CurDegreePerSecond = SelfAsset->DegreePerSecond.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, DegreePerSecondPercent);
 
 		CurAngle = CurAngle + CurDegreePerSecond * dt;
-		FVector2D LastPos = CurPos;
-		CurPos = FVector2D(1, 0).GetRotated(CurAngle) * CurRadius * WholeScale + StartPositionLocal;
-		CurSpeed = (CurPos - LastPos) / dt;
+		FVector2D LastPos = GetCurPos();
+		FVector2D CurPos = FVector2D(1, 0).GetRotated(CurAngle) * CurRadius * WholeScale + StartPositionLocal;
+		SetCurPos(CurPos);
+		SetCurSpeed((CurPos - LastPos) / dt);
 	}
 	else if (EmitterType == EEmitterType::Curve)
 	{
-		FVector2D LastPos = CurPos;
-		CurPos = FVector2D(SelfAsset->PositionX.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionYLerpKey))*WholeScale;
-		CurSpeed = (CurPos - LastPos) / dt;
+		FVector2D LastPos = GetCurPos();
+		FVector2D CurPos = FVector2D(SelfAsset->PositionX.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionYLerpKey))*WholeScale;
+		SetCurPos(CurPos);
+		SetCurSpeed((CurPos - LastPos) / dt);
 	}
 
-	if (PositionType == EPositionType::FREE)
+	FinishUpdateParticle(dt);
+}
+
+void FEasyParticleState::ApplyPendingIntegration()
+{
+	if (!IsIntegrationPending)
+	{
+		return;
+	}
+	IsIntegrationPending = false;
+
+	//The lane holds the integrated position and speed, it must hold still until the next Gravity update//
+	SimLanes->ClearStep(SimLaneIndex);
+	FinishUpdateParticle(PendingDeltaTime);
+}
+
+void FEasyParticleState::FinishUpdateParticle(float dt)
+{
+	const FEasyParticleEmitterConfig& Config = *EmitterConfig;
+	if (Config.PositionType == EPositionType::FREE)
 	{
 
 	}
-	else if (PositionType == EPositionType::RELATIVE)
+	else if (Config.PositionType == EPositionType::RELATIVE)
 	{
-		if (SelfAsset && FollowParentPosition && ParentParticle)
+		if (SelfAsset && Config.FollowParentPosition && ParentParticle)
 		{
-			if (EmitterType == EEmitterType::Gravity)
+			if (Config.EmitterType == EEmitterType::Gravity)
 			{
-				CurPos += ParentParticle->CurSpeed * dt;
+				SetCurPos(GetCurPos() + ParentParticle->GetCurSpeed() * dt);
 			}
-			else if (EmitterType == EEmitterType::Radial)
+			else if (Config.EmitterType == EEmitterType::Radial)
 			{
-				CurPos = FVector2D(1, 0).GetRotated(CurAngle) * Radius * dt + ParentParticle->CurPos;
+				SetCurPos(FVector2D(1, 0).GetRotated(CurAngle) * Radius * dt + ParentParticle->GetCurPos());
 			}
-			else if (EmitterType == EEmitterType::Curve)
+			else if (Config.EmitterType == EEmitterType::Curve)
 			{
-				CurPos += ParentParticle->CurSpeed * dt;
+				SetCurPos(GetCurPos() + ParentParticle->GetCurSpeed() * dt);
 			}
 		}
 	}
 
+	const float CurLifetime = GetCurLifetime();
+	const FVector2D CurSpeed = GetCurSpeed();
 	if (SelfAsset->RotationFollowSpeed)
 	{
 		float SpeedAngle = 0;
 		SpeedAngle = FMath::Atan2(CurSpeed.Y, CurSpeed.X);
-		CurRotation = SpeedAngle * 180 / PI;
+		SetCurRotation(SpeedAngle * 180 / PI);
 	}
 	else
 	{
 		float NowRotationSpeed = SelfAsset->RotationSpeed.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, RotationSpeedLerpKey);
-		CurRotation = CurRotation + NowRotationSpeed * dt;
+		SetCurRotation(GetCurRotation() + NowRotationSpeed * dt);
 	}
 
 
@@ -481,31 +516,49 @@ void FEasyParticleState::UpdateParticle(float dt, const FGeometry& AllottedGeome
 void FEasyParticleState::ResetStateProperty()
 {
 	SpawnParticleDeltaTime = 0;
-	CurLifetime = 0;
+	const float CurLifetime = 0;
+	SetCurLifetime(CurLifetime);
 	CurPercent = 0;
 	if (SelfAsset->UseSeparateSize)
 	{
 		FVector2D CurSize_Local = SelfAsset->Size.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, SizeXLerpKey)*WholeScale;
-		CurSizeX = CurSize_Local.X;
+		SetCurSizeX(CurSize_Local.X);
 		CurSize_Local = SelfAsset->Size.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, SizeYLerpKey)*WholeScale;
-		CurSizeY = CurSize_Local.Y;
+		SetCurSizeY(CurSize_Local.Y);
 	}
 	else
 	{
-		CurSizeX = SelfAsset->Size.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SizeLerpKey)*WholeScale;
-		CurSizeY = CurSizeX;
+		float CurSizeX = SelfAsset->Size.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, SizeLerpKey)*WholeScale;
+		SetCurSizeX(CurSizeX);
+		SetCurSizeY(CurSizeX);
 	}
 
 	CurPivot = SelfAsset->Pivot.GetValue_Vector2D(CurPercent, CurLifetime, RootSpanTime, PivotLerpKey);
 
-	CurRotation = RotationStart;
-	CurSpeed = StartSpeed;
-	CurColor = SelfAsset->Color.GetValue_Color(CurPercent, CurLifetime, RootSpanTime, ColorLerpKey);
+	SetCurRotation(RotationStart);
+	SetCurSpeed(StartSpeed);
+	SetCurColor(SelfAsset->Color.GetValue_Color(CurPercent, CurLifetime, RootSpanTime, ColorLerpKey));
 	CurAngle = ParticleEmitAngle;
 	CurDelay = 0;
 	bStopEmit = false;
+	IsIntegrationPending = false;
+	SimLanes->ClearStep(SimLaneIndex);
 
-	if (SelfAsset->ScalarParamsWhenStart.Num() > 0)
+	VertexScalarParams = FVector2D(1, 1);
+	if (SelfAsset->ShareMaterialInstance)
+	{
+		//Each particle keeps its own start values, in the vertex slots after the ScalarParams, see UpdateScalarParams//
+		for (int32 i = 0; i < SelfAsset->ScalarParamsWhenStart.Num() && i < ScalarParameterWhenStartLerpKeys.Num(); i++)
+		{
+			const int32 Slot = SelfAsset->ScalarParams.Num() + i;
+			if (Slot >= MAX_VERTEX_SCALAR_PARAMS)
+			{
+				break;
+			}
+			VertexScalarParams[Slot] = SelfAsset->ScalarParamsWhenStart[i].GetValue(CurPercent, CurLifetime, RootSpanTime, ScalarParameterWhenStartLerpKeys[i]);
+		}
+	}
+	else if (SelfAsset->ScalarParamsWhenStart.Num() > 0)
 	{
 		UMaterialInstanceDynamic *DynMat = Cast<UMaterialInstanceDynamic>(ImageBrush.GetResourceObject());
 		if (DynMat)
@@ -523,28 +576,29 @@ void FEasyParticleState::ResetStateProperty()
 		}
 	}
 
+	const EEmitterType EmitterType = EmitterConfig->EmitterType;
 	if (EmitterType == EEmitterType::Gravity)
 	{
-		CurPos = SourcePos + StartPositionLocal;
+		SetCurPos(SourcePos + StartPositionLocal);
 	}
 	else if (EmitterType == EEmitterType::Radial)
 	{
-		CurPos = FVector2D(1, 0).GetRotated(ParticleEmitAngle)*Radius + StartPositionLocal;
+		SetCurPos(FVector2D(1, 0).GetRotated(ParticleEmitAngle)*Radius + StartPositionLocal);
 	}
 	else if (EmitterType == EEmitterType::Curve)
 	{
-		CurPos = SourcePos + StartPositionLocal + FVector2D(SelfAsset->PositionX.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionYLerpKey))*WholeScale;
+		SetCurPos(SourcePos + StartPositionLocal + FVector2D(SelfAsset->PositionX.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionYLerpKey))*WholeScale);
 	}
 
 	if (SelfAsset)
 	{
-		if (FollowParentSpeedPercent != 0 && ParentParticle)
+		if (EmitterConfig->FollowParentSpeedPercent != 0 && ParentParticle)
 		{
-			CurSpeed = StartSpeed + ParentParticle->CurSpeed * FollowParentSpeedPercent;
+			SetCurSpeed(StartSpeed + ParentParticle->GetCurSpeed() * EmitterConfig->FollowParentSpeedPercent);
 		}
 		else
 		{
-			CurSpeed = StartSpeed;
+			SetCurSpeed(StartSpeed);
 		}
 
 		if (ParentParticle)
@@ -555,15 +609,15 @@ void FEasyParticleState::ResetStateProperty()
 
 	if (EmitterType == EEmitterType::Gravity)
 	{
-		CurPos = SourcePos + StartPositionLocal;
+		SetCurPos(SourcePos + StartPositionLocal);
 	}
 	else if (EmitterType == EEmitterType::Radial)
 	{
-		CurPos = FVector2D(1, 0).GetRotated(ParticleEmitAngle)*Radius + StartPositionLocal;
+		SetCurPos(FVector2D(1, 0).GetRotated(ParticleEmitAngle)*Radius + StartPositionLocal);
 	}
 	else if (EmitterType == EEmitterType::Curve)
 	{
-		CurPos = SourcePos + StartPositionLocal + FVector2D(SelfAsset->PositionX.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionYLerpKey))*WholeScale;
+		SetCurPos(SourcePos + StartPositionLocal + FVector2D(SelfAsset->PositionX.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(CurPercent, CurLifetime, RootSpanTime, PositionYLerpKey))*WholeScale);
 	}
 
 	for (int32 i = 0; i < ChildrenParticleArray.Num(); i++)
@@ -587,7 +641,7 @@ void FEasyParticleState::TickSelf(const float InDeltaTime, const FGeometry& Allo
 	if (IsFirstTick)
 	{
 		IsFirstTick = false;
-		TickSelf(0, AllottedGeometry, InCurWidgetPosition, InCurWidgetRotation);
+		TickSelf(0, AllottedGeometry, InCurWidgetPosition, InCurWidgetRotation, RootScale, InRootSpanTime);
 	}
 	if (CurDelay < TotalDelay)
 	{
@@ -659,6 +713,7 @@ void FEasyParticleState::CaculateSpawnParticleCount()
 {
 	if (!IsEmitterEnd() && LayerOrder < MAX_LAYER)
 	{
+		const float CurLifetime = GetCurLifetime();
 		for (int32 i = 0; i < ChildrenParticleArray.Num(); i++)
 		{
 			if (Deadtime == 0)
@@ -671,14 +726,13 @@ void FEasyParticleState::CaculateSpawnParticleCount()
 				UUIParticleEmitterAsset* ChildrenAsset = ChildrenParticleArray[i].ChildrenAsset->GetLODAsset(lod);
 				if (!ChildrenParticleArray[i].IsStartEmitter)
 				{
-					ChildrenParticleArray[i].EmitterStartTime = FDateTime::Now();
+					ChildrenParticleArray[i].EmitterStartTime = RootSpanTime;
 					ChildrenParticleArray[i].IsStartEmitter = true;
 				}
 
 				if (ChildrenParticleArray[i].IsStartEmitter)
 				{
-					FTimespan span = FDateTime::Now() - ChildrenParticleArray[i].EmitterStartTime;
-					float spansecond = span.GetTotalMilliseconds() / 1000;
+					float spansecond = RootSpanTime - ChildrenParticleArray[i].EmitterStartTime;
 					if (ChildrenAsset->EmitSeconds != -1 && spansecond >= ChildrenAsset->EmitSeconds)
 					{
 						break;
@@ -705,23 +759,9 @@ void FEasyParticleState::OnPaint(const FPaintArgs& Args, const FGeometry& Allott
 {	
 	if (IsNeedPaint)
 	{
-		if (SelfAsset->ScalarParams.Num() > 0)
-		{
-			UMaterialInstanceDynamic *DynMat = Cast<UMaterialInstanceDynamic>(ImageBrush.GetResourceObject());
-			if (DynMat)
-			{
-				for (int32 i = 0; i < SelfAsset->ScalarParams.Num(); i++)
-				{
-					FScalarParamCurve& Param = SelfAsset->ScalarParams[i];
-					if (!Param.ScalarParamName.IsNone() && i < ScalarParameterLerpKeys.Num())
-					{
-						float ParamLerpKey = ScalarParameterLerpKeys[i];
-						DynMat->SetScalarParameterValue(Param.ScalarParamName, Param.GetValue(CurPercent, CurLifetime, RootSpanTime, ParamLerpKey));
-					}
-				}
-			}
-		}
-		FSlateDrawElement::MakeBox(OutDrawElements, LayerId + ZOrder, PaintGeometryCache, &(this->ImageBrush), (ESlateDrawEffect)DrawEffect, PaintColorCache);
+		UpdateScalarParams();
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId + ZOrder, PaintGeometryCache, &(this->ImageBrush), (ESlateDrawEffect)EmitterConfig->DrawEffect, PaintColorCache);
+		INC_DWORD_STAT(STAT_UIParticleDrawElements);
 	}
 
 	for (int32 i = 0; i < ChildrenParticleArray.Num(); i++)
@@ -737,23 +777,61 @@ void FEasyParticleState::OnPaintSelf(const FPaintArgs& Args, const FGeometry& Al
 {	
 	if (IsNeedPaint)
 	{
-		if (SelfAsset->ScalarParams.Num() > 0)
+		UpdateScalarParams();
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId + ZOrder, PaintGeometryCache, &(this->ImageBrush), (ESlateDrawEffect)EmitterConfig->DrawEffect, PaintColorCache);
+		INC_DWORD_STAT(STAT_UIParticleDrawElements);
+	}
+}
+
+void FEasyParticleState::CollectPaintBatches(FEasyParticlePaintBatcher& Batcher, FSlateWindowElementList& OutDrawElements, int32 LayerId)
+{
+	if (IsNeedPaint)
+	{
+		UpdateScalarParams();
+		if (!Batcher.AddParticle(*this, LayerId + ZOrder))
+		{
+			//The runs collected so far go first, to keep the paint order//
+			INC_DWORD_STAT_BY(STAT_UIParticleDrawElements, Batcher.Submit(OutDrawElements));
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId + ZOrder, PaintGeometryCache, &(this->ImageBrush), (ESlateDrawEffect)EmitterConfig->DrawEffect, PaintColorCache);
+			INC_DWORD_STAT(STAT_UIParticleDrawElements);
+		}
+	}
+
+	for (int32 i = 0; i < ChildrenParticleArray.Num(); i++)
+	{
+		for (int32 j = 0; j < ChildrenParticleArray[i].ChildrenParticle.Num(); j++)
+		{
+			ChildrenParticleArray[i].ChildrenParticle[j]->CollectPaintBatches(Batcher, OutDrawElements, LayerId);
+		}
+	}
+}
+
+void FEasyParticleState::UpdateScalarParams()
+{
+	const float CurLifetime = GetCurLifetime();
+	if (SelfAsset->ShareMaterialInstance)
+	{
+		//The instance is shared by the emitter, so the values of this particle go to its vertices//
+		for (int32 i = 0; i < SelfAsset->ScalarParams.Num() && i < MAX_VERTEX_SCALAR_PARAMS && i < ScalarParameterLerpKeys.Num(); i++)
 		{
-			UMaterialInstanceDynamic *DynMat = Cast<UMaterialInstanceDynamic>(ImageBrush.GetResourceObject());
-			if (DynMat)
+			VertexScalarParams[i] = SelfAsset->ScalarParams[i].GetValue(CurPercent, CurLifetime, RootSpanTime, ScalarParameterLerpKeys[i]);
+		}
+	}
+	else if (SelfAsset->ScalarParams.Num() > 0)
+	{
+		UMaterialInstanceDynamic *DynMat = Cast<UMaterialInstanceDynamic>(ImageBrush.GetResourceObject());
+		if (DynMat)
+		{
+			for (int32 i = 0; i < SelfAsset->ScalarParams.Num(); i++)
 			{
-				for (int32 i = 0; i < SelfAsset->ScalarParams.Num(); i++)
+				FScalarParamCurve& Param = SelfAsset->ScalarParams[i];
+				if (!Param.ScalarParamName.IsNone() && i < ScalarParameterLerpKeys.Num())
 				{
-					FScalarParamCurve& Param = SelfAsset->ScalarParams[i];
-					if (!Param.ScalarParamName.IsNone() && i < ScalarParameterLerpKeys.Num())
-					{
-						float ParamLerpKey = ScalarParameterLerpKeys[i];
-						DynMat->SetScalarParameterValue(Param.ScalarParamName, Param.GetValue(CurPercent, CurLifetime, RootSpanTime, ParamLerpKey));
-					}
+					float ParamLerpKey = ScalarParameterLerpKeys[i];
+					DynMat->SetScalarParameterValue(Param.ScalarParamName, Param.GetValue(CurPercent, CurLifetime, RootSpanTime, ParamLerpKey));
 				}
 			}
 		}
-		FSlateDrawElement::MakeBox(OutDrawElements, LayerId + ZOrder, PaintGeometryCache, &(this->ImageBrush), (ESlateDrawEffect)DrawEffect, PaintColorCache);
 	}
 }
 
@@ -766,17 +844,17 @@ void FEasyParticleState::CaculatePaintParams(const FPaintArgs& Args, const FGeom
 	}
 	if (!this->IsRoot && this->ImageBrush.DrawAs != ESlateBrushDrawType::NoDrawType && this->ImageBrush.GetResourceObject())
 	{
-		const FLinearColor FinalColorAndOpacity(InWidgetStyle.GetColorAndOpacityTint() * this->CurColor * this->ImageBrush.GetTint(InWidgetStyle));
+		const FLinearColor FinalColorAndOpacity(InWidgetStyle.GetColorAndOpacityTint() * this->GetCurColor() * this->ImageBrush.GetTint(InWidgetStyle));
 		FVector2D BasePos = FVector2D::ZeroVector;
-		if (PositionType == EPositionType::RELATIVE)
+		if (EmitterConfig->PositionType == EPositionType::RELATIVE)
 		{
 			BasePos = CurWidgetPosition;
 		}
-		else if (PositionType == EPositionType::FREE)
+		else if (EmitterConfig->PositionType == EPositionType::FREE)
 		{
 			BasePos = StartWidgetPositionWorld;
 		}
-		float Rotation = this->CurRotation / 180 * PI;
+		float Rotation = this->GetCurRotation() / 180 * PI;
 
 		const FSlateRenderTransform RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
 		float A, B, C, D;
@@ -790,12 +868,14 @@ void FEasyParticleState::CaculatePaintParams(const FPaintArgs& Args, const FGeom
 
 		FVector2D Scale2D = RenderTransform.GetMatrix().GetScale().GetVector();
 
-		FVector2D LocalPosition = this->CurPos - FVector2D(this->CurSizeX * Cosvalue - this->CurSizeY * Sinvalue, this->CurSizeY * Cosvalue + this->CurSizeX * Sinvalue) / 2;
+		const float CurSizeX = this->GetCurSizeX();
+		const float CurSizeY = this->GetCurSizeY();
+		FVector2D LocalPosition = this->GetCurPos() - FVector2D(CurSizeX * Cosvalue - CurSizeY * Sinvalue, CurSizeY * Cosvalue + CurSizeX * Sinvalue) / 2;
 		FVector2D WindowOffset = Args.GetWindowToDesktopTransform();
 
 		FVector2D FixPosition = AllottedGeometry.AbsoluteToLocal(LocalPosition * Scale2D + BasePos - WindowOffset);
 		FSlateLayoutTransform layouttransform = FSlateLayoutTransform(1.0, FixPosition);
-		FGeometry childgeometry = AllottedGeometry.MakeChild(FVector2D(this->CurSizeX, this->CurSizeY), layouttransform, tranform, CurPivot);
+		FGeometry childgeometry = AllottedGeometry.MakeChild(FVector2D(CurSizeX, CurSizeY), layouttransform, tranform, CurPivot);
 
 		if (!IsParticleEnd())
 		{
@@ -827,8 +907,7 @@ bool FEasyParticleState::IsEmitterEnd()
 			}
 			else
 			{
-				FTimespan span = FDateTime::Now() - ChildrenParticleArray[i].EmitterStartTime;
-				float spansecond = span.GetTotalMilliseconds() / 1000;
+				float spansecond = RootSpanTime - ChildrenParticleArray[i].EmitterStartTime;
 
 				int32 lod = UUIParticleUtility::GetLOD();
 				UUIParticleEmitterAsset* ChildrenAsset = ChildrenParticleArray[i].ChildrenAsset->GetLODAsset(lod);
@@ -910,18 +989,11 @@ FEasyParticleState::FEasyParticleState()
 {
 	SpawnParticleDeltaTime = 0;
 
-	CurLifetime = 0;
 	CurPercent = 0;
 	CurSize = 0;
-	CurSizeX = 0;
-	CurSizeY = 0;
-	CurRotation = 0;
 	CurAngle = 0;
 
-	CurSpeed = FVector2D(0, 0);
-	CurPos = FVector2D(0, 0);
 	CurPivot = FVector2D(0, 0);
-	CurColor = FLinearColor(0, 0, 0, 0);
 
 	CurDelay = 0;
 	RootSpanTime = 0;
@@ -941,12 +1013,7 @@ FEasyParticleState::FEasyParticleState()
 	DirectionScale = 0;
 	VerticalDirectionScale = 0;
 
-	EmitterType = EEmitterType::Curve;
-	PositionType = EPositionType::FREE;
-	DrawEffect = EParticleDrawEffect::None;
 	StartSpeed = FVector2D(0, 0);
-	FollowParentPosition = false;
-	FollowParentSpeedPercent = 0;
 
 	//LerpKey//
 	SizeLerpKey = 0;
@@ -1000,6 +1067,7 @@ FEasyParticleState::FEasyParticleState()
 	/***************Particle Info ,Set in Create*************/
 	ImageBrush.DrawAs = ESlateBrushDrawType::NoDrawType;
 	ParticleResource = nullptr;
+	VertexScalarParams = FVector2D(1, 1);
 	RootAsset = nullptr;
 	SelfAsset = nullptr;
 
@@ -1011,6 +1079,11 @@ FEasyParticleState::FEasyParticleState()
 	StartWidgetPositionWorld = FVector2D(0, 0);
 	ParentParticle = nullptr;
 	RootParticle = nullptr;
+
+	SimLanes = nullptr;
+	SimLaneIndex = INDEX_NONE;
+	IsIntegrationPending = false;
+	PendingDeltaTime = 0;
 }
 FEasyParticleState::~FEasyParticleState()
 {
@@ -1035,6 +1108,9 @@ FEasyParticleRootState::FEasyParticleRootState()
 {
 	FirstRootTick = false;
 	IsRoot = true;
+	EmitterConfig = MakeShareable(new FEasyParticleEmitterConfig());
+	SimLanes = &RootLane;
+	SimLaneIndex = RootLane.AddLane();
 }
 
 FEasyParticleRootState::~FEasyParticleRootState()
@@ -1072,21 +1148,22 @@ void FEasyParticleRootState::ResetRoot()
 	EmitPositionLerpKey = FMath::FRandRange(0, 1);
 	if (SelfAsset)
 	{
-		CurSpeed = StartSpeed;
+		SetCurSpeed(StartSpeed);
 		StartPositionLocal = SelfAsset->EmitPosition.GetValue(0, 0, RootSpanTime, EmitPositionLerpKey)* WholeScale;
 	}
 
+	const EEmitterType EmitterType = EmitterConfig->EmitterType;
 	if (EmitterType == EEmitterType::Gravity)
 	{
-		CurPos = SourcePos + StartPositionLocal;
+		SetCurPos(SourcePos + StartPositionLocal);
 	}
 	else if (EmitterType == EEmitterType::Radial)
 	{
-		CurPos = FVector2D(1, 0).GetRotated(ParticleEmitAngle)*Radius + StartPositionLocal;
+		SetCurPos(FVector2D(1, 0).GetRotated(ParticleEmitAngle)*Radius + StartPositionLocal);
 	}
 	else if (EmitterType == EEmitterType::Curve)
 	{
-		CurPos = SourcePos + StartPositionLocal + FVector2D(SelfAsset->PositionX.GetValue_Float(0, 0, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(0, 0, RootSpanTime, PositionYLerpKey))*WholeScale;
+		SetCurPos(SourcePos + StartPositionLocal + FVector2D(SelfAsset->PositionX.GetValue_Float(0, 0, RootSpanTime, PositionXLerpKey), SelfAsset->PositionY.GetValue_Float(0, 0, RootSpanTime, PositionYLerpKey))*WholeScale);
 	}
 	LayerOrder = 0;
 	Deadtime = ROOTLIFE;
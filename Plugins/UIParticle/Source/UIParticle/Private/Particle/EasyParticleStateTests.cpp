@@ -0,0 +1,294 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#include "Particle/EasyParticleState.h"
+#include "UIParticlePrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Utility/UIParticleUtility.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//Headless runs: UE4Editor-Cmd [Project] -nullrhi -ExecCmds="Automation RunTests UIParticle.Simulation;Quit"//
+
+namespace EasyParticleStateTests
+{
+	//What one run of an emitter produced, frame by frame//
+	struct FReplayRecord
+	{
+		TArray<int32> SpawnCounts;
+		TArray<int32> ParticleCounts;
+		TArray<FVector2D> Positions;
+	};
+
+	//Gravity emitter going through every term of the integration: gravity, radial acceleration, air resistance and sine offset//
+	UUIParticleEmitterAsset* CreateGravityEmitter(float SpawnPerSecond = 120, float MaxCount = 150)
+	{
+		UUIParticleEmitterAsset* Asset = NewObject<UUIParticleEmitterAsset>();
+		Asset->EmitterType = EEmitterType::Gravity;
+		Asset->EmitSeconds = -1;
+		Asset->SpawnParticlePerSecond.FloatValue = SpawnPerSecond;
+		Asset->MaxParticleCount.FloatValue = MaxCount;
+		Asset->LifeSpan.Type = EUIParticlePropertyType::FloatRange;
+		Asset->Gravity.Vector2DValue = FVector2D(0, 200);
+		Asset->AirResistance.FloatValue = 0.5f;
+		Asset->RadialAcceleration.FloatValue = 30;
+		Asset->SineDirectionSpeed.FloatValue = 4;
+		Asset->SineDirectionRange.FloatValue = 0.2f;
+		Asset->BakeCurveTables();
+		return Asset;
+	}
+
+	//Same steps as SUIParticleEmitter::Tick//
+	void TickRoot(FEasyParticleRootState* Root, float DeltaTime, const FGeometry& Geometry)
+	{
+		if (Root->FirstRootTick)
+		{
+			Root->FirstTick(DeltaTime, Geometry);
+		}
+		FUIParticleFactory::Instance()->TickRoot(Root, DeltaTime, Geometry);
+		Root->TrySpawnParticle(Geometry);
+	}
+
+	void Replay(UUIParticleEmitterAsset* Asset, const TArray<float>& DeltaTimes, FReplayRecord& OutRecord)
+	{
+		//The lerp keys of the particles come from the global random stream//
+		FMath::RandInit(0x5EED);
+
+		//Not referenced by the factory, so the pools of the root go away with it//
+		TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe> Root = MakeShareable(new FEasyParticleRootState());
+		Root->InitRoot(Asset, 0);
+
+		const FGeometry Geometry = FGeometry::MakeRoot(FVector2D(400, 400), FSlateLayoutTransform());
+		for (float DeltaTime : DeltaTimes)
+		{
+			TickRoot(Root.Get(), DeltaTime, Geometry);
+
+			FEasyParticleChildEmitterArray& Emitter = Root->ChildrenParticleArray[0];
+			OutRecord.SpawnCounts.Add(Emitter.CountToSpawn);
+			OutRecord.ParticleCounts.Add(Root->GetChildrenParticleCount());
+			for (FEasyParticleState* Particle : Emitter.ChildrenParticle)
+			{
+				if (!Particle->IsInPool())
+				{
+					OutRecord.Positions.Add(Particle->GetCurPos());
+				}
+			}
+		}
+	}
+}
+
+
+/**
+ * Ticks the same emitter twice with the same irregular delta times.
+ * The simulation only depends on the delta times it is given, so both runs must emit the same particles at the same positions.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyParticleReplayTest, "UIParticle.Simulation.DeterministicReplay",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEasyParticleReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyParticleStateTests;
+
+	TArray<float> DeltaTimes;
+	for (int32 Frame = 0; Frame < 240; Frame++)
+	{
+		//Between 8 and 20 milliseconds//
+		DeltaTimes.Add(0.008f + 0.003f * ((Frame * 7) % 5));
+	}
+
+	const bool MultiThread = UUIParticleUtility::GetMultiThread();
+	UUIParticleUtility::SetMultiThread(false);
+
+	UUIParticleEmitterAsset* Asset = CreateGravityEmitter();
+	FReplayRecord First;
+	FReplayRecord Second;
+	Replay(Asset, DeltaTimes, First);
+	Replay(Asset, DeltaTimes, Second);
+
+	UUIParticleUtility::SetMultiThread(MultiThread);
+
+	TestTrue(TEXT("Particles were emitted"), First.Positions.Num() > 0);
+	TestTrue(TEXT("Same spawn counts"), First.SpawnCounts == Second.SpawnCounts);
+	TestTrue(TEXT("Same particle counts"), First.ParticleCounts == Second.ParticleCounts);
+
+	if (TestEqual(TEXT("Same number of positions"), Second.Positions.Num(), First.Positions.Num()))
+	{
+		for (int32 i = 0; i < First.Positions.Num(); i++)
+		{
+			if (First.Positions[i] != Second.Positions[i])
+			{
+				AddError(FString::Printf(TEXT("Position %d differs: %s then %s"), i, *First.Positions[i].ToString(), *Second.Positions[i].ToString()));
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * Times the update of the same emitter with a few thousand particles and reports the cost per particle update.
+ * The particles used to read FDateTime::Now() on every update, so the cost of that many calls is reported along, as the cost removed.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyParticleUpdateBenchTest, "UIParticle.Simulation.UpdateBench",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::StressFilter)
+
+bool FEasyParticleUpdateBenchTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyParticleStateTests;
+
+	const int32 MaxCounts[] = { 1000, 5000 };
+	const float DeltaTime = 1.0f / 60;
+	const int32 WarmupFrames = 120;
+	const int32 TimedFrames = 240;
+
+	const bool MultiThread = UUIParticleUtility::GetMultiThread();
+	UUIParticleUtility::SetMultiThread(false);
+
+	const FGeometry Geometry = FGeometry::MakeRoot(FVector2D(400, 400), FSlateLayoutTransform());
+	for (int32 MaxCount : MaxCounts)
+	{
+		FMath::RandInit(0x5EED);
+		UUIParticleEmitterAsset* Asset = CreateGravityEmitter(MaxCount * 2, MaxCount);
+
+		//Not referenced by the factory, so the pools of the root go away with it//
+		TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe> Root = MakeShareable(new FEasyParticleRootState());
+		Root->InitRoot(Asset, 0);
+		for (int32 Frame = 0; Frame < WarmupFrames; Frame++)
+		{
+			TickRoot(Root.Get(), DeltaTime, Geometry);
+		}
+
+		int64 ParticleUpdates = 0;
+		double UpdateSeconds = 0;
+		for (int32 Frame = 0; Frame < TimedFrames; Frame++)
+		{
+			ParticleUpdates += Root->GetChildrenParticleCount();
+			double Start = FPlatformTime::Seconds();
+			TickRoot(Root.Get(), DeltaTime, Geometry);
+			UpdateSeconds += FPlatformTime::Seconds() - Start;
+		}
+
+		//What the particles called before driving the sine offset from the emitter clock//
+		double Start = FPlatformTime::Seconds();
+		int64 Checksum = 0;
+		for (int64 i = 0; i < ParticleUpdates; i++)
+		{
+			Checksum += FDateTime::Now().GetMillisecond();
+		}
+		double ClockSeconds = FPlatformTime::Seconds() - Start;
+
+		//Also keeps the clock calls from being optimized away//
+		if (!TestTrue(FString::Printf(TEXT("%d particles: particles were updated"), MaxCount), ParticleUpdates > 0 && Checksum >= 0))
+		{
+			continue;
+		}
+
+		const double UpdateNanoseconds = UpdateSeconds * 1000000000.0 / ParticleUpdates;
+		const double ClockNanoseconds = ClockSeconds * 1000000000.0 / ParticleUpdates;
+		AddInfo(FString::Printf(TEXT("%5d particles: %8.1f ns per particle update, FDateTime::Now() removed %8.1f ns per particle update"),
+			MaxCount, UpdateNanoseconds, ClockNanoseconds));
+	}
+
+	UUIParticleUtility::SetMultiThread(MultiThread);
+
+	return true;
+}
+
+
+/**
+ * Plays two emitters of a material with a scalar param and a random start scalar param, with and without ShareMaterialInstance.
+ * Shared, the emitters must create one material instance each whatever their particle count, and each particle must still
+ * get its own start value in the vertex slot after the scalar param. Not shared, every particle has its own instance.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyParticleSharedMaterialTest, "UIParticle.Simulation.SharedMaterialInstances",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEasyParticleSharedMaterialTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyParticleStateTests;
+
+	UMaterialInterface* Material = UMaterial::GetDefaultMaterial(MD_UI);
+	if (!TestNotNull(TEXT("Default UI material"), Material))
+	{
+		return true;
+	}
+
+	const int32 NumEmitters = 2;
+	const bool MultiThread = UUIParticleUtility::GetMultiThread();
+	UUIParticleUtility::SetMultiThread(false);
+
+	const FGeometry Geometry = FGeometry::MakeRoot(FVector2D(400, 400), FSlateLayoutTransform());
+	for (bool Share : { true, false })
+	{
+		UUIParticleEmitterAsset* Asset = CreateGravityEmitter();
+		Asset->ResourceObject = Material;
+		Asset->ShareMaterialInstance = Share;
+
+		FScalarParamCurve TickParam;
+		TickParam.ScalarParamName = TEXT("Fade");
+		TickParam.Value.Type = EUIParticlePropertyType::Float;
+		TickParam.Value.FloatValue = 0.5f;
+		Asset->ScalarParams.Add(TickParam);
+
+		FScalarParamCurve StartParam;
+		StartParam.ScalarParamName = TEXT("Seed");
+		StartParam.Value.Type = EUIParticlePropertyType::FloatRange;
+		StartParam.Value.FloatRangeValue.Min = 0;
+		StartParam.Value.FloatRangeValue.Max = 1;
+		Asset->ScalarParamsWhenStart.Add(StartParam);
+		Asset->BakeCurveTables();
+
+		TSet<UObject*> Instances;
+		TSet<float> StartValues;
+		int32 ParticleCount = 0;
+
+		TArray<TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe>> Roots;
+		for (int32 i = 0; i < NumEmitters; i++)
+		{
+			//Not referenced by the factory, so the pools of the roots go away with them//
+			TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe> Root = MakeShareable(new FEasyParticleRootState());
+			Root->InitRoot(Asset, 0);
+			for (int32 Frame = 0; Frame < 60; Frame++)
+			{
+				TickRoot(Root.Get(), 1.0f / 60, Geometry);
+			}
+
+			for (FEasyParticleState* Particle : Root->ChildrenParticleArray[0].ChildrenParticle)
+			{
+				if (!Particle->IsInPool())
+				{
+					ParticleCount++;
+					Instances.Add(Particle->ParticleResource);
+					StartValues.Add(Particle->VertexScalarParams.Y);
+				}
+			}
+			Roots.Add(Root);
+		}
+
+		const TCHAR* Name = Share ? TEXT("Shared") : TEXT("Not shared");
+		if (!TestTrue(FString::Printf(TEXT("%s: %d particles"), Name, ParticleCount), ParticleCount > 10 * NumEmitters))
+		{
+			continue;
+		}
+		if (Share)
+		{
+			TestEqual(FString::Printf(TEXT("%s: material instances for %d emitters"), Name, NumEmitters), Instances.Num(), NumEmitters);
+			TestTrue(FString::Printf(TEXT("%s: %d different start values"), Name, StartValues.Num()), StartValues.Num() > ParticleCount / 2);
+		}
+		else
+		{
+			TestEqual(FString::Printf(TEXT("%s: material instances for %d particles"), Name, ParticleCount), Instances.Num(), ParticleCount);
+		}
+	}
+
+	UUIParticleUtility::SetMultiThread(MultiThread);
+
+	return true;
+}
+
+#endif
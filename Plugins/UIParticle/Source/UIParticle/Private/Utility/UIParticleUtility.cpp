@@ -6,6 +6,7 @@
 #include "Utility/UIParticleUtility.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 #define MIN_COUNT_FOR_MULTITHREAD 200
 #define COUNT_PARALLEL 100
@@ -13,6 +14,13 @@
 #define MIN_COUNT_FOR_MULTITHREAD_PAINT 1000
 #define COUNT_PARALLEL_PAINT 500
 
+static TAutoConsoleVariable<int32> CVarUIParticleBatchedPaint(
+	TEXT("UIParticle.BatchedPaint"),
+	1,
+	TEXT("1: the particles of an emitter are drawn with one custom verts element per run of consecutive particles with the same layer, resource and draw effect.\n")
+	TEXT("0: one box element per particle."),
+	ECVF_Default);
+
 int32 UUIParticleUtility::LevelOfDetail = -1;
 bool UUIParticleUtility::Multi_Thread = false;
 FUIParticleFactory* FUIParticleFactory::m_Instance = nullptr;
@@ -138,24 +146,36 @@ void FUIParticleFactory::OnRootDestroy(FEasyParticleRootState* RootPtr)
 	ClearChildren(RootPtr);
 }
 
-void FUIParticleFactory::AddReferencedMaterialInstances(FEasyParticleState* Emitter, FReferenceCollector& Collector)
+int32 FUIParticleFactory::AddReferencedMaterialInstances(FEasyParticleState* Emitter, FReferenceCollector& Collector)
 {
+	int32 Count = 0;
 	if (Emitter)
 	{
-		if (Cast<UMaterialInstanceDynamic>(Emitter->ParticleResource))
-			Collector.AddReferencedObject(Emitter->ParticleResource);
-		for (auto ChildrenArray : Emitter->ChildrenParticleArray)
+		for (auto& ChildrenArray : Emitter->ChildrenParticleArray)
 		{
+			if (ChildrenArray.SharedMaterialInstance)
+			{
+				Collector.AddReferencedObject(ChildrenArray.SharedMaterialInstance);
+				Count++;
+			}
 			for (auto ChildrenParticle : ChildrenArray.ChildrenParticle)
 			{
-				AddReferencedMaterialInstances(ChildrenParticle, Collector);
+				//The shared instance is only counted once//
+				if (ChildrenParticle && Cast<UMaterialInstanceDynamic>(ChildrenParticle->ParticleResource) && ChildrenParticle->ParticleResource != ChildrenArray.SharedMaterialInstance)
+				{
+					Collector.AddReferencedObject(ChildrenParticle->ParticleResource);
+					Count++;
+				}
+				Count += AddReferencedMaterialInstances(ChildrenParticle, Collector);
 			}
 		}
 	}
+	return Count;
 }
 
 void FUIParticleFactory::AddReferencedObjects(FReferenceCollector& Collector)
 {
+	int32 ObjectCount = 0;
 	for (int32 i = ParticleRefArray.Num()-1; i >= 0 ; i--)
 	{
 		if (ParticleRefArray[i].IsValid() && !ParticleRefArray[i].IsUnique())
@@ -163,18 +183,26 @@ void FUIParticleFactory::AddReferencedObjects(FReferenceCollector& Collector)
 			if (ParticleRefArray[i]->RootAsset)
 			{
 				Collector.AddReferencedObject(ParticleRefArray[i]->RootAsset);
+				ObjectCount++;
 			}
 			if (ParticleRefArray[i]->SelfAsset)
 			{
 				Collector.AddReferencedObject(ParticleRefArray[i]->SelfAsset);
+				ObjectCount++;
 			}
-			AddReferencedMaterialInstances(ParticleRefArray[i].Get(), Collector);
+			if (Cast<UMaterialInstanceDynamic>(ParticleRefArray[i]->ParticleResource))
+			{
+				Collector.AddReferencedObject(ParticleRefArray[i]->ParticleResource);
+				ObjectCount++;
+			}
+			ObjectCount += AddReferencedMaterialInstances(ParticleRefArray[i].Get(), Collector);
 		}
 		else
 		{
 			ParticleRefArray.RemoveAt(i);
 		}
 	}
+	SET_DWORD_STAT(STAT_UIParticleGCObjects, ObjectCount);
 }
 
 int32 FUIParticleFactory::GetChildrenCount(FEasyParticleRootState* RootPtr)
@@ -327,11 +355,39 @@ void FUIParticleFactory::ParallelTick(FEasyParticleRootState* RootPtr, const flo
 					FGraphEventRef Join = TGraphTask<FNullGraphTask>::CreateTask(&Tasks, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(TStatId(), ENamedThreads::AnyThread);
 					FTaskGraphInterface::Get().WaitUntilTaskCompletes(Join, ENamedThreads::GameThread_Local);
 				}
+				IntegratePool(ParticlePoolPtr, true);
 			}
 		}
 	}
 }
 
+void FUIParticleFactory::IntegratePool(FEasyParticleStatePool* ParticlePoolPtr, bool bParallel)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UIParticleIntegrate);
+	FEasyParticleSimLanes& SimLanes = ParticlePoolPtr->SimLanes;
+	int32 LaneCount = SimLanes.Num();
+
+	if (!bParallel || LaneCount <= MIN_COUNT_FOR_MULTITHREAD)
+	{
+		EasyParticleSimulation::Integrate(SimLanes, 0, LaneCount);
+		ParticlePoolPtr->ApplyPendingIntegration(0, LaneCount);
+	}
+	else
+	{
+		//Finishing the update evaluates curves too, so it stays on the worker threads like the tick//
+		int32 TaskCount = FMath::DivideAndRoundUp(LaneCount, COUNT_PARALLEL);
+		ParallelFor(TaskCount,
+			[&SimLanes, ParticlePoolPtr, LaneCount](int32 Index)
+		{
+			int32 StartIndex = Index * COUNT_PARALLEL;
+			int32 EndIndex = FMath::Min(StartIndex + COUNT_PARALLEL, LaneCount);
+			EasyParticleSimulation::Integrate(SimLanes, StartIndex, EndIndex);
+			ParticlePoolPtr->ApplyPendingIntegration(StartIndex, EndIndex);
+		}
+		);
+	}
+}
+
 void FUIParticleFactory::Tick(FEasyParticleRootState* RootPtr, const float InDeltaTime, const FGeometry& AllottedGeometry)
 {
 	if (RootPtr == nullptr)
@@ -364,6 +420,7 @@ void FUIParticleFactory::Tick(FEasyParticleRootState* RootPtr, const float InDel
 				{
 					(*ParticlePoolPtr)[i]->TickSelf(InDeltaTime, AllottedGeometry, CurWidgetPosition, CurWidgetRotation, WholeScale, RootSpanTime);
 				}
+				IntegratePool(ParticlePoolPtr, false);
 			}
 		}
 	}
@@ -450,7 +507,17 @@ void FUIParticleFactory::OnRootPaint(FEasyParticleRootState* RootPtr, const FPai
 		}
 	}
 	*/
-	RootPtr->OnPaint( Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+	if (CVarUIParticleBatchedPaint.GetValueOnGameThread() != 0)
+	{
+		PaintBatcher.Reset();
+		RootPtr->CollectPaintBatches(PaintBatcher, OutDrawElements, LayerId);
+		int32 ElementCount = PaintBatcher.Submit(OutDrawElements);
+		INC_DWORD_STAT_BY(STAT_UIParticleDrawElements, ElementCount);
+	}
+	else
+	{
+		RootPtr->OnPaint( Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+	}
 }
 
 void FUIParticleFactory::OnPaint(FEasyParticleRootState* RootPtr, const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled)
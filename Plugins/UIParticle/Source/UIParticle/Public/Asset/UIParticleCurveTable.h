@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+
+/**
+ * A FRichCurve sampled at evenly spaced times between its first and last key.
+ * Evaluating inside that range is an index and a lerp, outside of it (extrapolation) it falls back to the curve.
+ * The samples are only kept if the lerp stays within "UIParticle.CurveTable.MaxError" of the curve,
+ * otherwise (e.g. constant keys) the curve is always evaluated.
+ * The table lives in the asset next to its curve, so every particle of the asset shares it.
+ */
+struct UIPARTICLE_API FUIParticleCurveTable
+{
+	FUIParticleCurveTable()
+		: MinTime(0)
+		, MaxTime(0)
+		, InvStep(0)
+		, HasTimeRange(false)
+	{
+	}
+
+	/** Samples the curve, must be called again whenever the curve changes */
+	void Bake(const FRichCurve& Curve, float DefaultValue);
+	void Empty();
+
+	bool IsBaked() const
+	{
+		return Values.Num() > 0;
+	}
+
+	/** Time of the last key, as FRichCurve::GetTimeRange returns it. Only valid after Bake */
+	bool GetMaxTime(float& OutMaxTime) const
+	{
+		OutMaxTime = MaxTime;
+		return HasTimeRange;
+	}
+
+	/** Same as Curve.Eval(InTime, DefaultValue), Curve being the curve the table was baked from */
+	FORCEINLINE float Eval(const FRichCurve& Curve, float InTime, float DefaultValue) const
+	{
+		if (Values.Num() > 0 && InTime >= MinTime && InTime <= MaxTime)
+		{
+			float Position = (InTime - MinTime) * InvStep;
+			int32 Index = FMath::Min((int32)Position, Values.Num() - 2);
+			return FMath::Lerp(Values[Index], Values[Index + 1], Position - Index);
+		}
+		return Curve.Eval(InTime, DefaultValue);
+	}
+
+private:
+	/** Samples the curve with the given number of samples, returns a bound of the largest difference between the table and the curve */
+	float Sample(const FRichCurve& Curve, float DefaultValue, int32 Resolution);
+
+	TArray<float> Values;
+	float MinTime;
+	float MaxTime;
+	float InvStep;
+	bool HasTimeRange;
+};
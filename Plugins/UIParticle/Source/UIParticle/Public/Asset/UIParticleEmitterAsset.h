@@ -4,6 +4,7 @@
 #include "Curves/CurveVector.h"
 #include "Curves/CurveLinearColor.h"
 #include "Curves/CurveFloat.h"
+#include "Asset/UIParticleCurveTable.h"
 #include "UIParticleEmitterAsset.generated.h"
 
 class UUIParticleEmitterAsset;
@@ -70,14 +71,34 @@ struct FUIParticleFloatCurve
 	UPROPERTY(EditAnywhere, Category = Particle)
 		bool Loop;
 
+	//Baked from CurveData by UUIParticleEmitterAsset::BakeCurveTables//
+	FUIParticleCurveTable Table;
+
 	void Reset()
 	{
 		Loop = false;
 		CurveType = ECurveType::EmitLifeTime;
 		CurveData.Reset();
 		CurveData.SetDefaultValue(0);
+		Table.Empty();
 	};
 
+	void Bake()
+	{
+		Table.Bake(CurveData, 0);
+	}
+
+	float GetLoopTime() const
+	{
+		float MinTime;
+		float MaxTime;
+		if (!Table.GetMaxTime(MaxTime))
+		{
+			CurveData.GetTimeRange(MinTime, MaxTime);
+		}
+		return MaxTime;
+	}
+
 	float GetValue(float InParticleLifePercent , float InParticleTime , float EmitTime) const
 	{
 		float Ret = 0;
@@ -85,26 +106,24 @@ struct FUIParticleFloatCurve
 		{
 			case ECurveType::ParticleLifePercent:
 			{
-				Ret = CurveData.Eval(InParticleLifePercent, 0);
+				Ret = Table.Eval(CurveData, InParticleLifePercent, 0);
 				break;
 			}
 			case ECurveType::ParticleLifeTime:
 			{
 				if (Loop)
 				{
-					float MinTime;
-					float MaxTime;
-					CurveData.GetTimeRange(MinTime, MaxTime);
+					float MaxTime = GetLoopTime();
 					float curvetime = 0;
 					if (MaxTime > 0)
 					{
 						curvetime = FMath::Fmod(InParticleTime, MaxTime);
 					}
-					Ret = CurveData.Eval(curvetime, 0);
+					Ret = Table.Eval(CurveData, curvetime, 0);
 				}
 				else
 				{
-					Ret = CurveData.Eval(InParticleTime, 0);
+					Ret = Table.Eval(CurveData, InParticleTime, 0);
 				}
 				break;
 			}
@@ -112,19 +131,17 @@ struct FUIParticleFloatCurve
 			{		
 				if (Loop)
 				{
-					float MinTime;
-					float MaxTime;
-					CurveData.GetTimeRange(MinTime, MaxTime);
+					float MaxTime = GetLoopTime();
 					float curvetime = 0;
 					if (MaxTime > 0)
 					{
 						curvetime = FMath::Fmod(EmitTime, MaxTime);
 					}
-					Ret = CurveData.Eval(curvetime, 0);
+					Ret = Table.Eval(CurveData, curvetime, 0);
 				}
 				else
 				{
-					Ret = CurveData.Eval(EmitTime, 0);
+					Ret = Table.Eval(CurveData, EmitTime, 0);
 				}
 				break;
 			}
@@ -214,6 +231,12 @@ struct FRange_FloatCurve
 		Max.Reset();
 	};
 
+	void Bake()
+	{
+		Min.Bake();
+		Max.Bake();
+	};
+
 };
 
 USTRUCT()
@@ -232,9 +255,38 @@ public:
 
 
 
+	//Baked from ColorCurves by UUIParticleEmitterAsset::BakeCurveTables//
+	FUIParticleCurveTable Tables[4];
+
+	void Bake()
+	{
+		for (int32 i = 0; i < 4; i++)
+		{
+			Tables[i].Bake(ColorCurves[i], 1);
+		}
+	}
+
+	float GetLoopTime() const
+	{
+		float MaxTime = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			float Min, Max;
+			if (!Tables[i].GetMaxTime(Max))
+			{
+				ColorCurves[i].GetTimeRange(Min, Max);
+			}
+			if (Max > MaxTime)
+			{
+				MaxTime = Max;
+			}
+		}
+		return MaxTime;
+	}
+
 	FLinearColor GetValueInner(float InTime) const
 	{
-		return FLinearColor(ColorCurves[0].Eval(InTime, 1), ColorCurves[1].Eval(InTime, 1), ColorCurves[2].Eval(InTime, 1), ColorCurves[3].Eval(InTime, 1));
+		return FLinearColor(Tables[0].Eval(ColorCurves[0], InTime, 1), Tables[1].Eval(ColorCurves[1], InTime, 1), Tables[2].Eval(ColorCurves[2], InTime, 1), Tables[3].Eval(ColorCurves[3], InTime, 1));
 	}
 
 	FLinearColor GetValue(float InParticleLifePercent, float InParticleTime, float InEmitTime) const
@@ -251,18 +303,7 @@ public:
 			{
 				if (Loop)
 				{
-					float MinTime=0;
-					float MaxTime=0;
-
-					for (int32 i = 0; i < 4; i++)
-					{
-						float Min,Max;
-						ColorCurves[i].GetTimeRange(Min, Max);
-						if (Max > MaxTime)
-						{
-							MaxTime = Max;
-						}
-					}
+					float MaxTime = GetLoopTime();
 					float curvetime = 0;
 					if (MaxTime > 0)
 					{
@@ -280,18 +321,7 @@ public:
 			{
 				if (Loop)
 				{
-					float MinTime = 0;
-					float MaxTime = 0;
-
-					for (int32 i = 0; i < 4; i++)
-					{
-						float Min, Max;
-						ColorCurves[i].GetTimeRange(Min, Max);
-						if (Max > MaxTime)
-						{
-							MaxTime = Max;
-						}
-					}
+					float MaxTime = GetLoopTime();
 					float curvetime = 0;
 					if (MaxTime > 0)
 					{
@@ -314,6 +344,7 @@ public:
 		for (int32 i = 0; i < 4; i++)
 		{
 			ColorCurves[i].Reset();
+			Tables[i].Empty();
 		}
 		CurveType = ECurveType::EmitLifeTime;
 		Loop = false;
@@ -387,6 +418,12 @@ struct FRange_LinearColorCurve
 		RandomKey_G_A = false;
 		RandomKey_B_A = false;
 	};
+
+	void Bake()
+	{
+		Min.Bake();
+		Max.Bake();
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -586,6 +623,38 @@ struct FUIParticleProperty
 		LinearColorCurveRangeValue.Reset();
 	}
 
+	//Bakes the curves of the current Type, the other ones are not evaluated//
+	void BakeCurveTables()
+	{
+		FloatCurveValue.Table.Empty();
+		FloatCurveRangeValue.Min.Table.Empty();
+		FloatCurveRangeValue.Max.Table.Empty();
+		for (int32 i = 0; i < 4; i++)
+		{
+			LinearColorCurveValue.Tables[i].Empty();
+			LinearColorCurveRangeValue.Min.Tables[i].Empty();
+			LinearColorCurveRangeValue.Max.Tables[i].Empty();
+		}
+
+		switch (Type)
+		{
+			case EUIParticlePropertyType::FloatCurve:
+				FloatCurveValue.Bake();
+				break;
+			case EUIParticlePropertyType::FloatCurveRange:
+				FloatCurveRangeValue.Bake();
+				break;
+			case EUIParticlePropertyType::LinearColorCurve:
+				LinearColorCurveValue.Bake();
+				break;
+			case EUIParticlePropertyType::LinearColorCurveRange:
+				LinearColorCurveRangeValue.Bake();
+				break;
+			default:
+				break;
+		}
+	}
+
 	FLinearColor GetValue_Color(float InParticleLifePercent, float InParticleTime, float InEmitTime, FLerpKeyColor LerpKey)
 	{
 		FLinearColor Ret;
@@ -913,6 +982,11 @@ public:
 	//Very expensive. Change material scalarparam when start,set scalarparem "LifeSpan" when start
 	UPROPERTY(EditAnywhere, Category = Experimentation)
 		TArray<FScalarParamCurve> ScalarParamsWhenStart;
+	//The particles of an emitter share one material instance and can be drawn together.
+	//The ScalarParams then the ScalarParamsWhenStart of each particle go, in order, to the zw of the vertex texture coordinates
+	//instead of the material (needs UIParticle.BatchedPaint). There are two slots, the parameters past them are lost.
+	UPROPERTY(EditAnywhere, Category = Experimentation)
+		bool ShareMaterialInstance;
 
     UPROPERTY(EditAnywhere, Category = Experimentation)
         EParticleDrawEffect DrawEffect;
@@ -947,6 +1021,20 @@ public:
 	UPROPERTY(EditAnywhere, Category = Experimentation)
 		TArray<UUIParticleEmitterAsset*> LevelOfDetail;
 
+	//UObject Interface//
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+	//Number of scalar params with no vertex slot left when the material instance is shared//
+	int32 GetLostVertexScalarParamCount() const;
+
+	//Samples every curve into the tables the particles read, called when the asset is loaded or edited//
+	void BakeCurveTables();
+
 	void Reset()
 	{
 		AutoPlay = false;
@@ -995,6 +1083,7 @@ public:
 
 		ScalarParams.Empty();
 		ScalarParamsWhenStart.Empty();
+		ShareMaterialInstance = false;
 		DrawEffect = EParticleDrawEffect::None;
 
 		UseScaleFollowSpeedDirection = false;
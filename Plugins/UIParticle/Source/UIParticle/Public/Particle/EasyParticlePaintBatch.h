@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Rendering/RenderingCommon.h"
+#include "Rendering/DrawElements.h"
+
+class FEasyParticleState;
+
+/**
+ * Collects the quads of the particles of an emitter and draws them with one FSlateDrawElement::MakeCustomVerts
+ * per run of consecutive particles sharing layer, resource and draw effect, instead of one MakeBox per particle.
+ * Only the last run can grow, so the particles are drawn in paint order even when resources alternate in a layer.
+ */
+class FEasyParticlePaintBatcher
+{
+public:
+	FEasyParticlePaintBatcher();
+
+	void Reset();
+
+	/** Adds the quad of a particle whose paint params are computed. Returns false if the particle can't be batched */
+	bool AddParticle(const FEasyParticleState& Particle, int32 Layer);
+
+	/** Adds one draw element per batch and empties the batches, returns the number of elements added */
+	int32 Submit(FSlateWindowElementList& OutDrawElements);
+
+private:
+	struct FBatchKey
+	{
+		int32 Layer;
+		UObject* Resource;
+		ESlateDrawEffect DrawEffect;
+
+		bool operator==(const FBatchKey& Other) const
+		{
+			return Layer == Other.Layer && Resource == Other.Resource && DrawEffect == Other.DrawEffect;
+		}
+	};
+
+	struct FBatch
+	{
+		FBatchKey Key;
+		FSlateResourceHandle ResourceHandle;
+		FVector2D StartUV;
+		FVector2D SizeUV;
+		TArray<FSlateVertex> Vertices;
+		TArray<SlateIndex> Indices;
+	};
+
+	/** Returns the last batch if the particle continues its run, else a new one, or null if its resource can't be drawn */
+	FBatch* FindOrAddBatch(const FBatchKey& Key, const FSlateBrush& Brush);
+
+	//Kept from one paint to the next, so the vertex arrays keep their memory//
+	TArray<FBatch> Batches;
+	int32 NumBatches;
+};
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2019, RedStarStudio, All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Hot state of the particles of one pool, one lane per particle of the pool.
+ * Every field is its own array, so the integration runs over contiguous floats, four particles at a time.
+ * The lanes are where the particles keep their position, speed, age, rotation, size and color (see FEasyParticleState::GetCurPos),
+ * nothing is copied in or out around the integration: a particle only writes the step of its Gravity update,
+ * and the pool integrates all lanes at once.
+ */
+struct FEasyParticleSimLanes
+{
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> SpeedX;
+	TArray<float> SpeedY;
+	TArray<float> Lifetime;
+	TArray<float> Rotation;
+	TArray<float> SizeX;
+	TArray<float> SizeY;
+	TArray<float> ColorR;
+	TArray<float> ColorG;
+	TArray<float> ColorB;
+	TArray<float> ColorA;
+
+	/**********Step, written by the Gravity update***********/
+	//Gravity + RadialAcceleration + TangentialAcceleration//
+	TArray<float> AccelerationX;
+	TArray<float> AccelerationY;
+	TArray<float> AirResistance;
+
+	//Length of the sine offset, applied perpendicular to the speed//
+	TArray<float> SineOffset;
+	TArray<float> DeltaTime;
+
+	//Scale of the position step (WholeScale)//
+	TArray<float> PosScale;
+
+	int32 AddLane();
+	//Leaves the lane unchanged by the next integrations, until a new step is written//
+	void ClearStep(int32 Index);
+	int32 Num() const
+	{
+		return PosX.Num();
+	}
+};
+
+namespace EasyParticleSimulation
+{
+	/** Integrates the lanes [StartIndex, EndIndex) */
+	void Integrate(FEasyParticleSimLanes& Lanes, int32 StartIndex, int32 EndIndex);
+
+	/** Same step as Integrate, for a particle that has no lane */
+	void IntegrateParticle(FVector2D& Pos, FVector2D& Speed, const FVector2D& Acceleration, float AirResistance, float SineOffset, float DeltaTime, float PosScale);
+}
@@ -3,19 +3,40 @@
 #pragma once
 #include "Asset/UIParticleAsset.h"
 #include "Widgets/Images/SImage.h"
+#include "Particle/EasyParticleSimulation.h"
 
 class FEasyParticleState;
 class FEasyParticleRootState;
+class FEasyParticlePaintBatcher;
+class UMaterialInstanceDynamic;
 
 DECLARE_CYCLE_STAT(TEXT("UIParticle Tick"), STAT_UIParticleTickTime, STATGROUP_Slate);
+DECLARE_CYCLE_STAT(TEXT("UIParticle Integrate"), STAT_UIParticleIntegrate, STATGROUP_Slate);
 DECLARE_CYCLE_STAT(TEXT("UIParticle OnPaint"), STAT_UIParticleOnPaintTime, STATGROUP_Slate);
 DECLARE_CYCLE_STAT(TEXT("UIParticle SpawnParticle"), STAT_UIParticleSpawnParticle, STATGROUP_Slate);
 DECLARE_DWORD_COUNTER_STAT(TEXT("UIParticle Count"), STAT_UIParticleCount, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UIParticle Draw Elements"), STAT_UIParticleDrawElements, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UIParticle Material Instances Created"), STAT_UIParticleMaterialInstancesCreated, STATGROUP_Slate);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("UIParticle GC Objects"), STAT_UIParticleGCObjects, STATGROUP_Slate);
+
+//ScalarParams a particle can carry in its vertices when it shares the material instance of its emitter//
+#define MAX_VERTEX_SCALAR_PARAMS 2
+
+//Settings shared by all the particles an emitter spawns, kept out of the particles//
+struct FEasyParticleEmitterConfig
+{
+	EEmitterType EmitterType = EEmitterType::Curve;
+	EPositionType PositionType = EPositionType::FREE;
+	EParticleDrawEffect DrawEffect = EParticleDrawEffect::None;
+	bool FollowParentPosition = false;
+	float FollowParentSpeedPercent = 0;
+};
 
 struct FEasyParticleChildEmitterArray
 {
 	UUIParticleEmitterAsset* ChildrenAsset;
-	FDateTime EmitterStartTime;
+	//RootSpanTime when the emitter started//
+	float EmitterStartTime;
 
 	//TArray<TSharedPtr<FEasyParticleState, ESPMode::ThreadSafe>> ChildrenParticle;
 	TArray<FEasyParticleState*> ChildrenParticle;
@@ -25,6 +46,10 @@ struct FEasyParticleChildEmitterArray
 	float ActivityInParentLifeTime;
 	bool FollowParentPosition;
 	float FollowParentSpeedPercent;
+	//Material instance of the particles of the emitter, when its asset has ShareMaterialInstance//
+	UMaterialInstanceDynamic* SharedMaterialInstance;
+	//Replaced rather than changed when the settings change, the particles already spawned keep theirs//
+	TSharedPtr<FEasyParticleEmitterConfig, ESPMode::ThreadSafe> Config;
 
 	/**********Update Every Frame***********/
 	bool IsStartEmitter;
@@ -38,17 +63,11 @@ class FEasyParticleState
 {
 public:
 	/***************CurState ,Update in Tick*************/
+	//Position, speed, lifetime, rotation, size and color are in the simulation lane, see GetCurPos//
 	float SpawnParticleDeltaTime;
-	float CurLifetime;
 	float CurPercent;
 	float CurSize;
-	float CurSizeX;
-	float CurSizeY;
-	float CurRotation;
 	float CurAngle;
-	FVector2D CurSpeed;
-	FVector2D CurPos;
-	FLinearColor CurColor;
 	FVector2D CurPivot;
 	float CurDelay;
 	float RootSpanTime;
@@ -69,12 +88,8 @@ public:
 	float RotationStart;
 	float DirectionScale;
 	float VerticalDirectionScale;
-	EEmitterType EmitterType;
-	EPositionType PositionType;
-	EParticleDrawEffect DrawEffect;
 	FVector2D StartSpeed;
-	bool FollowParentPosition;
-	float FollowParentSpeedPercent;
+	TSharedPtr<FEasyParticleEmitterConfig, ESPMode::ThreadSafe> EmitterConfig;
 
 	//LerpKey//
 	float SizeLerpKey;
@@ -128,6 +143,8 @@ public:
 	/***************Particle Info ,Set in Create*************/
 	FSlateBrush ImageBrush;
 	UObject* ParticleResource;
+	//ScalarParams written to the vertices instead of the material instance, see ShareMaterialInstance//
+	FVector2D VertexScalarParams;
 	UUIParticleEmitterAsset* RootAsset;
 	UUIParticleEmitterAsset* SelfAsset;
 	bool IsRoot;
@@ -138,6 +155,74 @@ public:
 	FEasyParticleState* ParentParticle;
 	FEasyParticleRootState* RootParticle;
 
+	/***************Simulation Lane ,Set by the pool (the root has its own)*************/
+	FEasyParticleSimLanes* SimLanes;
+	int32 SimLaneIndex;
+	bool IsIntegrationPending;
+	float PendingDeltaTime;
+
+	FVector2D GetCurPos() const
+	{
+		return FVector2D(SimLanes->PosX[SimLaneIndex], SimLanes->PosY[SimLaneIndex]);
+	}
+	void SetCurPos(const FVector2D& Pos)
+	{
+		SimLanes->PosX[SimLaneIndex] = Pos.X;
+		SimLanes->PosY[SimLaneIndex] = Pos.Y;
+	}
+	FVector2D GetCurSpeed() const
+	{
+		return FVector2D(SimLanes->SpeedX[SimLaneIndex], SimLanes->SpeedY[SimLaneIndex]);
+	}
+	void SetCurSpeed(const FVector2D& Speed)
+	{
+		SimLanes->SpeedX[SimLaneIndex] = Speed.X;
+		SimLanes->SpeedY[SimLaneIndex] = Speed.Y;
+	}
+	float GetCurLifetime() const
+	{
+		return SimLanes->Lifetime[SimLaneIndex];
+	}
+	void SetCurLifetime(float Value)
+	{
+		SimLanes->Lifetime[SimLaneIndex] = Value;
+	}
+	float GetCurRotation() const
+	{
+		return SimLanes->Rotation[SimLaneIndex];
+	}
+	void SetCurRotation(float Value)
+	{
+		SimLanes->Rotation[SimLaneIndex] = Value;
+	}
+	float GetCurSizeX() const
+	{
+		return SimLanes->SizeX[SimLaneIndex];
+	}
+	void SetCurSizeX(float Value)
+	{
+		SimLanes->SizeX[SimLaneIndex] = Value;
+	}
+	float GetCurSizeY() const
+	{
+		return SimLanes->SizeY[SimLaneIndex];
+	}
+	void SetCurSizeY(float Value)
+	{
+		SimLanes->SizeY[SimLaneIndex] = Value;
+	}
+	FLinearColor GetCurColor() const
+	{
+		return FLinearColor(SimLanes->ColorR[SimLaneIndex], SimLanes->ColorG[SimLaneIndex], SimLanes->ColorB[SimLaneIndex], SimLanes->ColorA[SimLaneIndex]);
+	}
+	void SetCurColor(const FLinearColor& Color)
+	{
+		SimLanes->ColorR[SimLaneIndex] = Color.R;
+		SimLanes->ColorG[SimLaneIndex] = Color.G;
+		SimLanes->ColorB[SimLaneIndex] = Color.B;
+		SimLanes->ColorA[SimLaneIndex] = Color.A;
+	}
+
 	/***************Functions*************/
 	FEasyParticleState();
 	virtual ~FEasyParticleState();
@@ -148,12 +233,16 @@ public:
 	FEasyParticleState* CreateParticle(const FGeometry& AllottedGeometry, int32 ChildParticlePoolIndex);
 
 	void UpdateParticle(float dt, const FGeometry& AllottedGeometry);
+	void FinishUpdateParticle(float dt);
+	void ApplyPendingIntegration();
 	void ResetStateProperty();
 	void TickSelf(const float InDeltaTime, const FGeometry& AllottedGeometry, FVector2D InCurWidgetPosition, float InCurWidgetRotation, float RootScale = 1.0, float InRootSpanTime = 0);
 	
 	void CaculatePaintParams(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FWidgetStyle& InWidgetStyle);
 	void OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled);
 	void OnPaintSelf(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled);
+	void CollectPaintBatches(FEasyParticlePaintBatcher& Batcher, FSlateWindowElementList& OutDrawElements, int32 LayerId);
+	void UpdateScalarParams();
 
 	void SetInPool(bool inpool);
 	bool IsInPool();
@@ -176,6 +265,9 @@ public:
 	/***************CurState ,Update in Tick*************/
 	bool FirstRootTick;
 
+	//The root is in no pool, its hot state is in a lane of its own//
+	FEasyParticleSimLanes RootLane;
+
 	/***************Functions*************/
 	void FirstTick(const float FirstDeltaTime, const FGeometry& AllottedGeometry);
 	void TickTick(const float FirstDeltaTime, const FGeometry& AllottedGeometry);
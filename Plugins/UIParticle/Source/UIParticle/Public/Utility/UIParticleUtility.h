@@ -3,6 +3,8 @@
 #pragma once
 #include "Asset/UIParticleEmitterAsset.h"
 #include "Particle/EasyParticleState.h"
+#include "Particle/EasyParticleSimulation.h"
+#include "Particle/EasyParticlePaintBatch.h"
 #include "UObject/GCObject.h"
 #include "UIParticleUtility.generated.h"
 
@@ -100,6 +102,7 @@ class FEasyParticleStatePool
 {
 public:
 	TArray<FEasyParticleStateBatch*> PoolList;
+	FEasyParticleSimLanes SimLanes;
 	int32 CurIndex;
 	int32 FreeCount;
 	int32 TotalCount;
@@ -169,6 +172,8 @@ public:
 			if (Ret)
 			{
 				FreeCount--;
+				Ret->SimLanes = &SimLanes;
+				Ret->SimLaneIndex = SimLanes.AddLane();
 			}
 			return Ret;
 		}
@@ -180,6 +185,25 @@ public:
 		return TotalCount - FreeCount;
 	}
 
+	void ApplyPendingIntegration(int32 StartIndex, int32 EndIndex)
+	{
+		int32 BatchStart = 0;
+		for (int32 i = 0; i < PoolList.Num() && BatchStart < EndIndex; i++)
+		{
+			FEasyParticleStateBatch* CurBatch = PoolList[i];
+			if (CurBatch)
+			{
+				int32 First = FMath::Max(StartIndex - BatchStart, 0);
+				int32 Last = FMath::Min(EndIndex - BatchStart, CurBatch->Num());
+				for (int32 j = First; j < Last; j++)
+				{
+					(*CurBatch)[j]->ApplyPendingIntegration();
+				}
+				BatchStart = BatchStart + CurBatch->Num();
+			}
+		}
+	}
+
 	FEasyParticleState* operator[](int pos)
 	{
 		if (pos < 0)
@@ -223,18 +247,21 @@ public:
 	void TickRoot(FEasyParticleRootState* RootPtr, const float InDeltaTime, const FGeometry& AllottedGeometry);
 	void OnRootPaint(FEasyParticleRootState* RootPtr, const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled);
 
-	void AddReferencedMaterialInstances(FEasyParticleState* Emitter, FReferenceCollector& Collector);
+	/** Returns the number of objects added */
+	int32 AddReferencedMaterialInstances(FEasyParticleState* Emitter, FReferenceCollector& Collector);
 	/** FGCObject interface */
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
 
 private:
 	void ParallelTick(FEasyParticleRootState* RootPtr, const float InDeltaTime, const FGeometry& AllottedGeometry);
+	void IntegratePool(FEasyParticleStatePool* ParticlePoolPtr, bool bParallel);
 	void Tick(FEasyParticleRootState* RootPtr, const float InDeltaTime, const FGeometry& AllottedGeometry);
 	void OnPaint(FEasyParticleRootState* RootPtr, const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled);
 	void OnParallelPaint(FEasyParticleRootState* RootPtr, const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled);
 
 	TArray<TMap<FEasyParticleRootState*, FEasyParticleStatePool*>> ParticlePoolMapArray;
 	TArray<TSharedPtr<FEasyParticleRootState, ESPMode::ThreadSafe>> ParticleRefArray;
+	FEasyParticlePaintBatcher PaintBatcher;
 
 private:
 	FUIParticleFactory();
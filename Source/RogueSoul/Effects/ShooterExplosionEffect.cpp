@@ -19,12 +19,34 @@ AShooterExplosionEffect::AShooterExplosionEffect(const FObjectInitializer& Objec
 	ExplosionLight->SetVisibleFlag(true);
 
 	ExplosionLightFadeOut = 0.2f;
+	PlayTime = 0.0f;
 }
 
 void AShooterExplosionEffect::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// pool members are made ahead of time, they play once taken out of the pool
+	if (GetSharedPool() == nullptr)
+	{
+		PlayExplosion();
+	}
+}
+
+void AShooterExplosionEffect::EVENT_OnPoolBeginPlay_Implementation()
+{
+	Super::EVENT_OnPoolBeginPlay_Implementation();
+
+	UPointLightComponent* DefLight = Cast<UPointLightComponent>(GetClass()->GetDefaultSubobjectByName(ExplosionLightComponentName));
+	ExplosionLight->SetIntensity(DefLight->Intensity);
+
+	PlayExplosion();
+}
+
+void AShooterExplosionEffect::PlayExplosion()
+{
+	PlayTime = GetWorld()->GetTimeSeconds();
+
 	if (ExplosionFX)
 	{
 		UGameplayStatics::SpawnEmitterAtLocation(this, ExplosionFX, GetActorLocation(), GetActorRotation());
@@ -51,7 +73,7 @@ void AShooterExplosionEffect::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
 
-	const float TimeAlive = GetWorld()->GetTimeSeconds() - CreationTime;
+	const float TimeAlive = GetWorld()->GetTimeSeconds() - PlayTime;
 	const float TimeRemaining = FMath::Max(0.0f, ExplosionLightFadeOut - TimeAlive);
 
 	if (TimeRemaining > 0)
@@ -63,6 +85,6 @@ void AShooterExplosionEffect::Tick(float DeltaSeconds)
 	}
 	else
 	{
-		Destroy();
+		ReturnToPool();
 	}
 }
@@ -3,14 +3,16 @@
 #pragma once
 
 #include "ShooterTypes.h"
+#include "PooledActor.h"
 #include "ShooterExplosionEffect.generated.h"
 
 //
 // Spawnable effect for explosion - NOT replicated to clients
 // Each explosion type should be defined as separate blueprint
+// Recycled through the game state's actor pool
 //
 UCLASS(Abstract, Blueprintable)
-class ROGUESOUL_API AShooterExplosionEffect : public AActor
+class ROGUESOUL_API AShooterExplosionEffect : public APooledActor
 {
 	GENERATED_UCLASS_BODY()
 
@@ -43,12 +45,21 @@ public:
 	/** update fading light */
 	virtual void Tick(float DeltaSeconds) override;
 
+	/** spawn explosion again each time it is taken out of the actor pool */
+	virtual void EVENT_OnPoolBeginPlay_Implementation() override;
+
 protected:
 	/** spawn explosion */
 	virtual void BeginPlay() override;
 
+	/** spawn FX, sound and decal for SurfaceHit and start fading the light */
+	void PlayExplosion();
+
 private:
 
+	/** when the current explosion started, light fades out from there */
+	float PlayTime;
+
 	/** Point light component name */
 	FName ExplosionLightComponentName;
 
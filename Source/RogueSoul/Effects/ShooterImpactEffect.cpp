@@ -5,13 +5,28 @@
 
 AShooterImpactEffect::AShooterImpactEffect(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
-	SetAutoDestroyWhenFinished(true);
 }
 
 void AShooterImpactEffect::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
+	// pool members are made ahead of time, they play once taken out of the pool
+	if (GetSharedPool() == nullptr)
+	{
+		PlayImpact();
+	}
+}
+
+void AShooterImpactEffect::EVENT_OnPoolBeginPlay_Implementation()
+{
+	Super::EVENT_OnPoolBeginPlay_Implementation();
+
+	PlayImpact();
+}
+
+void AShooterImpactEffect::PlayImpact()
+{
 	UPhysicalMaterial* HitPhysMat = SurfaceHit.PhysMaterial.Get();
 	EPhysicalSurface HitSurfaceType = UPhysicalMaterial::DetermineSurfaceType(HitPhysMat);
 
@@ -39,6 +54,9 @@ void AShooterImpactEffect::PostInitializeComponents()
 			SurfaceHit.ImpactPoint, RandomDecalRotation, EAttachLocation::KeepWorldPosition,
 			DefaultDecal.LifeSpan);
 	}
+
+	// FX are spawned detached, nothing of this actor is needed once they are out
+	GetWorldTimerManager().SetTimerForNextTick(this, &AShooterImpactEffect::ReturnToPool);
 }
 
 UParticleSystem* AShooterImpactEffect::GetImpactFX(TEnumAsByte<EPhysicalSurface> SurfaceType) const
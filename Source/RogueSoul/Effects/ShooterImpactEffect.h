@@ -3,14 +3,16 @@
 #pragma once
 
 #include "ShooterTypes.h"
+#include "PooledActor.h"
 #include "ShooterImpactEffect.generated.h"
 
 //
 // Spawnable effect for weapon hit impact - NOT replicated to clients
 // Each impact type should be defined as separate blueprint
+// Recycled through the game state's actor pool
 //
 UCLASS(Abstract, Blueprintable)
-class ROGUESOUL_API AShooterImpactEffect : public AActor
+class ROGUESOUL_API AShooterImpactEffect : public APooledActor
 {
 	GENERATED_UCLASS_BODY()
 
@@ -116,8 +118,14 @@ class ROGUESOUL_API AShooterImpactEffect : public AActor
 	/** spawn effect */
 	virtual void PostInitializeComponents() override;
 
+	/** spawn effect again each time it is taken out of the actor pool */
+	virtual void EVENT_OnPoolBeginPlay_Implementation() override;
+
 protected:
 
+	/** spawn FX, sound and decal for SurfaceHit */
+	void PlayImpact();
+
 	/** get FX for material type */
 	UParticleSystem* GetImpactFX(TEnumAsByte<EPhysicalSurface> SurfaceType) const;
 
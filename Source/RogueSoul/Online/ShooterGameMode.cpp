@@ -10,6 +10,8 @@
 #include "Online/ShooterGameSession.h"
 #include "Bots/ShooterAIController.h"
 #include "ShooterTeamStart.h"
+#include "ILoadingScreenModule.h"
+#include "PoolPrewarm.h"
 
 
 AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -50,6 +52,32 @@ void AShooterGameMode::InitGame(const FString& MapName, const FString& Options,
 	{
 		bPauseable = false;
 	}
+
+	UPoolPrewarmSubsystem* PoolPrewarm = GetWorld()->GetSubsystem<UPoolPrewarmSubsystem>();
+	if (PoolPrewarm)
+	{
+		PoolPrewarm->OnPrewarmProgress.AddUObject(this, &AShooterGameMode::HandlePoolPrewarmProgress);
+	}
+}
+
+void AShooterGameMode::HandlePoolPrewarmProgress(float Progress)
+{
+	if (ILoadingScreenModule::IsAvailable())
+	{
+		ILoadingScreenModule::Get().DefaultScreen_UpdateLoadingProgress(Progress);
+	}
+}
+
+bool AShooterGameMode::IsPoolPrewarmComplete() const
+{
+	const UPoolPrewarmSubsystem* PoolPrewarm = GetWorld()->GetSubsystem<UPoolPrewarmSubsystem>();
+	return PoolPrewarm == nullptr || PoolPrewarm->IsPrewarmComplete();
+}
+
+bool AShooterGameMode::ReadyToStartMatch_Implementation()
+{
+	// hold the match while pools are still warming up over time
+	return IsPoolPrewarmComplete() && Super::ReadyToStartMatch_Implementation();
 }
 
 void AShooterGameMode::SetAllowBots(bool bInAllowBots, int32 InMaxBots)
@@ -77,7 +105,7 @@ void AShooterGameMode::DefaultTimer()
 	if (GetWorld()->IsPlayInEditor())
 	{
 		// start match if necessary.
-		if (GetMatchState() == MatchState::WaitingToStart)
+		if (GetMatchState() == MatchState::WaitingToStart && IsPoolPrewarmComplete())
 		{
 			StartMatch();
 		}
@@ -115,7 +143,15 @@ void AShooterGameMode::DefaultTimer()
 			}
 			else if (GetMatchState() == MatchState::WaitingToStart)
 			{
-				StartMatch();
+				if (IsPoolPrewarmComplete())
+				{
+					StartMatch();
+				}
+				else
+				{
+					// warmup is over but pools are not, check again next tick
+					MyGameState->RemainingTime = 1;
+				}
 			}
 		}
 	}
@@ -72,6 +72,15 @@ class ROGUESOUL_API AShooterGameMode : public AGameMode
 	/** Create a bot */
 	AShooterAIController* CreateBot(int32 BotNum);	
 
+	/** forwards object pool prewarm progress to the loading screen */
+	void HandlePoolPrewarmProgress(float Progress);
+
+	/** true once object pools are done warming up over time */
+	bool IsPoolPrewarmComplete() const;
+
+	/** the match doesn't start before object pools are warm */
+	virtual bool ReadyToStartMatch_Implementation() override;
+
 protected:
 
 	/** delay between first player login and starting match */
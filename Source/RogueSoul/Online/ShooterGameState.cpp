@@ -3,12 +3,35 @@
 #include "RogueSoul.h"
 #include "Online/ShooterPlayerState.h"
 #include "ShooterGameInstance.h"
+#include "OBJPool.h"
+
+static int32 GShooterActorPoolEnabled = 1;
+static FAutoConsoleVariableRef CVarShooterActorPoolEnabled(
+	TEXT("ShooterGame.ActorPool"),
+	GShooterActorPoolEnabled,
+	TEXT("Recycle projectiles and effects through the game state's actor pool instead of destroying them.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default
+	);
+
+static int32 GShooterActorPoolSize = 16;
+static FAutoConsoleVariableRef CVarShooterActorPoolSize(
+	TEXT("ShooterGame.ActorPool.Size"),
+	GShooterActorPoolSize,
+	TEXT("Number of actors made for each projectile or effect class when the class is first pooled.\n")
+	TEXT("Default is 16."),
+	ECVF_Default
+	);
 
 AShooterGameState::AShooterGameState(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	NumTeams = 0;
 	RemainingTime = 0;
 	bTimerPaused = false;
+
+	// classes are added as weapons first spawn them, there is nothing to populate at begin play
+	ActorPool = ObjectInitializer.CreateDefaultSubobject<USharedObjectPool>(this, TEXT("ActorPool"));
+	ActorPool->AutoInitialize = false;
 }
 
 void AShooterGameState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
@@ -81,3 +104,56 @@ void AShooterGameState::RequestFinishAndExitToMainMenu()
 	}
 
 }
+
+APooledActor* AShooterGameState::BeginSpawnPooled(AActor* Spawner, UClass* Class, const FTransform& SpawnTransform, AActor* Owner)
+{
+	UWorld* World = Spawner ? Spawner->GetWorld() : nullptr;
+	if (Class == nullptr || World == nullptr)
+	{
+		return nullptr;
+	}
+
+	// clients only hold proxies of replicated actors, the server pools those and wakes them up on reuse
+	const bool bReplicated = Class->GetDefaultObject<AActor>()->GetIsReplicated();
+	AShooterGameState* const GameState = World->GetGameState<AShooterGameState>();
+	if (GShooterActorPoolEnabled != 0 && GameState && GameState->ActorPool && (!bReplicated || World->GetNetMode() != NM_Client))
+	{
+		GameState->ActorPool->AddTemplateClass(Class, GShooterActorPoolSize);
+
+		FPoolSpawnOptions SpawnOptions;
+		SpawnOptions.CollisionType = EPoolCollisionType::QueryOnly;
+		SpawnOptions.EnableCollision = true;
+		SpawnOptions.SimulatePhysics = false;
+		SpawnOptions.ActorTickEnabled = true;
+
+		bool bSpawnSuccessful = false;
+		APooledActor* const Actor = USharedObjectPool::BeginDeferredSpawnFromPool(Spawner, GameState->ActorPool, Class, SpawnOptions, SpawnTransform, ESpawnActorCollisionHandlingMethod::AlwaysSpawn, Owner, false, bSpawnSuccessful);
+		if (bSpawnSuccessful)
+		{
+			// a recycled actor keeps the owner it had last time
+			Actor->SetOwner(Owner ? Owner : GameState);
+			return Actor;
+		}
+
+		// an exhausted pool hands back an actor that is still in use, never take that one over
+	}
+
+	return World->SpawnActorDeferred<APooledActor>(Class, SpawnTransform, Owner, Spawner->GetInstigator(), ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+}
+
+void AShooterGameState::FinishSpawnPooled(APooledActor* Actor, const FTransform& SpawnTransform)
+{
+	if (Actor == nullptr)
+	{
+		return;
+	}
+
+	if (Actor->GetSharedPool())
+	{
+		USharedObjectPool::FinishDeferredSpawnFromPool(Actor, false, SpawnTransform);
+	}
+	else
+	{
+		UGameplayStatics::FinishSpawningActor(Actor, SpawnTransform);
+	}
+}
@@ -4,6 +4,9 @@
 
 #include "ShooterGameState.generated.h"
 
+class APooledActor;
+class USharedObjectPool;
+
 /** ranked PlayerState map, created from the GameState */
 typedef TMap<int32, TWeakObjectPtr<AShooterPlayerState> > RankedPlayerMap; 
 
@@ -34,4 +37,25 @@ public:
 	void GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const;	
 
 	void RequestFinishAndExitToMainMenu();
+
+	/**
+	 * Take an actor of Class out of the actor pool, or deferred spawn a throwaway one when it can't be pooled.
+	 * Class is added to the pool on first use. Finish with FinishSpawnPooled; ReturnToPool replaces Destroy.
+	 * Replicated classes are only pooled on the server.
+	 */
+	static APooledActor* BeginSpawnPooled(AActor* Spawner, UClass* Class, const FTransform& SpawnTransform, AActor* Owner = nullptr);
+
+	template<class T>
+	static T* BeginSpawnPooled(AActor* Spawner, TSubclassOf<T> Class, const FTransform& SpawnTransform, AActor* Owner = nullptr)
+	{
+		return Cast<T>(BeginSpawnPooled(Spawner, *Class, SpawnTransform, Owner));
+	}
+
+	/** finish spawning an actor taken from BeginSpawnPooled, after it has been set up */
+	static void FinishSpawnPooled(APooledActor* Actor, const FTransform& SpawnTransform);
+
+private:
+	/** projectiles and effects of every weapon and vehicle, each class in its own bucket */
+	UPROPERTY(VisibleAnywhere, Category=Pool)
+	USharedObjectPool* ActorPool;
 };
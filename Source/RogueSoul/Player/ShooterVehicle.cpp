@@ -553,14 +553,14 @@ void AShooterVehicle::NotifyHit(UPrimitiveComponent* MyComp, AActor* Other, UPri
 	if (ImpactTemplate && NormalForce.SizeSquared() > FMath::Square(ImpactEffectNormalForceThreshold))
 	{
 		FTransform const SpawnTransform(HitNormal.Rotation(), HitLocation);
-		AShooterImpactEffect* EffectActor = GetWorld()->SpawnActorDeferred<AShooterImpactEffect>(ImpactTemplate, SpawnTransform);
+		AShooterImpactEffect* EffectActor = AShooterGameState::BeginSpawnPooled<AShooterImpactEffect>(this, ImpactTemplate, SpawnTransform);
 		if (EffectActor)
 		{
 			float DotBetweenHitAndUpRotation = FVector::DotProduct(HitNormal, GetMesh()->GetUpVector());
 			EffectActor->SurfaceHit = Hit;
 			EffectActor->HitForce = NormalForce;
 			EffectActor->bWheelLand = DotBetweenHitAndUpRotation > 0.8f;
-			UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
+			AShooterGameState::FinishSpawnPooled(EffectActor, SpawnTransform);
 		}
 	}
 
@@ -48,6 +48,8 @@ public class RogueSoul : ModuleRules
 				"Slate",
 				"SlateCore",
 				"ShooterGameLoadingScreen",
+				"LoadingScreen",
+				"OBJPool",
 				"Json"
 			}
 		);
@@ -44,6 +44,64 @@ void AShooterProjectile::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 	MovementComp->OnProjectileStop.AddDynamic(this, &AShooterProjectile::OnImpact);
+
+	// pool members are made ahead of time, they are set up once taken out of the pool and stay dormant until then
+	if (GetSharedPool() == nullptr)
+	{
+		InitProjectile();
+	}
+	else
+	{
+		NetDormancy = DORM_DormantAll;
+	}
+}
+
+void AShooterProjectile::EVENT_OnPoolBeginPlay_Implementation()
+{
+	Super::EVENT_OnPoolBeginPlay_Implementation();
+
+	SetNetDormancy(DORM_Awake);
+	PoolSpawnCount++;
+	bExploded = false;
+
+	ResetFlight();
+	InitProjectile();
+}
+
+void AShooterProjectile::EVENT_OnPoolEndPlay_Implementation()
+{
+	Super::EVENT_OnPoolEndPlay_Implementation();
+
+	// send the hidden state out before the channel goes dormant, clients keep the proxy for the next shot
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void AShooterProjectile::ResetFlight()
+{
+	// movement drops its updated component once it stops on impact
+	MovementComp->SetUpdatedComponent(CollisionComp);
+	MovementComp->Activate(true);
+
+	if (ParticleComp)
+	{
+		ParticleComp->Activate(true);
+	}
+}
+
+void AShooterProjectile::OnRep_PoolSpawnCount()
+{
+	bExploded = false;
+
+	CollisionComp->MoveIgnoreActors.Reset();
+	CollisionComp->MoveIgnoreActors.Add(GetInstigator());
+
+	ResetFlight();
+}
+
+void AShooterProjectile::InitProjectile()
+{
+	CollisionComp->MoveIgnoreActors.Reset();
 	CollisionComp->MoveIgnoreActors.Add(GetInstigator());
 
 	AShooterWeapon_Projectile* OwnerWeapon = Cast<AShooterWeapon_Projectile>(GetOwner());
@@ -52,7 +110,10 @@ void AShooterProjectile::PostInitializeComponents()
 		OwnerWeapon->ApplyWeaponConfig(WeaponConfig);
 	}
 
-	SetLifeSpan( WeaponConfig.ProjectileLife );
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		SetLifeSpanPool(WeaponConfig.ProjectileLife);
+	}
 	MyController = GetInstigatorController();
 }
 
@@ -91,11 +152,11 @@ void AShooterProjectile::Explode(const FHitResult& Impact)
 	if (ExplosionTemplate)
 	{
 		FTransform const SpawnTransform(Impact.ImpactNormal.Rotation(), NudgedImpactLocation);
-		AShooterExplosionEffect* const EffectActor = GetWorld()->SpawnActorDeferred<AShooterExplosionEffect>(ExplosionTemplate, SpawnTransform);
+		AShooterExplosionEffect* const EffectActor = AShooterGameState::BeginSpawnPooled<AShooterExplosionEffect>(this, ExplosionTemplate, SpawnTransform);
 		if (EffectActor)
 		{
 			EffectActor->SurfaceHit = Impact;
-			UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
+			AShooterGameState::FinishSpawnPooled(EffectActor, SpawnTransform);
 		}
 	}
 
@@ -113,12 +174,18 @@ void AShooterProjectile::DisableAndDestroy()
 	MovementComp->StopMovementImmediately();
 
 	// give clients some time to show explosion
-	SetLifeSpan( 2.0f );
+	SetLifeSpanPool(2.0f);
 }
 
 ///CODE_SNIPPET_START: AActor::GetActorLocation AActor::GetActorRotation
 void AShooterProjectile::OnRep_Exploded()
 {
+	// reset by the server when the projectile went back into the pool
+	if (!bExploded)
+	{
+		return;
+	}
+
 	FVector ProjDirection = GetActorForwardVector();
 
 	const FVector StartTrace = GetActorLocation() - ProjDirection * 200;
@@ -149,4 +216,5 @@ void AShooterProjectile::GetLifetimeReplicatedProps( TArray< FLifetimeProperty >
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
 	
 	DOREPLIFETIME( AShooterProjectile, bExploded );
+	DOREPLIFETIME( AShooterProjectile, PoolSpawnCount );
 }
\ No newline at end of file
@@ -4,20 +4,28 @@
 
 #include "GameFramework/Actor.h"
 #include "ShooterWeapon_Projectile.h"
+#include "PooledActor.h"
 #include "ShooterProjectile.generated.h"
 
 class UProjectileMovementComponent;
 class USphereComponent;
 
-// 
+// Recycled through the game state's actor pool on the server; idle projectiles stay hidden and net dormant,
+// so clients keep their proxy and reset it when the server takes the projectile out again
 UCLASS(Abstract, Blueprintable)
-class ROGUESOUL_API AShooterProjectile : public AActor
+class ROGUESOUL_API AShooterProjectile : public APooledActor
 {
 	GENERATED_UCLASS_BODY()
 
 	/** initial setup */
 	virtual void PostInitializeComponents() override;
 
+	/** [server] setup again each time the projectile is taken out of the actor pool */
+	virtual void EVENT_OnPoolBeginPlay_Implementation() override;
+
+	/** [server] stop replicating while waiting in the actor pool */
+	virtual void EVENT_OnPoolEndPlay_Implementation() override;
+
 	/** setup velocity */
 	void InitVelocity(FVector& ShootDirection);
 
@@ -56,12 +64,26 @@ protected:
 	UFUNCTION()
 	void OnRep_Exploded();
 
+	/** bumped by the server each time the projectile is taken out of the actor pool */
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_PoolSpawnCount)
+	uint8 PoolSpawnCount;
+
+	/** [client] projectile was taken out of the actor pool again, undo the last explosion */
+	UFUNCTION()
+	void OnRep_PoolSpawnCount();
+
+	/** restart movement and trail stopped by the last explosion */
+	void ResetFlight();
+
 	/** trigger explosion */
 	void Explode(const FHitResult& Impact);
 
 	/** shutdown projectile and prepare for destruction */
 	void DisableAndDestroy();
 
+	/** per shot setup: weapon config, instigator and life span */
+	void InitProjectile();
+
 	/** update velocity on client */
 	virtual void PostNetReceiveVelocity(const FVector& NewVelocity) override;
 
@@ -281,11 +281,11 @@ void AShooterWeapon_Instant::SpawnImpactEffects(const FHitResult& Impact)
 		}
 
 		FTransform const SpawnTransform(Impact.ImpactNormal.Rotation(), Impact.ImpactPoint);
-		AShooterImpactEffect* EffectActor = GetWorld()->SpawnActorDeferred<AShooterImpactEffect>(ImpactTemplate, SpawnTransform);
+		AShooterImpactEffect* EffectActor = AShooterGameState::BeginSpawnPooled<AShooterImpactEffect>(this, ImpactTemplate, SpawnTransform);
 		if (EffectActor)
 		{
 			EffectActor->SurfaceHit = UseImpact;
-			UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
+			AShooterGameState::FinishSpawnPooled(EffectActor, SpawnTransform);
 		}
 	}
 }
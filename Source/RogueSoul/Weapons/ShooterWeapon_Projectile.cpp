@@ -72,14 +72,13 @@ bool AShooterWeapon_Projectile::ServerFireProjectile_Validate(FVector Origin, FV
 void AShooterWeapon_Projectile::ServerFireProjectile_Implementation(FVector Origin, FVector_NetQuantizeNormal ShootDir)
 {
 	FTransform SpawnTM(ShootDir.Rotation(), Origin);
-	AShooterProjectile* Projectile = Cast<AShooterProjectile>(UGameplayStatics::BeginDeferredActorSpawnFromClass(this, ProjectileConfig.ProjectileClass, SpawnTM));
+	AShooterProjectile* Projectile = AShooterGameState::BeginSpawnPooled<AShooterProjectile>(this, ProjectileConfig.ProjectileClass, SpawnTM, this);
 	if (Projectile)
 	{
 		Projectile->SetInstigator(GetInstigator());
-		Projectile->SetOwner(this);
 		Projectile->InitVelocity(ShootDir);
 
-		UGameplayStatics::FinishSpawningActor(Projectile, SpawnTM);
+		AShooterGameState::FinishSpawnPooled(Projectile, SpawnTM);
 	}
 }
 